@@ -16,6 +16,7 @@
 #include "bsdsocketinterf.h"
 #include "devlog.h"
 #include <string.h>
+#include <algorithm>
 
 void CBSDSocketInterface::closeSocket(TSocketDescriptor paSockD){
 #if defined(NET_OS)
@@ -297,6 +298,83 @@ int CBSDSocketInterface::receiveDataFromUDP(TSocketDescriptor paSockD, char* paD
   return handleError(nRetVal, "UDP");
 }
 
+int CBSDSocketInterface::sendDatagramsOnUDP(TSocketDescriptor paSockD, TUDPDestAddr *paDestAddr,
+    char *const *paData, const unsigned int *paSizes, unsigned int paNumDatagrams){
+#ifdef __linux__
+  struct mmsghdr messages[scmMaxDatagramsPerCall];
+  struct iovec iovecs[scmMaxDatagramsPerCall];
+  unsigned int numSent = 0;
+  while(numSent < paNumDatagrams){
+    unsigned int batchSize = std::min(paNumDatagrams - numSent, scmMaxDatagramsPerCall);
+    memset(messages, 0, sizeof(struct mmsghdr) * batchSize);
+    for(unsigned int i = 0; i < batchSize; ++i){
+      iovecs[i].iov_base = paData[numSent + i];
+      iovecs[i].iov_len = paSizes[numSent + i];
+      messages[i].msg_hdr.msg_name = paDestAddr;
+      messages[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+      messages[i].msg_hdr.msg_iov = &iovecs[i];
+      messages[i].msg_hdr.msg_iovlen = 1;
+    }
+    int nRetVal = sendmmsg(paSockD, messages, batchSize, 0);
+    if(nRetVal <= 0){
+      if(-1 == nRetVal && EINTR == errno){
+        continue;
+      }
+      DEVLOG_ERROR("CBSDSocketInterface: UDP-Socket sendmmsg() failed: %s\n", strerror(errno));
+      break;
+    }
+    numSent += static_cast<unsigned int>(nRetVal);
+  }
+  return (0 == numSent && 0 != paNumDatagrams) ? -1 : static_cast<int>(numSent);
+#else
+  unsigned int numSent = 0;
+  for(; numSent < paNumDatagrams; ++numSent){
+    if(0 >= sendDataOnUDP(paSockD, paDestAddr, paData[numSent], paSizes[numSent])){
+      break;
+    }
+  }
+  return (0 == numSent && 0 != paNumDatagrams) ? -1 : static_cast<int>(numSent);
+#endif
+}
+
+int CBSDSocketInterface::receiveDatagramsFromUDP(TSocketDescriptor paSockD, char *paData, unsigned int paDatagramSize,
+    unsigned int *paSizes, unsigned int paMaxDatagrams){
+#ifdef __linux__
+  struct mmsghdr messages[scmMaxDatagramsPerCall];
+  struct iovec iovecs[scmMaxDatagramsPerCall];
+  unsigned int batchSize = std::min(paMaxDatagrams, scmMaxDatagramsPerCall);
+  memset(messages, 0, sizeof(struct mmsghdr) * batchSize);
+  for(unsigned int i = 0; i < batchSize; ++i){
+    iovecs[i].iov_base = paData + i * paDatagramSize;
+    iovecs[i].iov_len = paDatagramSize;
+    messages[i].msg_hdr.msg_iov = &iovecs[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+  int nRetVal;
+  do{
+    //wait for the first datagram only, then take what is pending
+    nRetVal = recvmmsg(paSockD, messages, batchSize, MSG_WAITFORONE, nullptr);
+  } while((-1 == nRetVal) && (EINTR == errno));
+
+  if(-1 == nRetVal){
+    DEVLOG_ERROR("CBSDSocketInterface: UDP-Socket recvmmsg() failed: %s\n", strerror(errno));
+    return handleError(nRetVal, "UDP");
+  }
+  for(int i = 0; i < nRetVal; ++i){
+    paSizes[i] = messages[i].msg_len;
+  }
+  return nRetVal;
+#else
+  (void)paMaxDatagrams;
+  int nRetVal = receiveDataFromUDP(paSockD, paData, paDatagramSize);
+  if(0 < nRetVal){
+    paSizes[0] = static_cast<unsigned int>(nRetVal);
+    return 1;
+  }
+  return nRetVal;
+#endif
+}
+
 int CBSDSocketInterface::handleError(int nRetVal, const char* msg) {
   // recv only sets errno if res is <= 0
   if(nRetVal <= 0) {
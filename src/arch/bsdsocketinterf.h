@@ -33,9 +33,27 @@ class CBSDSocketInterface{
     static int sendDataOnUDP(TSocketDescriptor paSockD, TUDPDestAddr *paDestAddr, char* paData, unsigned int paSize);
     static int receiveDataFromUDP(TSocketDescriptor paSockD, char* paData, unsigned int paBufSize);
 
+    /*!\brief Send several datagrams to the same destination
+     *
+     * On Linux all datagrams are handed to the kernel with sendmmsg, elsewhere they are sent one by one.
+     * \return number of datagrams sent, -1 if the first one could not be sent
+     */
+    static int sendDatagramsOnUDP(TSocketDescriptor paSockD, TUDPDestAddr *paDestAddr, char *const *paData, const unsigned int *paSizes, unsigned int paNumDatagrams);
+
+    /*!\brief Receive the datagrams pending on a socket, at least one
+     *
+     * Datagram i is stored at paData + i * paDatagramSize, its size in paSizes[i]. On Linux all pending datagrams up to
+     * paMaxDatagrams are taken with a single recvmmsg call, elsewhere only one datagram is received.
+     * \return number of datagrams received, 0 if the connection was closed, -1 on error
+     */
+    static int receiveDatagramsFromUDP(TSocketDescriptor paSockD, char *paData, unsigned int paDatagramSize, unsigned int *paSizes, unsigned int paMaxDatagrams);
+
     CBSDSocketInterface() = delete;
 
   private:
+    //! upper bound for the datagrams passed to one sendmmsg or recvmmsg call
+    static constexpr unsigned int scmMaxDatagramsPerCall = 64;
+
     static int handleError(int nRetVal, const char* msg);
 };
 
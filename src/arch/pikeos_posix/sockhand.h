@@ -29,7 +29,8 @@
 #include "../fdselecthand.h"
 #include "../bsdsocketinterf.h"
 
+typedef CFDSelectHandler CPosixFDHandler;
 
-typedef CGenericIPComSocketHandler<CFDSelectHandler, CBSDSocketInterface> CIPComSocketHandler;
+typedef CGenericIPComSocketHandler<CPosixFDHandler, CBSDSocketInterface> CIPComSocketHandler;
 
 #endif /* PIKEOS_SOCKHAND_H_ */
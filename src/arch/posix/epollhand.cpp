@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include "epollhand.h"
+#include "../devlog.h"
+#include "../../core/devexec.h"
+#include "../../core/cominfra/commfb.h"
+#include "../../core/cominfra/comCallback.h"
+#include "../../core/utils/criticalregion.h"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+DEFINE_HANDLER(CEPollHandler)
+
+CEPollHandler::CEPollHandler(CDeviceExecution& paDeviceExecution) : CExternalEventHandler(paDeviceExecution),
+    mEPollFD(epoll_create1(EPOLL_CLOEXEC)), mWakeUpFD(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+  if(-1 == mEPollFD || -1 == mWakeUpFD) {
+    DEVLOG_ERROR("[CEPollHandler] Could not create epoll instance: %s", strerror(errno));
+    return;
+  }
+  struct epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = mWakeUpFD;
+  if(-1 == epoll_ctl(mEPollFD, EPOLL_CTL_ADD, mWakeUpFD, &event)) {
+    DEVLOG_ERROR("[CEPollHandler] Could not register wake-up descriptor: %s", strerror(errno));
+  }
+}
+
+CEPollHandler::~CEPollHandler(){
+  this->end();
+  if(-1 != mWakeUpFD) {
+    close(mWakeUpFD);
+  }
+  if(-1 != mEPollFD) {
+    close(mEPollFD);
+  }
+}
+
+void CEPollHandler::run(){
+  struct epoll_event events[scmMaxEvents];
+
+  while(isAlive()){
+    int numReady = epoll_wait(mEPollFD, events, scmMaxEvents, -1);
+    if(!isAlive()){
+      //the thread has been closed in the meantime do not process any messages anymore
+      return;
+    }
+    if(numReady < 0) {
+      if(EINTR != errno) {
+        DEVLOG_ERROR("[CEPollHandler] epoll_wait failed: %s", strerror(errno));
+      }
+      continue;
+    }
+
+    for(int i = 0; i < numReady; ++i){
+      TFileDescriptor fd = events[i].data.fd;
+      if(fd == mWakeUpFD) {
+        eventfd_t value;
+        eventfd_read(mWakeUpFD, &value);
+        continue;
+      }
+      forte::com_infra::CComCallback *callee = nullptr;
+      {
+        // the callback may have been removed by an earlier callee of this wake-up
+        CCriticalRegion criticalRegion(mSync);
+        auto it = mCallbacks.find(fd);
+        if(it != mCallbacks.end()) {
+          callee = it->second;
+        }
+      }
+      if(nullptr != callee && forte::com_infra::e_Nothing != callee->recvData(&fd, 0)){
+        startNewEventChain(callee->getCommFB());
+      }
+    }
+  }
+}
+
+void CEPollHandler::onAliveChanged(bool paNewValue){
+  if(!paNewValue && -1 != mWakeUpFD){
+    eventfd_write(mWakeUpFD, 1);
+  }
+}
+
+void CEPollHandler::addComCallback(TFileDescriptor paFD, forte::com_infra::CComCallback *paComCallback){
+  {
+    CCriticalRegion criticalRegion(mSync);
+    mCallbacks[paFD] = paComCallback;
+    struct epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = paFD;
+    if(-1 == epoll_ctl(mEPollFD, EPOLL_CTL_ADD, paFD, &event)) {
+      if(EEXIST != errno || -1 == epoll_ctl(mEPollFD, EPOLL_CTL_MOD, paFD, &event)) {
+        DEVLOG_ERROR("[CEPollHandler] Could not register file descriptor %d: %s", paFD, strerror(errno));
+      }
+    }
+  }
+  if(!isAlive()){
+    this->start();
+  }
+}
+
+void CEPollHandler::removeComCallback(TFileDescriptor paFD){
+  CCriticalRegion criticalRegion(mSync);
+  if(0 != mCallbacks.erase(paFD)) {
+    // an already closed descriptor has been removed from the epoll set by the kernel
+    epoll_ctl(mEPollFD, EPOLL_CTL_DEL, paFD, nullptr);
+  }
+}
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#ifndef _EPOLLHAND_H_
+#define _EPOLLHAND_H_
+
+#include "../../core/extevhan.h"
+#include <forte_thread.h>
+#include <forte_sync.h>
+#include "../gensockhand.h"
+#include <unordered_map>
+
+namespace forte{
+  namespace com_infra{
+    class CComCallback;
+  }
+}
+
+/*!\brief An external event handler for file descriptor based external events using Linux' epoll.
+ *
+ * Drop-in replacement for the CFDSelectHandler without its FD_SETSIZE limit. Registering and removing a file
+ * descriptor is a single epoll_ctl call and a wake-up only visits the ready file descriptors. The file descriptors
+ * are watched level-triggered: CComCallback::recvData consumes one message per call, so a file descriptor stays
+ * ready as long as it has further messages queued. An eventfd ends the wait when the handler is stopped.
+ */
+class CEPollHandler : public CExternalEventHandler, private CThread {
+  DECLARE_HANDLER(CEPollHandler)
+  public:
+    typedef FORTE_SOCKET_TYPE TFileDescriptor; //!< General type definition for a file descriptor. To be used by the callback classes.
+    static const TFileDescriptor scmInvalidFileDescriptor = FORTE_INVALID_SOCKET;
+
+    void addComCallback(TFileDescriptor paFD, forte::com_infra::CComCallback *paComCallback);
+    void removeComCallback(TFileDescriptor paFD);
+
+    /* functions needed for the external event handler interface */
+    void enableHandler() override {
+      start();
+    }
+
+    void disableHandler() override {
+      end();
+    }
+
+    void setPriority(int) override {
+      //currently we are doing nothing here.
+    }
+
+    int getPriority() const override {
+      //the same as for setPriority
+      return 0;
+    }
+
+  protected:
+    void run() override;
+
+  private:
+    void onAliveChanged(bool paNewValue) override;
+
+    //! Maximum number of ready file descriptors handled per wake-up
+    static const int scmMaxEvents = 64;
+
+    int mEPollFD;
+    int mWakeUpFD; //!< eventfd signaled when the handler is stopped
+
+    std::unordered_map<TFileDescriptor, forte::com_infra::CComCallback*> mCallbacks;
+    CSyncObject mSync;
+};
+
+#endif
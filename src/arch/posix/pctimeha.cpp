@@ -16,18 +16,57 @@
 #include <time.h>
 #include <sys/time.h>
 #include "../utils/timespec_utils.h"
+#include "../forte_architecture_time.h"
 
 CTimerHandler* CTimerHandler::createTimerHandler(CDeviceExecution& paDeviceExecution){
   return new CPCTimerHandler(paDeviceExecution);
 }
 
+#ifdef FORTE_POSIX_TICKLESS_TIMER
+CPCTimerHandler::CPCTimerHandler(CDeviceExecution& paDeviceExecution) : CTimerHandler(paDeviceExecution),
+    mStartTime(getNanoSecondsMonotonic()) {
+}
+#else
 CPCTimerHandler::CPCTimerHandler(CDeviceExecution& paDeviceExecution) : CTimerHandler(paDeviceExecution)  {
 }
+#endif
 
 CPCTimerHandler::~CPCTimerHandler(){
   disableHandler();
 }
 
+#ifdef FORTE_POSIX_TICKLESS_TIMER
+
+void CPCTimerHandler::run(){
+  while(isAlive()){
+    const uint_fast64_t forteTime = getRegistrationTime();
+    advanceTo(forteTime);
+
+    //sleep until the next tick with work, a timer registered meanwhile ends the sleep early
+    const uint_fast64_t deadline = mStartTime + (forteTime + getIdleTicks(scmMaxIdleTicks) + 1) * scmNanoSecondsPerTick;
+    const uint_fast64_t now = getNanoSecondsMonotonic();
+    if(deadline > now){
+      mWakeUp.timedWait(deadline - now);
+    }
+  }
+}
+
+uint_fast64_t CPCTimerHandler::getRegistrationTime() const {
+  return (getNanoSecondsMonotonic() - mStartTime) / scmNanoSecondsPerTick;
+}
+
+void CPCTimerHandler::onTimerRegistered(){
+  mWakeUp.inc();
+}
+
+void CPCTimerHandler::onAliveChanged(bool paNewValue){
+  if(!paNewValue){
+    mWakeUp.inc();
+  }
+}
+
+#else
+
 void CPCTimerHandler::run(){
   struct timespec stReq;
   stReq.tv_sec = 0;
@@ -61,6 +100,8 @@ void CPCTimerHandler::run(){
   } 
 }
 
+#endif
+
 void CPCTimerHandler::enableHandler(){
   start();
 }
@@ -13,6 +13,7 @@
 #define _PCTIMEHA_H_
 
 #include <forte_thread.h>
+#include <forte_sem.h>
 #include "../timerha.h"
 
 /*! \ingroup posix_hal
@@ -45,6 +46,24 @@ class CPCTimerHandler : public CTimerHandler, private CThread {
   private:
     explicit CPCTimerHandler(CDeviceExecution& paDeviceExecution);
 
+#ifdef FORTE_POSIX_TICKLESS_TIMER
+    uint_fast64_t getRegistrationTime() const override;
+
+    void onTimerRegistered() override;
+
+    void onAliveChanged(bool paNewValue) override;
+
+    //! Longest sleep without a due timer in ticks, bounds the lookahead of the timing wheel
+    static constexpr uint_fast64_t scmMaxIdleTicks = cgForteTicksPerSecond;
+    static constexpr uint_fast64_t scmNanoSecondsPerTick = 1000000000ULL / cgForteTicksPerSecond;
+
+    //! Monotonic time in ns of tick 0, all ticks are scheduled relative to it so that no drift accumulates
+    const uint_fast64_t mStartTime;
+
+    //! Posted when a timer has been registered or the handler is stopped to end the current sleep early
+    forte::arch::CSemaphore mWakeUp;
+#endif
+
     friend class CTimerHandler;
 
 };
@@ -30,7 +30,7 @@ CPosixSerCommLayer::~CPosixSerCommLayer(){
 }
 
 forte::com_infra::EComResponse CPosixSerCommLayer::sendData(void *paData, unsigned int paSize){
-  if(CFDSelectHandler::scmInvalidFileDescriptor != getSerialHandler()){
+  if(CPosixFDHandler::scmInvalidFileDescriptor != getSerialHandler()){
     ssize_t nToSend = paSize;
     while(0 < nToSend){
       ssize_t nSentBytes = write(getSerialHandler(), paData, nToSend);
@@ -75,9 +75,9 @@ forte::com_infra::EComResponse CPosixSerCommLayer::openSerialConnection(const SS
   forte::com_infra::EComResponse eRetVal = forte::com_infra::e_ProcessDataNoSocket;
 
   //as first shot take the serial interface device as param (e.g., /dev/ttyS0 )
-  CFDSelectHandler::TFileDescriptor fileDescriptor = open(paSerialParameters.interfaceName.getValue(), O_RDWR | O_NOCTTY);
+  CPosixFDHandler::TFileDescriptor fileDescriptor = open(paSerialParameters.interfaceName.getValue(), O_RDWR | O_NOCTTY);
 
-  if(CFDSelectHandler::scmInvalidFileDescriptor != fileDescriptor){
+  if(CPosixFDHandler::scmInvalidFileDescriptor != fileDescriptor){
     tcgetattr(fileDescriptor, &mOldTIO);
     struct termios stNewTIO;
     memset(&stNewTIO, 0, sizeof(stNewTIO));
@@ -171,7 +171,7 @@ forte::com_infra::EComResponse CPosixSerCommLayer::openSerialConnection(const SS
     tcflush(fileDescriptor, TCIFLUSH);
     tcsetattr(fileDescriptor, TCSANOW, &stNewTIO);
 
-    getExtEvHandler<CFDSelectHandler>().addComCallback(fileDescriptor, this);
+    getExtEvHandler<CPosixFDHandler>().addComCallback(fileDescriptor, this);
     *paHandleResult = fileDescriptor;
     eRetVal = forte::com_infra::e_InitOk;
 
@@ -185,9 +185,9 @@ forte::com_infra::EComResponse CPosixSerCommLayer::openSerialConnection(const SS
 }
 
 void CPosixSerCommLayer::closeConnection(){
-  CFDSelectHandler::TFileDescriptor fileDescriptor = getSerialHandler();
-  if(CFDSelectHandler::scmInvalidFileDescriptor != fileDescriptor){
-    getExtEvHandler<CFDSelectHandler>().removeComCallback(fileDescriptor);
+  CPosixFDHandler::TFileDescriptor fileDescriptor = getSerialHandler();
+  if(CPosixFDHandler::scmInvalidFileDescriptor != fileDescriptor){
+    getExtEvHandler<CPosixFDHandler>().removeComCallback(fileDescriptor);
     tcsetattr(fileDescriptor, TCSANOW, &mOldTIO);
     close(fileDescriptor);
   }
@@ -0,0 +1,414 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include "shmcomlayer.h"
+#include "../devlog.h"
+#include "../forte_architecture_time.h"
+#include "../../core/cominfra/basecommfb.h"
+#include "../../core/datatypes/forte_string.h"
+#include "../../core/device.h"
+#include "../../core/utils/criticalregion.h"
+#include <algorithm>
+#include <climits>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+using namespace forte::com_infra;
+
+namespace {
+  //! values are kept 8 byte aligned in the segment
+  size_t alignSize(size_t paSize) {
+    return (paSize + 7) & ~static_cast<size_t>(7);
+  }
+
+  const size_t scmValueSize = sizeof(CIEC_ANY::TLargestUIntValueType);
+}
+
+std::vector<CShmComLayer::CShmGroup *> CShmComLayer::CShmGroup::smGroups;
+CSyncObject CShmComLayer::CShmGroup::smGroupsSync;
+
+CShmComLayer::CShmComLayer(CComLayer* paUpperLayer, CBaseCommFB * paFB) :
+    CComLayer(paUpperLayer, paFB), mGroup(nullptr) {
+}
+
+CShmComLayer::~CShmComLayer() {
+  closeConnection();
+}
+
+EComResponse CShmComLayer::sendData(void *, unsigned int) {
+  if(nullptr == mGroup) {
+    return e_ProcessDataSendFailed;
+  }
+  CIEC_ANY **sds = mFb->getSDs();
+
+  // check the strings before taking the seqlock, so that no publication is left half written
+  for(size_t i = 0; i < mDataTypes.size(); ++i) {
+    if(CIEC_ANY::e_STRING == mDataTypes[i] && static_cast<const CIEC_STRING &>(sds[i]->unwrap()).length() > scmMaxStringLength) {
+      DEVLOG_ERROR("[CShmComLayer] STRING value of %s exceeds %d characters\n", mFb->getInstanceName(), scmMaxStringLength);
+      return e_ProcessDataDataTypeError;
+    }
+  }
+  return mGroup->publish(sds);
+}
+
+EComResponse CShmComLayer::openConnection(char *paLayerParameter) {
+  bool dataTypesOk = false;
+  switch(mFb->getComServiceType()) {
+    case e_Publisher:
+      dataTypesOk = buildDataTypeList(mFb->getSDs(), mFb->getNumSD());
+      break;
+    case e_Subscriber:
+      dataTypesOk = buildDataTypeList(mFb->getRDs(), mFb->getNumRD());
+      break;
+    default:
+      DEVLOG_ERROR("[CShmComLayer] Only publishers and subscribers are supported\n");
+      return e_InitInvalidId;
+  }
+  if(!dataTypesOk) {
+    return e_InitInvalidId;
+  }
+
+  // segment names must not contain further slashes
+  std::string segmentName = std::string("/forte_shm_") + paLayerParameter;
+  std::replace(segmentName.begin() + 1, segmentName.end(), '/', '_');
+
+  mGroup = CShmGroup::attach(segmentName, mDataTypes);
+  if(nullptr == mGroup) {
+    return e_InitInvalidId;
+  }
+  if(e_Subscriber == mFb->getComServiceType()) {
+    mGroup->addSubscriber(*this);
+  }
+  return e_InitOk;
+}
+
+void CShmComLayer::closeConnection() {
+  if(nullptr != mGroup) {
+    if(e_Subscriber == mFb->getComServiceType()) {
+      mGroup->removeSubscriber(*this);
+    }
+    CShmGroup::detach(*mGroup);
+    mGroup = nullptr;
+  }
+}
+
+bool CShmComLayer::buildDataTypeList(CIEC_ANY **paDataPins, TPortId paNumDataPins) {
+  mDataTypes.clear();
+  for(TPortId i = 0; i < paNumDataPins; ++i) {
+    // string ids differ between processes, the data type ids are used to check the types of a group
+    CIEC_ANY::EDataTypeID dataType = paDataPins[i]->unwrap().getDataTypeID();
+    if(0 == getSlotSize(dataType)) {
+      DEVLOG_ERROR("[CShmComLayer] Data type of pin %d is not supported\n", i);
+      return false;
+    }
+    mDataTypes.push_back(static_cast<TForteByte>(dataType));
+  }
+  return true;
+}
+
+size_t CShmComLayer::getSlotSize(CIEC_ANY::EDataTypeID paDataType) {
+  if(CIEC_ANY::e_BOOL <= paDataType && paDataType <= CIEC_ANY::e_LREAL) {
+    // these data types keep their value in the CIEC_ANY's data union
+    return scmValueSize;
+  }
+  if(CIEC_ANY::e_STRING == paDataType) {
+    return alignSize(sizeof(TForteUInt16) + scmMaxStringLength);
+  }
+  return 0;
+}
+
+CShmComLayer::CShmGroup::CShmGroup(const std::string &paSegmentName, const std::vector<TForteByte> &paDataTypes) :
+    mSegmentName(paSegmentName), mHeader(nullptr), mSegmentSize(0), mDataTypes(paDataTypes), mLastSequence(0),
+    mNumLayers(0), mWaiterStarted(false) {
+}
+
+CShmComLayer::CShmGroup::~CShmGroup() {
+  end();
+  if(nullptr != mHeader) {
+    detachSegment();
+  }
+}
+
+CShmComLayer::CShmGroup *CShmComLayer::CShmGroup::attach(const std::string &paSegmentName, const std::vector<TForteByte> &paDataTypes) {
+  CCriticalRegion criticalRegion(smGroupsSync);
+  auto it = std::find_if(smGroups.begin(), smGroups.end(),
+      [&paSegmentName](const CShmGroup *paGroup){ return paGroup->mSegmentName == paSegmentName; });
+  CShmGroup *group;
+  if(smGroups.end() != it) {
+    group = *it;
+    if(group->mDataTypes != paDataTypes) {
+      DEVLOG_ERROR("[CShmComLayer] Data types do not match the ones of group %s\n", paSegmentName.c_str());
+      return nullptr;
+    }
+  } else {
+    group = new CShmGroup(paSegmentName, paDataTypes);
+    if(!group->attachSegment(group->calculateLayout())) {
+      delete group;
+      return nullptr;
+    }
+    smGroups.push_back(group);
+  }
+  ++group->mNumLayers;
+  return group;
+}
+
+void CShmComLayer::CShmGroup::detach(CShmGroup &paGroup) {
+  CCriticalRegion criticalRegion(smGroupsSync);
+  if(0 == --paGroup.mNumLayers) {
+    smGroups.erase(std::find(smGroups.begin(), smGroups.end(), &paGroup));
+    delete &paGroup;
+  }
+}
+
+void CShmComLayer::CShmGroup::addSubscriber(CShmComLayer &paLayer) {
+  {
+    CCriticalRegion criticalRegion(mSubscribersSync);
+    mSubscribers.push_back(&paLayer);
+  }
+  // the thread is started with the first subscriber and runs as long as the group is open in this instance
+  CCriticalRegion criticalRegion(smGroupsSync);
+  if(!mWaiterStarted) {
+    mSnapshot.resize(mHeader->mPayloadSize);
+    mLastSequence = mHeader->mSequence.load(std::memory_order_acquire) & ~static_cast<TForteUInt32>(1);
+    mWaiterStarted = true;
+    start();
+  }
+}
+
+void CShmComLayer::CShmGroup::removeSubscriber(CShmComLayer &paLayer) {
+  CCriticalRegion criticalRegion(mSubscribersSync);
+  mSubscribers.erase(std::find(mSubscribers.begin(), mSubscribers.end(), &paLayer));
+}
+
+EComResponse CShmComLayer::CShmGroup::publish(CIEC_ANY **paSDs) {
+  TForteUInt32 sequence;
+  if(!lockGroup(sequence)) {
+    DEVLOG_ERROR("[CShmComLayer] Group %s is locked by another publisher\n", mSegmentName.c_str());
+    return e_ProcessDataSendFailed;
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+
+  TForteByte *payload = getPayload();
+  for(size_t i = 0; i < mDataTypes.size(); ++i) {
+    const CIEC_ANY &value = paSDs[i]->unwrap();
+    TForteByte *slot = payload + mSlotOffsets[i];
+    if(CIEC_ANY::e_STRING == mDataTypes[i]) {
+      const CIEC_STRING &stringValue = static_cast<const CIEC_STRING &>(value);
+      TForteUInt16 length = stringValue.length();
+      memcpy(slot, &length, sizeof(length));
+      memcpy(slot + sizeof(length), stringValue.c_str(), length);
+    } else {
+      memcpy(slot, value.getConstDataPtr(), scmValueSize);
+    }
+  }
+
+  unlockGroup(sequence);
+  return e_ProcessDataOk;
+}
+
+bool CShmComLayer::CShmGroup::lockGroup(TForteUInt32 &paSequence) {
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_sec += static_cast<time_t>(scmWriteLockTimeout / 1000000000ULL);
+  deadline.tv_nsec += static_cast<long>(scmWriteLockTimeout % 1000000000ULL);
+  if(deadline.tv_nsec >= 1000000000L) {
+    deadline.tv_nsec -= 1000000000L;
+    ++deadline.tv_sec;
+  }
+  int result = pthread_mutex_timedlock(&mHeader->mWriteLock, &deadline);
+  if(EOWNERDEAD == result) {
+    // the owner died, possibly in the middle of a publication whose values are overwritten now
+    DEVLOG_WARNING("[CShmComLayer] A publisher of group %s died while holding it, taking over\n", mSegmentName.c_str());
+    result = pthread_mutex_consistent(&mHeader->mWriteLock);
+  }
+  if(0 != result) {
+    return false;
+  }
+  // a dead owner may have left the sequence odd
+  paSequence = mHeader->mSequence.load(std::memory_order_relaxed) & ~static_cast<TForteUInt32>(1);
+  mHeader->mSequence.store(paSequence + 1, std::memory_order_relaxed);
+  return true;
+}
+
+void CShmComLayer::CShmGroup::unlockGroup(TForteUInt32 paSequence) {
+  mHeader->mSequence.store(paSequence + 2, std::memory_order_release);
+  pthread_mutex_unlock(&mHeader->mWriteLock);
+  wakeSubscribers(mHeader->mSequence);
+}
+
+void CShmComLayer::CShmGroup::run() {
+  while(isAlive()) {
+    TForteUInt32 sequence = mHeader->mSequence.load(std::memory_order_acquire);
+    if(sequence == mLastSequence || (sequence & 1)) {
+      // the timeout only guards against missing the wake-up of a closing group
+      struct timespec timeout = {0, 100000000};
+      syscall(SYS_futex, reinterpret_cast<TForteUInt32 *>(&mHeader->mSequence), FUTEX_WAIT, sequence, &timeout, nullptr, 0);
+      continue;
+    }
+    if(readSnapshot(sequence)) {
+      mLastSequence = sequence;
+      CCriticalRegion criticalRegion(mSubscribersSync);
+      for(CShmComLayer *subscriber : mSubscribers) {
+        deliverSnapshot(*subscriber);
+      }
+    }
+  }
+}
+
+void CShmComLayer::CShmGroup::onAliveChanged(bool paNewValue) {
+  if(!paNewValue && nullptr != mHeader) {
+    wakeSubscribers(mHeader->mSequence);
+  }
+}
+
+size_t CShmComLayer::CShmGroup::calculateLayout() {
+  size_t payloadSize = 0;
+  mSlotOffsets.clear();
+  for(TForteByte dataType : mDataTypes) {
+    mSlotOffsets.push_back(payloadSize);
+    payloadSize += getSlotSize(static_cast<CIEC_ANY::EDataTypeID>(dataType));
+  }
+  return alignSize(sizeof(SShmGroupHeader)) + alignSize(mDataTypes.size()) + payloadSize;
+}
+
+bool CShmComLayer::CShmGroup::attachSegment(size_t paSegmentSize) {
+  bool creator = true;
+  int fd = shm_open(mSegmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0660);
+  if(-1 == fd && EEXIST == errno) {
+    creator = false;
+    fd = shm_open(mSegmentName.c_str(), O_RDWR, 0);
+  }
+  if(-1 == fd) {
+    DEVLOG_ERROR("[CShmComLayer] Could not open shared memory %s: %s\n", mSegmentName.c_str(), strerror(errno));
+    return false;
+  }
+
+  if(creator ? (0 != ftruncate(fd, static_cast<off_t>(paSegmentSize))) : !waitForInitializedSegment(fd, paSegmentSize)) {
+    if(creator) {
+      DEVLOG_ERROR("[CShmComLayer] Could not size shared memory %s: %s\n", mSegmentName.c_str(), strerror(errno));
+      shm_unlink(mSegmentName.c_str());
+    }
+    close(fd);
+    return false;
+  }
+
+  void *segment = mmap(nullptr, paSegmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if(MAP_FAILED == segment) {
+    DEVLOG_ERROR("[CShmComLayer] Could not map shared memory %s: %s\n", mSegmentName.c_str(), strerror(errno));
+    if(creator) {
+      shm_unlink(mSegmentName.c_str());
+    }
+    return false;
+  }
+  mHeader = static_cast<SShmGroupHeader *>(segment);
+  mSegmentSize = paSegmentSize;
+  TForteByte *dataTypes = static_cast<TForteByte *>(segment) + alignSize(sizeof(SShmGroupHeader));
+
+  if(creator) {
+    // the new segment is zero filled, which is a valid sequence and attach count
+    mHeader->mNumValues = static_cast<TForteUInt32>(mDataTypes.size());
+    mHeader->mPayloadSize = static_cast<TForteUInt32>(paSegmentSize - alignSize(sizeof(SShmGroupHeader)) - alignSize(mDataTypes.size()));
+    memcpy(dataTypes, mDataTypes.data(), mDataTypes.size());
+    pthread_mutexattr_t lockAttributes;
+    pthread_mutexattr_init(&lockAttributes);
+    pthread_mutexattr_setpshared(&lockAttributes, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&lockAttributes, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&mHeader->mWriteLock, &lockAttributes);
+    pthread_mutexattr_destroy(&lockAttributes);
+    mHeader->mMagic.store(scmMagic, std::memory_order_release);
+  } else if(mHeader->mNumValues != mDataTypes.size() || 0 != memcmp(dataTypes, mDataTypes.data(), mDataTypes.size())) {
+    DEVLOG_ERROR("[CShmComLayer] Data types do not match the ones of group %s\n", mSegmentName.c_str());
+    munmap(segment, paSegmentSize);
+    mHeader = nullptr;
+    return false;
+  }
+  mHeader->mAttachCount.fetch_add(1);
+  return true;
+}
+
+bool CShmComLayer::CShmGroup::waitForInitializedSegment(int paFD, size_t paSegmentSize) {
+  // the creator may still be initializing the segment
+  for(unsigned int retries = 0; retries < 1000; ++retries) {
+    struct stat segmentStat;
+    if(0 != fstat(paFD, &segmentStat)) {
+      return false;
+    }
+    if(static_cast<size_t>(segmentStat.st_size) >= sizeof(SShmGroupHeader)) {
+      if(static_cast<size_t>(segmentStat.st_size) != paSegmentSize) {
+        DEVLOG_ERROR("[CShmComLayer] Data types do not match the ones of group %s\n", mSegmentName.c_str());
+        return false;
+      }
+      void *segment = mmap(nullptr, sizeof(SShmGroupHeader), PROT_READ, MAP_SHARED, paFD, 0);
+      if(MAP_FAILED == segment) {
+        return false;
+      }
+      bool initialized = (scmMagic == static_cast<SShmGroupHeader *>(segment)->mMagic.load(std::memory_order_acquire));
+      munmap(segment, sizeof(SShmGroupHeader));
+      if(initialized) {
+        return true;
+      }
+    }
+    CThread::sleepThread(1);
+  }
+  DEVLOG_ERROR("[CShmComLayer] Shared memory %s has not been initialized\n", mSegmentName.c_str());
+  return false;
+}
+
+void CShmComLayer::CShmGroup::detachSegment() {
+  // the last instance leaving the group removes it, a new group with other data types can then be created
+  if(1 == mHeader->mAttachCount.fetch_sub(1)) {
+    shm_unlink(mSegmentName.c_str());
+  }
+  munmap(mHeader, mSegmentSize);
+  mHeader = nullptr;
+}
+
+bool CShmComLayer::CShmGroup::readSnapshot(TForteUInt32 paSequence) {
+  memcpy(mSnapshot.data(), getPayload(), mSnapshot.size());
+  std::atomic_thread_fence(std::memory_order_acquire);
+  // a publisher overwrote the values while copying, try again
+  return (paSequence == mHeader->mSequence.load(std::memory_order_relaxed));
+}
+
+void CShmComLayer::CShmGroup::deliverSnapshot(CShmComLayer &paLayer) {
+  CBaseCommFB &fb = *paLayer.getCommFB();
+  CCriticalRegion criticalRegion(fb.getFBLock());
+  CIEC_ANY **rds = fb.getRDs();
+  for(size_t i = 0; i < mDataTypes.size(); ++i) {
+    CIEC_ANY &value = rds[i]->unwrap();
+    const TForteByte *slot = mSnapshot.data() + mSlotOffsets[i];
+    if(CIEC_ANY::e_STRING == mDataTypes[i]) {
+      TForteUInt16 length;
+      memcpy(&length, slot, sizeof(length));
+      static_cast<CIEC_STRING &>(value).assign(reinterpret_cast<const char *>(slot + sizeof(length)), length);
+    } else {
+      memcpy(value.getDataPtr(), slot, scmValueSize);
+    }
+  }
+  // with a full interrupt queue the FB still processes the interrupts queued before, which read the new values
+  if(fb.interruptCommFB(&paLayer)) {
+    fb.getDevice()->getDeviceExecution().startNewEventChain(&fb);
+  }
+}
+
+TForteByte *CShmComLayer::CShmGroup::getPayload() const {
+  return reinterpret_cast<TForteByte *>(mHeader) + alignSize(sizeof(SShmGroupHeader)) + alignSize(mDataTypes.size());
+}
+
+void CShmComLayer::CShmGroup::wakeSubscribers(std::atomic<TForteUInt32> &paFutex) {
+  syscall(SYS_futex, reinterpret_cast<TForteUInt32 *>(&paFutex), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#ifndef _SHMCOMLAYER_H_
+#define _SHMCOMLAYER_H_
+
+#include "../../core/cominfra/comlayer.h"
+#include "../../core/datatypes/forte_any.h"
+#include <forte_thread.h>
+#include <forte_sync.h>
+#include <atomic>
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+/*!\brief Publish/subscribe between FORTE instances on one host through POSIX shared memory
+ *
+ * Each group (ID shm[groupname]) is a shared memory segment holding the data types of the group and one slot per
+ * value. Publishers write the raw values of their SDs into the slots under a seqlock, subscribers copy them straight
+ * into their RDs; there is no serialization. Supported are all elementary data types except WSTRING, STRINGs are
+ * limited to scmMaxStringLength characters. The segment's sequence counter doubles as futex, on which one thread per
+ * group and FORTE instance waits for new publications and hands them to all subscribers of the instance.
+ *
+ * As in the local communication layer the data types of all publishers and subscribers of a group have to match.
+ * The first FB opening a group defines them, later ones with other data types are rejected.
+ *
+ * Publishers are serialized by a robust process-shared mutex in the segment. A publisher waits at most
+ * scmWriteLockTimeout for it. If the process holding it has died, also in the middle of a publication, the kernel
+ * hands the mutex to the next publisher, which overwrites the half written values. This does not depend on process
+ * ids, so groups can be shared between PID namespaces as long as the instances share /dev/shm. The last FB leaving a
+ * group removes its segment. A FORTE instance which is killed does not leave its groups, so their segments stay in
+ * /dev/shm/forte_shm_* until they are removed by hand. Such a stale group keeps working, but its data types can only
+ * be changed after removing it.
+ */
+class CShmComLayer : public forte::com_infra::CComLayer {
+  public:
+    CShmComLayer(forte::com_infra::CComLayer* paUpperLayer, forte::com_infra::CBaseCommFB * paFB);
+    ~CShmComLayer() override;
+
+    forte::com_infra::EComResponse sendData(void *paData, unsigned int paSize) override;
+    forte::com_infra::EComResponse recvData(const void *, unsigned int) override {
+      return forte::com_infra::e_ProcessDataOk;
+    }
+
+    forte::com_infra::EComResponse processInterrupt() override {
+      return forte::com_infra::e_ProcessDataOk;
+    }
+
+    //! Maximum number of characters of a STRING value
+    static const TForteUInt16 scmMaxStringLength = 254;
+
+    //! Maximum time in ns a publisher waits for another one writing the same group
+    static const uint_fast64_t scmWriteLockTimeout = 1000000000ULL;
+
+    //! Begin of the shared memory segment of a group, followed by the data type ids and the value slots
+    struct SShmGroupHeader {
+        std::atomic<TForteUInt32> mMagic; //!< set by the creator once the segment is initialized
+        TForteUInt32 mNumValues;
+        TForteUInt32 mPayloadSize;
+        //! seqlock: odd while a publisher writes, also used as futex for waking the subscribers
+        std::atomic<TForteUInt32> mSequence;
+        std::atomic<TForteUInt32> mAttachCount; //!< number of FORTE instances which have the group open
+        //! serializes the publishers, robust so that the death of its owner is reported to the next publisher
+        pthread_mutex_t mWriteLock;
+    };
+
+  private:
+    static_assert(std::atomic<TForteUInt32>::is_always_lock_free, "the shared memory layer needs lock free atomics");
+
+    /*!\brief The mapping of one group in this FORTE instance, shared by all its publishers and subscribers
+     *
+     * The first subscriber starts a thread waiting for the publications of the group, which copies them into the RDs
+     * of all subscribers of the instance. The group is unmapped when its last layer of the instance leaves it.
+     */
+    class CShmGroup : private CThread {
+      public:
+        static CShmGroup *attach(const std::string &paSegmentName, const std::vector<TForteByte> &paDataTypes);
+        static void detach(CShmGroup &paGroup);
+
+        void addSubscriber(CShmComLayer &paLayer);
+        void removeSubscriber(CShmComLayer &paLayer);
+
+        forte::com_infra::EComResponse publish(CIEC_ANY **paSDs);
+
+        CShmGroup(const CShmGroup&) = delete;
+        CShmGroup& operator=(const CShmGroup&) = delete;
+
+      private:
+        CShmGroup(const std::string &paSegmentName, const std::vector<TForteByte> &paDataTypes);
+        ~CShmGroup() override;
+
+        void run() override;
+        void onAliveChanged(bool paNewValue) override;
+
+        size_t calculateLayout();
+        bool attachSegment(size_t paSegmentSize);
+        bool waitForInitializedSegment(int paFD, size_t paSegmentSize);
+        void detachSegment();
+
+        bool lockGroup(TForteUInt32 &paSequence);
+        void unlockGroup(TForteUInt32 paSequence);
+
+        bool readSnapshot(TForteUInt32 paSequence);
+        void deliverSnapshot(CShmComLayer &paLayer);
+
+        TForteByte *getPayload() const;
+
+        static void wakeSubscribers(std::atomic<TForteUInt32> &paFutex);
+
+        static const TForteUInt32 scmMagic = 0x46534D33; // "FSM3"
+
+        std::string mSegmentName;
+        SShmGroupHeader *mHeader;
+        size_t mSegmentSize;
+
+        std::vector<TForteByte> mDataTypes; //!< CIEC_ANY::EDataTypeID of each value
+        std::vector<size_t> mSlotOffsets; //!< offset of each value's slot in the payload
+        std::vector<TForteByte> mSnapshot; //!< copy of the payload taken by the waiting thread
+        TForteUInt32 mLastSequence;
+
+        size_t mNumLayers; //!< layers of this instance using the group, needs smGroupsSync
+        bool mWaiterStarted; //!< needs smGroupsSync
+        std::vector<CShmComLayer *> mSubscribers;
+        CSyncObject mSubscribersSync; //!< protects mSubscribers against changes while a publication is handed on
+
+        static std::vector<CShmGroup *> smGroups;
+        static CSyncObject smGroupsSync; //!< protects smGroups and the opening and closing of the groups
+    };
+
+    forte::com_infra::EComResponse openConnection(char *paLayerParameter) override;
+    void closeConnection() override;
+
+    bool buildDataTypeList(CIEC_ANY **paDataPins, TPortId paNumDataPins);
+
+    static size_t getSlotSize(CIEC_ANY::EDataTypeID paDataType);
+
+    std::vector<TForteByte> mDataTypes; //!< CIEC_ANY::EDataTypeID of each value
+    CShmGroup *mGroup;
+};
+
+#endif /* _SHMCOMLAYER_H_ */
@@ -22,11 +22,19 @@
 #include <errno.h>
 #include <string.h>
 
+#include <forte_config.h>
+
 //these include needs to be last
 #include "../gensockhand.h"
+#ifdef FORTE_POSIX_EPOLL
+#include "epollhand.h"
+typedef CEPollHandler CPosixFDHandler;
+#else
 #include "../fdselecthand.h"
+typedef CFDSelectHandler CPosixFDHandler;
+#endif
 #include "../bsdsocketinterf.h"
 
-typedef CGenericIPComSocketHandler<CFDSelectHandler, CBSDSocketInterface> CIPComSocketHandler;
+typedef CGenericIPComSocketHandler<CPosixFDHandler, CBSDSocketInterface> CIPComSocketHandler;
 
 #endif /* SOCKHAND_H_ */
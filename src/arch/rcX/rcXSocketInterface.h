@@ -101,6 +101,12 @@ class CrcXSocketInterface : public CExternalEventHandler, private CThread{
     static int sendDataOnUDP(TSocketDescriptor paSockD, TUDPDestAddr *paDestAddr, char* paData, unsigned int paSize);
     static int receiveDataFromUDP(TSocketDescriptor paSockD, char* paData, unsigned int paBufSize);
 
+    //! Send several datagrams to the same destination one by one, returns the number of datagrams sent or -1
+    static int sendDatagramsOnUDP(TSocketDescriptor paSockD, TUDPDestAddr *paDestAddr, char *const *paData, const unsigned int *paSizes, unsigned int paNumDatagrams);
+
+    //! Receive one datagram into paData and its size into paSizes[0], returns 1 on success, 0 or -1 on failure
+    static int receiveDatagramsFromUDP(TSocketDescriptor paSockD, char *paData, unsigned int paDatagramSize, unsigned int *paSizes, unsigned int paMaxDatagrams);
+
     /* Handler functions */
 
     void addComCallback(TSocketDescriptor paFD, forte::com_infra::CComLayer *paComLayer);
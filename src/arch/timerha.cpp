@@ -21,7 +21,6 @@
 #include "../core/esfb.h"
 #include "../core/utils/criticalregion.h"
 #include <algorithm>
-#include <functional>
 
 DEFINE_HANDLER(CTimerHandler)
 
@@ -34,12 +33,12 @@ CTimerHandler::~CTimerHandler() = default;
 
 void CTimerHandler::registerOneShotTimedFB(CEventSourceFB *const paTimedFB, const CIEC_TIME &paTimeInterval) {
 	TForteUInt32 interval = convertIntervalToTimerHandlerUnits(paTimeInterval);
-	addToAddFBList(STimedFBListEntry(paTimedFB, mForteTime + interval, scmOneShotIndicator));
+	addToAddFBList(STimedFBListEntry(paTimedFB, getRegistrationTime() + interval, scmOneShotIndicator));
 }
 
 void CTimerHandler::registerPeriodicTimedFB(CEventSourceFB *const paTimedFB, const CIEC_TIME &paTimeInterval) {
 	TForteUInt32 interval = convertIntervalToTimerHandlerUnits(paTimeInterval);
-	addToAddFBList(STimedFBListEntry(paTimedFB, mForteTime + interval, interval));
+	addToAddFBList(STimedFBListEntry(paTimedFB, getRegistrationTime() + interval, interval));
 }
 
 TForteUInt32 CTimerHandler::convertIntervalToTimerHandlerUnits(const CIEC_TIME &paTimeInterval){
@@ -48,13 +47,20 @@ TForteUInt32 CTimerHandler::convertIntervalToTimerHandlerUnits(const CIEC_TIME &
 }
 
 void CTimerHandler::addToAddFBList(const STimedFBListEntry& paTimerListEntry){
-  CCriticalRegion criticalRegion(mAddListSync);
-  mAddFBList.push_back(paTimerListEntry);
+  {
+    CCriticalRegion criticalRegion(mAddListSync);
+    mAddFBList.push_back(paTimerListEntry);
+  }
+  onTimerRegistered();
 }
 
-void CTimerHandler::addTimedFBEntry(const STimedFBListEntry& paTimerListEntry) {
-  auto it = std::upper_bound(mTimedFBList.begin(), mTimedFBList.end(), paTimerListEntry);
-  mTimedFBList.insert(it, paTimerListEntry);
+CTimerHandler::STimedFB &CTimerHandler::getTimedFB(const STimedFBListEntry& paTimerListEntry) {
+  STimedFB &timedFB = mTimedFBs[paTimerListEntry.mTimedFB];
+  mTimingWheel.remove(timedFB);
+  timedFB.mTimedFB = paTimerListEntry.mTimedFB;
+  timedFB.mInterval = paTimerListEntry.mInterval;
+  timedFB.mTimeOut = paTimerListEntry.mTimeOut;
+  return timedFB;
 }
 
 void CTimerHandler::unregisterTimedFB(CEventSourceFB *paTimedFB) {
@@ -63,9 +69,11 @@ void CTimerHandler::unregisterTimedFB(CEventSourceFB *paTimedFB) {
 }
 
 void CTimerHandler::removeTimedFB(CEventSourceFB *paTimedFB) {
-  auto it = std::remove_if(mTimedFBList.begin(), mTimedFBList.end(), 
-  	[&paTimedFB](const STimedFBListEntry& entry) { return entry.mTimedFB == paTimedFB; });
-  mTimedFBList.erase(it, mTimedFBList.end());
+  auto it = mTimedFBs.find(paTimedFB);
+  if(it != mTimedFBs.end()) {
+    mTimingWheel.remove(it->second);
+    mTimedFBs.erase(it);
+  }
 }
 
 void CTimerHandler::nextTick() {
@@ -83,31 +91,54 @@ void CTimerHandler::nextTick() {
   }
 }
 
-void CTimerHandler::processTimedFBList() {
-  auto last = std::upper_bound(mTimedFBList.begin(), mTimedFBList.end(), mForteTime);
-  std::vector<STimedFBListEntry> triggered(mTimedFBList.begin(), last);
-  mTimedFBList.erase(mTimedFBList.begin(), last);
-  for (auto &fb : triggered) {
-     triggerTimedFB(fb);
+void CTimerHandler::advanceTo(uint_fast64_t paForteTime) {
+  while(mForteTime < paForteTime) {
+    const uint_fast64_t idleTicks = getIdleTicks(paForteTime - mForteTime - 1);
+    mTimingWheel.skip(idleTicks);
+    mForteTime += idleTicks;
+    nextTick();
   }
 }
 
-void CTimerHandler::triggerTimedFB(STimedFBListEntry paTimerListEntry) {
-  mDeviceExecution.startNewEventChain(paTimerListEntry.mTimedFB);
-  if(paTimerListEntry.mInterval != scmOneShotIndicator){
-      paTimerListEntry.mTimeOut = mForteTime + paTimerListEntry.mInterval;  // the next activation time of this FB
-      addTimedFBEntry(paTimerListEntry); //re-register the timed FB
+uint_fast64_t CTimerHandler::getIdleTicks(uint_fast64_t paMaxTicks) const {
+  {
+    CCriticalRegion criticalRegion(mAddListSync);
+    if(!mAddFBList.empty()) {
+      return 0;
+    }
+  }
+  {
+    CCriticalRegion criticalRegion(mRemoveListSync);
+    if(!mRemoveFBList.empty()) {
+      return 0;
+    }
+  }
+  return mTimingWheel.getIdleTicks(paMaxTicks);
+}
+
+void CTimerHandler::processTimedFBList() {
+  mTimingWheel.tick([this](forte::core::util::CTimingWheel::STimer &paTimer) {
+    triggerTimedFB(static_cast<STimedFB &>(paTimer));
+  });
+}
+
+void CTimerHandler::triggerTimedFB(STimedFB &paTimedFB) {
+  mDeviceExecution.startNewEventChain(paTimedFB.mTimedFB);
+  if(paTimedFB.mInterval != scmOneShotIndicator){
+    paTimedFB.mTimeOut = mForteTime + paTimedFB.mInterval;  // the next activation time of this FB
+    mTimingWheel.add(paTimedFB); //re-register the timed FB
   }
 }
 
 void CTimerHandler::processAddList() {
   CCriticalRegion criticalRegion(mAddListSync);
-  for (auto entry : mAddFBList) {
-	  if(entry.mTimeOut < mForteTime) {
-		  triggerTimedFB(entry);
-	  } else {
-	    addTimedFBEntry(entry);
-	  }
+  for (const auto &entry : mAddFBList) {
+    STimedFB &timedFB = getTimedFB(entry);
+    if(entry.mTimeOut < mForteTime) {
+      triggerTimedFB(timedFB);
+    } else {
+      mTimingWheel.add(timedFB);
+    }
   }
   mAddFBList.clear();
 }
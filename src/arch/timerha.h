@@ -21,6 +21,8 @@
 #include "../core/extevhan.h"
 #include <forte_sync.h>
 #include "forte_time.h"
+#include "../core/utils/timingwheel.h"
+#include <unordered_map>
 #include <vector>
 
 class CEventSourceFB;
@@ -80,11 +82,37 @@ class CTimerHandler : public CExternalEventHandler{
     //! one tick of time elapsed. Implementations should call this function on each tick.
     void nextTick();
 
-    //! returns the time since startup of FORTE
+    /*! returns the time since startup of FORTE
+     *
+     * Tickless implementations derive it from their clock, so it also advances while the timer handler sleeps.
+     */
     uint_fast64_t getForteTime() const{
+      return getRegistrationTime();
+    }
+
+  protected:
+    /*!\brief Advance the runtime time to paForteTime
+     *
+     * Ticks in which no timer expires are passed over without handling them. Tickless implementations call this
+     * function instead of nextTick.
+     */
+    void advanceTo(uint_fast64_t paForteTime);
+
+    //! Number of upcoming ticks, at most paMaxTicks, in which the timer handler has nothing to do
+    uint_fast64_t getIdleTicks(uint_fast64_t paMaxTicks) const;
+
+    /*!\brief The time in ticks new timers are registered relative to
+     *
+     * Tickless implementations do not advance mForteTime while sleeping and have to provide the current time.
+     */
+    virtual uint_fast64_t getRegistrationTime() const {
       return mForteTime;
     }
 
+    //! Called after a timer has been registered, tickless implementations use it to wake up and reschedule
+    virtual void onTimerRegistered() {
+    }
+
   private:
     //! Data stored for each FB that is registered to the timer handler
     struct STimedFBListEntry{
@@ -97,19 +125,12 @@ class CTimerHandler : public CExternalEventHandler{
         }
 
         STimedFBListEntry() = default;
+    };
 
-        bool operator<(const STimedFBListEntry& paRHS) const {
-          return mTimeOut < paRHS.mTimeOut;
-        }
-
-        bool operator<(uint_fast64_t paRHS)  const {
-          return mTimeOut < paRHS;
-        }
-
-        friend bool operator<(uint_fast64_t paLHS, const STimedFBListEntry& paRHS) {
-          return paLHS < paRHS.mTimeOut;
-        }
-
+    //! Timer of one registered FB linked into the timing wheel
+    struct STimedFB : forte::core::util::CTimingWheel::STimer{
+        CEventSourceFB *mTimedFB = nullptr;
+        TForteUInt32 mInterval = 0;
     };
 
     static constexpr TForteUInt32 scmOneShotIndicator = 0;
@@ -120,32 +141,42 @@ class CTimerHandler : public CExternalEventHandler{
     void addToAddFBList(const STimedFBListEntry &paTimerListEntry);
     TForteUInt32 convertIntervalToTimerHandlerUnits(const CIEC_TIME &paTimeInterval);
 
-    //!Add an entry to the timed list.
-    void addTimedFBEntry(const STimedFBListEntry & paTimerListEntry);
+    /*!\brief Get the timer node of the entry's FB, updated to the entry and not linked into the timing wheel
+     *
+     * Each FB has at most one timer, registering an FB again re-arms its timer.
+     */
+    STimedFB &getTimedFB(const STimedFBListEntry &paTimerListEntry);
 
     void processTimedFBList();
     void processAddList();
     void processRemoveList();
 
-    //!Remove an entry from the timed list.
+    //!Remove an entry from the timing wheel.
     void removeTimedFB(CEventSourceFB *paTimedFB);
 
-    //! process one timed FB entry, trigger the external event and if needed readd into the list.
-    void triggerTimedFB(STimedFBListEntry paTimerListEntry);
+    //! process one expired timer, trigger the external event and if needed re-add it to the timing wheel.
+    void triggerTimedFB(STimedFB &paTimedFB);
 
     //!The runtime time in ticks till the start of FORTE.
     uint_fast64_t mForteTime;
 
-    //! List of function blocks currently registered to the timer handler
-    std::vector<STimedFBListEntry> mTimedFBList;
+    //! Timers of the function blocks currently registered to the timer handler
+    forte::core::util::CTimingWheel mTimingWheel;
+
+    /*! \brief Timer nodes of all FBs that have been registered
+     *
+     * Expired one shot timers keep their node so that re-registering an FB does not allocate. Nodes are only released
+     * when the FB is unregistered.
+     */
+    std::unordered_map<CEventSourceFB*, STimedFB> mTimedFBs;
 
     //! List of function blocks to be added to the timer handler
     std::vector<STimedFBListEntry> mAddFBList;
-    CSyncObject mAddListSync;
+    mutable CSyncObject mAddListSync;
 
     //! List of function blocks to be removed from the timer handler
     std::vector<CEventSourceFB *> mRemoveFBList;
-    CSyncObject mRemoveListSync;
+    mutable CSyncObject mRemoveListSync;
 
 };
 
@@ -289,6 +289,25 @@ int CWin32SocketInterface::receiveDataFromUDP(TSocketDescriptor paSockD, char* p
   return nRetVal;
 }
 
+int CWin32SocketInterface::sendDatagramsOnUDP(TSocketDescriptor paSockD, TUDPDestAddr *paDestAddr, char *const *paData, const unsigned int *paSizes, unsigned int paNumDatagrams){
+  unsigned int numSent = 0;
+  for(; numSent < paNumDatagrams; ++numSent){
+    if(0 >= sendDataOnUDP(paSockD, paDestAddr, paData[numSent], paSizes[numSent])){
+      break;
+    }
+  }
+  return (0 == numSent && 0 != paNumDatagrams) ? -1 : static_cast<int>(numSent);
+}
+
+int CWin32SocketInterface::receiveDatagramsFromUDP(TSocketDescriptor paSockD, char *paData, unsigned int paDatagramSize, unsigned int *paSizes, unsigned int){
+  int nRetVal = receiveDataFromUDP(paSockD, paData, paDatagramSize);
+  if(0 < nRetVal){
+    paSizes[0] = static_cast<unsigned int>(nRetVal);
+    return 1;
+  }
+  return nRetVal;
+}
+
 LPSTR CWin32SocketInterface::getErrorMessage(int paErrorNumber){
   LPSTR pacErrorMessage = nullptr;
   FormatMessage(
@@ -21,7 +21,7 @@ CBasicFB::CBasicFB(forte::core::CFBContainer &paContainer, const SFBInterfaceSpe
                    const CStringDictionary::TStringId paInstanceNameId,
                    const SInternalVarsInformation *paVarInternals) :
         CFunctionBlock(paContainer, paInterfaceSpec, paInstanceNameId), mECCState(0),
-        cmVarInternals(paVarInternals), mBasicFBVarsData(nullptr), mInternals(nullptr) {
+        cmVarInternals(paVarInternals), mBasicFBVarsData(nullptr), mBasicFBVarsDataSize(0), mInternals(nullptr) {
 }
 
 bool CBasicFB::initialize() {
@@ -29,8 +29,8 @@ bool CBasicFB::initialize() {
     return false;
   }
   if((nullptr != cmVarInternals) && (cmVarInternals->mNumIntVars)) {
-    size_t basicVarsDataSize = calculateBasicFBVarsDataSize(*cmVarInternals);
-    mBasicFBVarsData = basicVarsDataSize ? operator new(basicVarsDataSize) : nullptr;
+    mBasicFBVarsDataSize = calculateBasicFBVarsDataSize(*cmVarInternals);
+    mBasicFBVarsData = mBasicFBVarsDataSize ? allocateFBData(mBasicFBVarsDataSize) : nullptr;
 
     auto *basicVarsData = reinterpret_cast<TForteByte *>(mBasicFBVarsData);
     mInternals = reinterpret_cast<CIEC_ANY**>(basicVarsData);
@@ -51,7 +51,7 @@ CBasicFB::~CBasicFB() {
       }
     }
   }
-  operator delete(mBasicFBVarsData);
+  freeFBData(mBasicFBVarsData, mBasicFBVarsDataSize);
   mBasicFBVarsData = nullptr;
 }
 
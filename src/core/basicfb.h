@@ -95,6 +95,7 @@ class CBasicFB : public CFunctionBlock {
     static size_t calculateBasicFBVarsDataSize(const SInternalVarsInformation &paVarInternals);
 
     void *mBasicFBVarsData;
+    size_t mBasicFBVarsDataSize; //!< Size of mBasicFBVarsData, kept as the internal variables may be gone at destruction
   private:
     /*!\brief Get the pointer to a internal variable of the basic FB.
      *
@@ -31,23 +31,39 @@ using namespace forte::com_infra;
 
 const char * const CBaseCommFB::scmResponseTexts[] = { "OK", "INVALID_ID", "TERMINATED", "INVALID_OBJECT", "DATA_TYPE_ERROR", "INHIBITED", "NO_SOCKET", "SEND_FAILED", "RECV_FAILED" };
 
+namespace {
+  CBaseCommFB::TComStatusString createStatusString(const char *paText) {
+    CBaseCommFB::TComStatusString status;
+    status.assign(paText, static_cast<TForteUInt16>(strlen(paText)));
+    return status;
+  }
+}
+
+const CBaseCommFB::TComStatusString CBaseCommFB::scmResponseStatus[] = {
+    createStatusString(scmResponseTexts[e_Ok]), createStatusString(scmResponseTexts[e_InvalidId]),
+    createStatusString(scmResponseTexts[e_Terminated]), createStatusString(scmResponseTexts[e_InvalidObject]),
+    createStatusString(scmResponseTexts[e_DataTypeError]), createStatusString(scmResponseTexts[e_Inhibited]),
+    createStatusString(scmResponseTexts[e_NoSocket]), createStatusString(scmResponseTexts[e_SendFailed]),
+    createStatusString(scmResponseTexts[e_RecvFailed]) };
+
 CBaseCommFB::CBaseCommFB(const CStringDictionary::TStringId paInstanceNameId, forte::core::CFBContainer &paContainer, forte::com_infra::EComServiceType paCommServiceType) :
-    CGenFunctionBlock<CEventSourceFB>(paContainer, paInstanceNameId), mCommServiceType(paCommServiceType), mTopOfComStack(nullptr) {
-  memset(mInterruptQueue, 0, sizeof(mInterruptQueue)); //TODO change this to  mInterruptQueue{0} in the extended list when fully switching to C++11
+    CGenFunctionBlock<CEventSourceFB>(paContainer, paInstanceNameId), mCommServiceType(paCommServiceType), mTopOfComStack(nullptr), mSendingECET(nullptr),
+    mPendingInterrupts(0), mInterruptHighWaterMark(0), mDroppedInterrupts(0) {
   setEventChainExecutor(getResource()->getResourceEventExecution());
-  mComInterruptQueueCount = 0;
 }
 
 CBaseCommFB::~CBaseCommFB() {
   closeConnection();
 
-  if(nullptr != mInterfaceSpec) {
-    //Free the memory allocated for the interface, only do this if we dynamically created it (i.e., getManagesFBData is true)
-    delete[](mInterfaceSpec->mDINames);
-    delete[](mInterfaceSpec->mDIDataTypeNames);
-    delete[](mInterfaceSpec->mDONames);
-    delete[](mInterfaceSpec->mDODataTypeNames);
-  }
+  //Free the memory allocated for the interface, this is empty if the instance uses a cached interface spec
+  CBaseCommFB::freeGenInterfaceSpec();
+}
+
+void CBaseCommFB::freeGenInterfaceSpec() {
+  delete[](getGenInterfaceSpec().mDINames);
+  delete[](getGenInterfaceSpec().mDIDataTypeNames);
+  delete[](getGenInterfaceSpec().mDONames);
+  delete[](getGenInterfaceSpec().mDODataTypeNames);
 }
 
 EMGMResponse CBaseCommFB::changeFBExecutionState(EMGMCommandType paCommand) {
@@ -129,16 +145,59 @@ void CBaseCommFB::closeConnection() {
     mTopOfComStack->closeConnection();
     delete mTopOfComStack; // this will close the whole communication stack
     mTopOfComStack = nullptr;
+    //the queued interrupts refer to the deleted layers, interrupts arriving meanwhile must not keep us here
+    for(size_t i = getNumPendingInterrupts(); 0 < i && nullptr != popInterrupt(); --i) {
+    }
   }
 }
 
-void CBaseCommFB::interruptCommFB(CComLayer *paComLayer) {
-  if (cgCommunicationInterruptQueueSize > mComInterruptQueueCount) {
-    mInterruptQueue[mComInterruptQueueCount] = paComLayer;
-    mComInterruptQueueCount++;
+bool CBaseCommFB::interruptCommFB(CComLayer *paComLayer) {
+  //count before pushing, so that popping the new entry can not take the counter below zero
+  size_t pending = mPendingInterrupts.fetch_add(1, std::memory_order_acq_rel) + 1;
+  if (mInterruptQueue.push(paComLayer)) {
+    size_t highWaterMark = mInterruptHighWaterMark.load(std::memory_order_relaxed);
+    while(pending > highWaterMark && !mInterruptHighWaterMark.compare_exchange_weak(highWaterMark, pending, std::memory_order_relaxed)) {
+    }
+    return true;
   }
-  else {
-    //TODO to many interrupts received issue error msg
+  mPendingInterrupts.fetch_sub(1, std::memory_order_acq_rel);
+  //only the first loss is logged to keep the log lock off the network threads
+  if (0 == mDroppedInterrupts.fetch_add(1, std::memory_order_relaxed)) {
+    DEVLOG_ERROR("[CBaseCommFB] Interrupt queue of %s is full, received data dropped!\n", getInstanceName());
+  }
+  return false;
+}
+
+CComLayer *CBaseCommFB::popInterrupt() {
+  CComLayer *layer;
+  if (mInterruptQueue.pop(layer)) {
+    mPendingInterrupts.fetch_sub(1, std::memory_order_acq_rel);
+    return layer;
+  }
+  return nullptr;
+}
+
+SComInterruptStatistics CBaseCommFB::getInterruptStatistics() const {
+  SComInterruptStatistics statistics;
+  statistics.mQueueSize = scmInterruptQueueSize;
+  statistics.mHighWaterMark = mInterruptHighWaterMark.load(std::memory_order_relaxed);
+  statistics.mDroppedInterrupts = mDroppedInterrupts.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+void CBaseCommFB::resetInterruptStatistics() {
+  mInterruptHighWaterMark.store(0, std::memory_order_relaxed);
+  mDroppedInterrupts.store(0, std::memory_order_relaxed);
+}
+
+void CBaseCommFB::setResponseStatus(EComResponse paResp) {
+  const TComStatusString &status = scmResponseStatus[paResp & 0xF];
+  if(STATUS() != status) {
+    STATUS() = status;
+  }
+  const bool qo = !(paResp & scg_unComNegative);
+  if(qo != static_cast<bool>(QO())) {
+    QO() = CIEC_BOOL(qo);
   }
 }
 
@@ -24,10 +24,20 @@
 #include "../genfb.h"
 #include "../esfb.h"
 #include "forte_sync.h"
+#include "../utils/mpscringbuf.h"
+#include <atomic>
 
 namespace forte {
   namespace com_infra {
 
+    /*!\brief Fill level and overflow counter of the interrupt queue of a communication FB
+     */
+    struct SComInterruptStatistics {
+      size_t mQueueSize; //!< number of interrupts the queue can hold
+      size_t mHighWaterMark; //!< maximum number of interrupts pending at once
+      TForteUInt32 mDroppedInterrupts; //!< interrupts lost because the queue was full
+    };
+
     class CComLayer;
 
     class CBaseCommFB : public CGenFunctionBlock<CEventSourceFB> {
@@ -56,13 +66,39 @@ namespace forte {
         return mDOs + 2;
       }
 
-      void interruptCommFB(CComLayer *paComLayer);
+      /*!\brief Queue paComLayer for processing its received data with the next external event of this FB
+       *
+       * Can be called concurrently from several threads. Only the first lost interrupt is logged, all are counted.
+       *
+       * \return false if the interrupt queue is full and the interrupt has been dropped
+       */
+      bool interruptCommFB(CComLayer *paComLayer);
+
+      /*!\brief Get the fill level and overflow counter of the interrupt queue
+       *
+       * Can be called from any thread, the values are read without locking.
+       */
+      SComInterruptStatistics getInterruptStatistics() const;
+
+      const CBaseCommFB *asCommFB() const override {
+        return this;
+      }
+
+      //! Top layer of the communication stack, nullptr if the FB is not initialized
+      const CComLayer *getTopOfComStack() const {
+        return mTopOfComStack;
+      }
+
+      //! Reset the high water mark and the overflow counter of the interrupt queue
+      void resetInterruptStatistics();
 
       CIEC_BOOL& QI() {
         return *static_cast<CIEC_BOOL*>(getDI(0));
       }
 
 #ifdef FORTE_USE_WSTRING_DATATYPE
+      typedef CIEC_WSTRING TComStatusString;
+
       CIEC_WSTRING& ID() {
         return *static_cast<CIEC_WSTRING*>(getDI(1));
       }
@@ -72,6 +108,8 @@ namespace forte {
       }
 #else
       //TODO after fixing discussion on the new compliance profile fix these values to STRING
+      typedef CIEC_STRING TComStatusString;
+
       CIEC_STRING& ID() {
         return *static_cast<CIEC_STRING*>(getDI(1));
       }
@@ -89,6 +127,14 @@ namespace forte {
         return mFBLock;
       }
 
+      /*!\brief ECET executing the current send request
+       *
+       * Only set while a send request is passed down the communication stack, nullptr otherwise.
+       */
+      CEventChainExecutionThread *getSendingECET() const {
+        return mSendingECET;
+      }
+
     protected:
       CBaseCommFB(const CStringDictionary::TStringId paInstanceNameId, forte::core::CFBContainer &paContainer, forte::com_infra::EComServiceType paCommServiceType);
 
@@ -122,8 +168,17 @@ namespace forte {
       */
       void closeConnection();
 
+      /*!\brief Set STATUS and QO to the outcome paResp of a communication request
+       *
+       * Outputs already holding the new value are left untouched, so repeated OK responses only cost a comparison.
+       */
+      void setResponseStatus(EComResponse paResp);
+
       static const char * const scmResponseTexts[];
 
+      //! scmResponseTexts as prebuilt STATUS values, indexed by the lower nibble of EComResponse
+      static const TComStatusString scmResponseStatus[];
+
       /*!\brief Create the whole communication stack and open the connection
       *
       * This function will configure every layer.
@@ -148,14 +203,32 @@ namespace forte {
       */
       virtual char * getDefaultIDString(const char *paID) = 0;
 
+      //! Take the next pending interrupt, only to be called by the ECET of this FB, nullptr if none is pending
+      CComLayer *popInterrupt();
+
+      //! Number of interrupts pending from the network
+      size_t getNumPendingInterrupts() const {
+        return mPendingInterrupts.load(std::memory_order_acquire);
+      }
+
       EComServiceType mCommServiceType;
       CComLayer *mTopOfComStack;
-      unsigned int mComInterruptQueueCount; //!< number of triggers pending from the network
-      CComLayer *mInterruptQueue[cgCommunicationInterruptQueueSize];
+      CEventChainExecutionThread *mSendingECET;
 
     private:
+      //! cgCommunicationInterruptQueueSize rounded up to the next power of two as needed by the ring buffer
+      static constexpr size_t scmInterruptQueueSize = forte::core::util::roundUpToPowerOfTwo(cgCommunicationInterruptQueueSize);
+
+      //! Layers with data to process, filled by the network threads and drained by the ECET
+      forte::core::util::CMPSCRingBuffer<CComLayer *, scmInterruptQueueSize> mInterruptQueue;
+      std::atomic<size_t> mPendingInterrupts;
+      std::atomic<size_t> mInterruptHighWaterMark;
+      std::atomic<TForteUInt32> mDroppedInterrupts;
+
       CSyncObject mFBLock;
 
+      void freeGenInterfaceSpec() override;
+
     public:
       CBaseCommFB(const CBaseCommFB&) = delete;
       CBaseCommFB& operator=(const CBaseCommFB& paOther) = delete;
@@ -35,3 +35,6 @@ EComResponse CComLayer::processInterrupt(){
   return e_Nothing;
 }
 
+void CComLayer::queryStatistics(CIEC_STRING &, const std::string &) const {
+}
+
@@ -19,6 +19,9 @@
 #include "comtypes.h"
 #include "comCallback.h"
 #include "utils/extevhandlerhelper.h"
+#include <string>
+
+class CIEC_STRING;
 
 namespace forte {
   namespace com_infra {
@@ -63,6 +66,15 @@ namespace forte {
          */
         virtual EComResponse processInterrupt();
 
+        /*!\brief Append the statistics of this layer to the response of a QueryStatistics command
+         *
+         * Layers without statistics append nothing.
+         *
+         * @param paValue the response to append to
+         * @param paFBName name of the communication FB as reported in the response
+         */
+        virtual void queryStatistics(CIEC_STRING &paValue, const std::string &paFBName) const;
+
         /*!\brief get the top layer
          */
         CComLayer *getTopLayer() const {
@@ -66,7 +66,9 @@ void CCommFB::executeEvent(TEventID paEIID, CEventChainExecutionThread *const pa
     }
     break;
   case scmSendNotificationEventID:
+    mSendingECET = paECET;
     resp = sendData();
+    mSendingECET = nullptr;
     break;
   case cgExternalEventID:
     resp = receiveData();
@@ -86,8 +88,7 @@ void CCommFB::executeEvent(TEventID paEIID, CEventChainExecutionThread *const pa
   }
 
   if (e_Nothing != resp) {
-    STATUS() = CIEC_WSTRING(scmResponseTexts[resp & 0xF]);
-    QO() = CIEC_BOOL(!(resp & scg_unComNegative));
+    setResponseStatus(resp);
 
     if (scg_unINIT & resp) {
       sendOutputEvent(scmEventINITOID, paECET);
@@ -277,22 +278,19 @@ EComResponse CCommFB::receiveData() {
   EComResponse eResp;
   EComResponse eRetVal = e_Nothing;
 
-  const unsigned int comInterruptQueueCountCopy = mComInterruptQueueCount;
-  for (size_t i = 0; i < comInterruptQueueCountCopy; ++i) {
-    if(mInterruptQueue[i] == nullptr) {
-      DEVLOG_ERROR("Attempt to process nullptr in CommFB::receiveData");
-      eResp = e_Nothing;
-    } else {
-      eResp = mInterruptQueue[i]->processInterrupt();
+  //interrupts arriving while processing come with their own external event
+  const size_t numInterrupts = getNumPendingInterrupts();
+  for (size_t i = 0; i < numInterrupts; ++i) {
+    CComLayer *layer = popInterrupt();
+    if(layer == nullptr) {
+      //the interrupt is counted but still being queued
+      break;
     }
+    eResp = layer->processInterrupt();
     if (eResp > eRetVal) {
       eRetVal = eResp;
     }
   }
-  mComInterruptQueueCount -= comInterruptQueueCountCopy;
-  for (unsigned int i = 0; i < mComInterruptQueueCount; ++i) {
-    mInterruptQueue[i] = mInterruptQueue[i + comInterruptQueueCountCopy];
-  }
 
   return eRetVal;
 }
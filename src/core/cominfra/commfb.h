@@ -64,6 +64,10 @@ namespace forte {
 
         bool createInterfaceSpec(const char* paConfigString, SFBInterfaceSpec& paInterfaceSpec) override;
 
+        bool hasSharedInterfaceSpec() const override {
+          return true;
+        }
+
         void configureDIs(const char* paDIConfigString, SFBInterfaceSpec& paInterfaceSpec) const;
         void configureDOs(const char* paDOConfigString, SFBInterfaceSpec& paInterfaceSpec) const;
     };
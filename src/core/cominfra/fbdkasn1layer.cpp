@@ -19,6 +19,8 @@
 #include "../../arch/timerha.h"
 #include "../../arch/devlog.h"
 #include <fortenew.h>
+#include <algorithm>
+#include <cstdint>
 
 using namespace forte::com_infra;
 
@@ -47,7 +49,7 @@ const std::set<CIEC_ANY::EDataTypeID> CFBDKASN1ComLayer::scmSimpleEncodableDataT
     CIEC_ANY::e_LREAL};
 
 CFBDKASN1ComLayer::CFBDKASN1ComLayer(CComLayer* paUpperLayer, CBaseCommFB * paComFB) :
-  CComLayer(paUpperLayer, paComFB), mStatSerBuf(nullptr), mStatSerBufSize(0), mDeserBuf(nullptr), mDeserBufSize(0), mDeserBufPos(0), mDIPos(0), mDOPos(0){
+  CComLayer(paUpperLayer, paComFB), mSerBuf(nullptr), mSerBufSize(0), mSerSDNum(0), mSerCompiled(false), mDeserBuf(nullptr), mDeserBufSize(0), mDeserBufPos(0), mDIPos(0), mDOPos(0){
 
   if(nullptr != paComFB){
     TPortId sdNum = paComFB->getNumSD();
@@ -56,7 +58,7 @@ CFBDKASN1ComLayer::CFBDKASN1ComLayer(CComLayer* paUpperLayer, CBaseCommFB * paCo
       if(apoSDs[i] != nullptr){
         TForteByte typeSize = csmDataTags[apoSDs[i]->unwrap().getDataTypeID()][1];
         if(typeSize != 255){
-          mStatSerBufSize += typeSize + 1;
+          mSerBufSize += typeSize + 1;
         }
       }
     }
@@ -72,13 +74,15 @@ CFBDKASN1ComLayer::CFBDKASN1ComLayer(CComLayer* paUpperLayer, CBaseCommFB * paCo
       }
     }
 
-    mStatSerBuf = new TForteByte[mStatSerBufSize];
+    //at least the null tag sent by FBs without SDs has to fit
+    mSerBufSize = std::max(mSerBufSize, static_cast<size_t>(1));
+    mSerBuf = new TForteByte[mSerBufSize];
     mDeserBuf = new TForteByte[mDeserBufSize];
   }
 }
 
 CFBDKASN1ComLayer::~CFBDKASN1ComLayer(){
-  delete[] mStatSerBuf;
+  delete[] mSerBuf;
   delete[] mDeserBuf;
 }
 
@@ -91,15 +95,22 @@ void CFBDKASN1ComLayer::closeConnection(){
   //We don't need to do anything specific on closing
 }
 
+void CFBDKASN1ComLayer::resizeSerBuffer(size_t paSize){
+  delete[] mSerBuf;
+  mSerBuf = new TForteByte[paSize];
+  mSerBufSize = paSize;
+}
+
 void CFBDKASN1ComLayer::resizeDeserBuffer(unsigned int pa_size){
-  //FIXME use realloc here
-  TForteByte *newBuf = new TForteByte[pa_size];
-  for(unsigned int i = 0; i < mDeserBufPos; i++){
-    newBuf[i] = mDeserBuf[i];
+  //grow at least by a factor of two so that a message arriving in many fragments does not reallocate for each of them
+  unsigned int newSize = std::max(pa_size, 2 * mDeserBufSize);
+  TForteByte *newBuf = new TForteByte[newSize];
+  if(0 < mDeserBufPos){
+    memcpy(newBuf, mDeserBuf, mDeserBufPos);
   }
   delete[] mDeserBuf;
   mDeserBuf = newBuf;
-  mDeserBufSize = pa_size;
+  mDeserBufSize = newSize;
 }
 
 EComResponse CFBDKASN1ComLayer::sendData(void *paData, unsigned int paSize){
@@ -107,46 +118,263 @@ EComResponse CFBDKASN1ComLayer::sendData(void *paData, unsigned int paSize){
 
   if(mBottomLayer != nullptr){
     const CIEC_ANY **apoSDs = static_cast<const CIEC_ANY **>(paData);
-    size_t unNeededBufferSize = 0;
 
     if(nullptr == apoSDs){
-       return e_ProcessDataDataTypeError;
-     }
-
-    for(size_t i = 0; i < paSize; ++i){
-      unNeededBufferSize += getRequiredSerializationSize(*apoSDs[i]);
-    }
-    TForteByte *paUsedBuffer = nullptr;
-    TForteByte *paDynSerBuffer = nullptr;
-    //FIXME grow buffer instead of allocating every time a new one
-    if(unNeededBufferSize <= mStatSerBufSize){
-      paUsedBuffer = mStatSerBuf;
-    }
-    else{
-       paDynSerBuffer = new TForteByte[unNeededBufferSize];
-       paUsedBuffer = paDynSerBuffer;
+      return e_ProcessDataDataTypeError;
     }
 
-    int ser_size = -1; //stays negative if no Buffer for serialization is provided or error occurs while serialization
-
-    if (nullptr != paUsedBuffer) {
-      ser_size = serializeDataPointArray(paUsedBuffer, unNeededBufferSize, apoSDs, paSize);
+    //serialize straight into the reused buffer, the required size is only determined if the data did not fit
+    int ser_size = serializeSDs(apoSDs, paSize);
+    if(ser_size <= 0){
+      size_t unNeededBufferSize = 0;
+      for(size_t i = 0; i < paSize; ++i){
+        unNeededBufferSize += getRequiredSerializationSize(*apoSDs[i]);
+      }
+      if(unNeededBufferSize > mSerBufSize){
+        resizeSerBuffer(std::max(unNeededBufferSize, 2 * mSerBufSize));
+        ser_size = serializeSDs(apoSDs, paSize);
+      }
     }
 
     if(ser_size > 0){
-      eRetVal = mBottomLayer->sendData(paUsedBuffer, ser_size);
+      eRetVal = mBottomLayer->sendData(mSerBuf, ser_size);
     }
     else{ // serialize failed
       eRetVal = e_ProcessDataDataTypeError;
       DEVLOG_ERROR("CAsn1Layer:: serializeData failed\n");
     }
+  }
+
+  return eRetVal;
+}
+
+int CFBDKASN1ComLayer::serializeSDs(const CIEC_ANY **paSDs, size_t paSDNum){
+  if(!mSerCompiled || !isSerializationValid(paSDs, paSDNum)){
+    compileSerialization(paSDs, paSDNum);
+  }
+  return (mSerCompiled) ? serializeCompiled(mSerBuf, mSerBufSize) : serializeDataPointArray(mSerBuf, mSerBufSize, paSDs, paSDNum);
+}
+
+void CFBDKASN1ComLayer::compileSerialization(const CIEC_ANY **paSDs, size_t paSDNum){
+  //clearing keeps the capacity, recompiling for SDs of the same shape does not allocate
+  mSerSteps.clear();
+  mSerConstants.clear();
+  mSerGuards.clear();
+  mSerSDNum = paSDNum;
+  mSerCompiled = true;
+
+  if(0 == paSDNum){
+    addSerializationConstant(scmNull);
+    return;
+  }
+
+  for(size_t i = 0; i < paSDNum; ++i){
+    if(nullptr == paSDs[i]){
+      //let the generic serialization report the error
+      mSerCompiled = false;
+      return;
+    }
+    const CIEC_ANY &value = paSDs[i]->unwrap();
+    CIEC_ANY::EDataTypeID dataType = value.getDataTypeID();
+    mSerGuards.push_back({paSDs[i], i, &value, dataType,
+      (CIEC_ANY::e_STRUCT == dataType) ? static_cast<const CIEC_STRUCT &>(value).getStructTypeNameID() : CStringDictionary::scmInvalidStringId,
+      0, nullptr});
+    compileDataPoint(value, true);
+  }
+}
 
-    if(nullptr != paDynSerBuffer){
-      delete[] paDynSerBuffer;
+void CFBDKASN1ComLayer::compileDataPoint(const CIEC_ANY &paValue, bool paWithTag){
+  const CIEC_ANY &value = paValue.unwrap();
+  CIEC_ANY::EDataTypeID dataType = value.getDataTypeID();
+
+  if(isSimpleSerializable(dataType)){
+    if(paWithTag){
+      addSerializationConstant(csmDataTags[dataType][0]);
     }
+    addSerializationRun(ESerializationOp::Elementary, value.getConstDataPtr(), static_cast<size_t>(csmDataTags[dataType][1] - 1), dataType);
+    return;
   }
 
-  return eRetVal;
+  switch(dataType){
+    case CIEC_ANY::e_BOOL:
+      if(paWithTag){
+        addSerializationRun(ESerializationOp::Bool, static_cast<const CIEC_BOOL *>(&value), 1, dataType);
+      }
+      else{
+        addSerializationStep(ESerializationOp::Value, value);
+      }
+      break;
+    case CIEC_ANY::e_STRING:
+      if(paWithTag){
+        addSerializationConstant(csmDataTags[dataType][0]);
+      }
+      addSerializationStep(ESerializationOp::String, value);
+      break;
+    case CIEC_ANY::e_ARRAY:
+      compileArray(static_cast<const CIEC_ARRAY &>(value), paWithTag);
+      break;
+    case CIEC_ANY::e_STRUCT: {
+      const CIEC_STRUCT &structValue = static_cast<const CIEC_STRUCT &>(value);
+      if(paWithTag){
+        addSerializationConstant(structValue.getASN1StructType());
+      }
+      for(size_t i = 0; i < structValue.getStructSize(); ++i){
+        const CIEC_ANY &member = *structValue.getMember(i);
+        //BOOL members keep their tag as it carries the value
+        compileDataPoint(member, CIEC_ANY::e_BOOL == member.getDataTypeID());
+      }
+      break;
+    }
+    default:
+      addSerializationStep(paWithTag ? ESerializationOp::DataPoint : ESerializationOp::Value, value);
+      break;
+  }
+}
+
+void CFBDKASN1ComLayer::compileArray(const CIEC_ARRAY &paArray, bool paWithTag){
+  size_t arraySize = paArray.size();
+  if(0 == arraySize){
+    addSerializationStep(paWithTag ? ESerializationOp::DataPoint : ESerializationOp::Value, paArray);
+    return;
+  }
+
+  mSerGuards.push_back({nullptr, 0, &paArray, CIEC_ANY::e_ARRAY, CStringDictionary::scmInvalidStringId, arraySize, &paArray[0]});
+  if(paWithTag){
+    addSerializationConstant(csmDataTags[CIEC_ANY::e_ARRAY][0]);
+  }
+  addSerializationConstant(static_cast<TForteByte>((arraySize >> 8) & 0x00FF));
+  addSerializationConstant(static_cast<TForteByte>(arraySize & 0x00FF));
+
+  //as in serializeArray bool arrays tag every element, all others only have the tag of the first element
+  bool isBoolArray = (CIEC_ANY::e_BOOL == paArray[0].getDataTypeID());
+  if(!isBoolArray){
+    TForteByte elementTag;
+    serializeTag(&elementTag, paArray[0]);
+    addSerializationConstant(elementTag);
+  }
+  for(size_t i = 0; i < arraySize; ++i){
+    compileDataPoint(paArray[static_cast<TForteUInt16>(i)], isBoolArray);
+  }
+}
+
+void CFBDKASN1ComLayer::addSerializationConstant(TForteByte paByte){
+  if(mSerSteps.empty() || ESerializationOp::Bytes != mSerSteps.back().mOp){
+    mSerSteps.push_back({ESerializationOp::Bytes, CIEC_ANY::e_ANY, nullptr, 0, mSerConstants.size(), 0, 0});
+  }
+  mSerConstants.push_back(paByte);
+  ++mSerSteps.back().mSize;
+}
+
+void CFBDKASN1ComLayer::addSerializationRun(ESerializationOp paOp, const void *paData, size_t paSize, CIEC_ANY::EDataTypeID paDataType){
+  if(!mSerSteps.empty()){
+    //values lying equidistant in memory, e.g., the elements of an array, are serialized in one run
+    SSerializationStep &last = mSerSteps.back();
+    if(paOp == last.mOp && paDataType == last.mDataType && paSize == last.mSize){
+      std::ptrdiff_t distance = static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(paData) - reinterpret_cast<std::uintptr_t>(last.mData));
+      if(1 == last.mCount && 0 < distance){
+        last.mStride = distance;
+        ++last.mCount;
+        return;
+      }
+      if(1 < last.mCount && distance == last.mStride * static_cast<std::ptrdiff_t>(last.mCount)){
+        ++last.mCount;
+        return;
+      }
+    }
+  }
+  mSerSteps.push_back({paOp, paDataType, paData, paSize, 0, 1, 0});
+}
+
+void CFBDKASN1ComLayer::addSerializationStep(ESerializationOp paOp, const CIEC_ANY &paValue){
+  mSerSteps.push_back({paOp, paValue.getDataTypeID(), &paValue, 0, 0, 1, 0});
+}
+
+bool CFBDKASN1ComLayer::isSerializationValid(const CIEC_ANY **paSDs, size_t paSDNum) const {
+  if(paSDNum != mSerSDNum){
+    return false;
+  }
+  for(const SSerializationGuard &guard : mSerGuards){
+    if(nullptr != guard.mSD){
+      if(paSDs[guard.mSDIndex] != guard.mSD){
+        return false;
+      }
+      const CIEC_ANY &value = guard.mSD->unwrap();
+      if(&value != guard.mValue || value.getDataTypeID() != guard.mDataType
+          || (CIEC_ANY::e_STRUCT == guard.mDataType && static_cast<const CIEC_STRUCT &>(value).getStructTypeNameID() != guard.mStructTypeName)){
+        return false;
+      }
+    }
+    else{
+      const CIEC_ARRAY &array = static_cast<const CIEC_ARRAY &>(*guard.mValue);
+      if(array.size() != guard.mArraySize || &array[0] != guard.mFirstElement){
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int CFBDKASN1ComLayer::serializeCompiled(TForteByte *paBytes, size_t paStreamSize) const {
+  if(paStreamSize > static_cast<size_t>(std::numeric_limits<int>::max())){
+    DEVLOG_ERROR("FBDK ASN1 Layer: paStreamSize too big!\n");
+    return -1;
+  }
+  TForteByte *const start = paBytes;
+  TForteByte *const end = paBytes + paStreamSize;
+
+  for(const SSerializationStep &step : mSerSteps){
+    size_t remaining = static_cast<size_t>(end - paBytes);
+    switch(step.mOp){
+      case ESerializationOp::Bytes:
+        if(step.mSize > remaining){
+          return -1;
+        }
+        memcpy(paBytes, mSerConstants.data() + step.mConstOffset, step.mSize);
+        paBytes += step.mSize;
+        break;
+      case ESerializationOp::Elementary: {
+        if(step.mSize * step.mCount > remaining){
+          return -1;
+        }
+        const TForteByte *data = static_cast<const TForteByte *>(step.mData);
+        for(size_t i = 0; i < step.mCount; ++i, data += step.mStride){
+          serializeElementaryValue(paBytes, data, static_cast<int>(step.mSize), step.mDataType);
+          paBytes += step.mSize;
+        }
+        break;
+      }
+      case ESerializationOp::Bool: {
+        if(step.mCount > remaining){
+          return -1;
+        }
+        const TForteByte *data = static_cast<const TForteByte *>(step.mData);
+        for(size_t i = 0; i < step.mCount; ++i, data += step.mStride){
+          //data of bool is encoded in the tag; if CIEC_BOOL == false => Tag must be e_APPLICATION + e_PRIMITIVE
+          *paBytes++ = (*reinterpret_cast<const CIEC_BOOL *>(data)) ? csmDataTags[CIEC_ANY::e_BOOL][0] : static_cast<TForteByte>(e_APPLICATION + e_PRIMITIVE);
+        }
+        break;
+      }
+      default: {
+        int nBuf = -1;
+        const CIEC_ANY &value = *static_cast<const CIEC_ANY *>(step.mData);
+        if(ESerializationOp::String == step.mOp){
+          nBuf = serializeValueString(paBytes, static_cast<int>(remaining), static_cast<const CIEC_STRING &>(value));
+        }
+        else if(ESerializationOp::DataPoint == step.mOp){
+          nBuf = serializeDataPoint(paBytes, static_cast<int>(remaining), value);
+        }
+        else{
+          nBuf = serializeValue(paBytes, static_cast<int>(remaining), value);
+        }
+        if(nBuf < 0){
+          return -1;
+        }
+        paBytes += nBuf;
+        break;
+      }
+    }
+  }
+  return static_cast<int>(paBytes - start);
 }
 
 EComResponse CFBDKASN1ComLayer::recvData(const void *paData, unsigned int paSize){
@@ -270,8 +498,10 @@ const TForteByte CFBDKASN1ComLayer::csmDataTags[][2] = {
 int CFBDKASN1ComLayer::serializeDataPointArray(TForteByte *paBytes, const size_t paStreamSize, const CIEC_ANY**paData, size_t paDataNum){
   int nRetVal = -1;
   if(0 == paDataNum){
-    serializeNull(paBytes);
-    nRetVal = 1;
+    if(0 < paStreamSize){
+      serializeNull(paBytes);
+      nRetVal = 1;
+    }
   }
   else {
     if (paStreamSize > std::numeric_limits<int>::max()) {
@@ -342,7 +572,7 @@ int CFBDKASN1ComLayer::serializeValue(TForteByte* paBytes, int paStreamSize, con
 
   CIEC_ANY::EDataTypeID eDataType = paCIECData.getDataTypeID();
 
-  if((CIEC_ANY::e_BOOL < eDataType && eDataType <= CIEC_ANY::e_DATE_AND_TIME)||(CIEC_ANY::e_REAL == eDataType)||(CIEC_ANY::e_LREAL == eDataType)){
+  if(isSimpleSerializable(eDataType)){
     //Simple data types except bool can be handled the same way
     nRetVal = serializeValueSimpleDataType(paBytes, paStreamSize, paCIECData);
   }
@@ -394,40 +624,46 @@ int CFBDKASN1ComLayer::serializeValueSimpleDataType(TForteByte* paBytes, int paS
   --nRetVal; //Length of the tag
 
   if(nRetVal <= paStreamSize){
-    const TForteByte* acDataPtr = paDataPoint.getConstDataPtr();
+    serializeElementaryValue(paBytes, paDataPoint.getConstDataPtr(), nRetVal, paDataPoint.getDataTypeID());
+  }
+  else{
+    nRetVal = -1;
+  }
+
+  return nRetVal;
+}
+
+void CFBDKASN1ComLayer::serializeElementaryValue(TForteByte* paBytes, const TForteByte *paDataPtr, int paSize, CIEC_ANY::EDataTypeID paDataType){
+  const TForteByte* acDataPtr = paDataPtr;
 
 #ifdef FORTE_LITTLE_ENDIAN
 # if defined(__ARMEL__) && ! defined(__VFP_FP__) // Little endian ARM with old mixed endian FPA float ABI needs to swap
-        if(CIEC_ANY::e_LREAL == paDataPoint.getDataTypeID()) {
-          TForteUInt32 anSwapped[2];
-          anSwapped[0] = reinterpret_cast<const TForteUInt32 *>(acDataPtr)[1];
-          anSwapped[1] = reinterpret_cast<const TForteUInt32 *>(acDataPtr)[0];
-          acDataPtr = reinterpret_cast<const TForteByte*>(&anSwapped[0]);
-        }
+  TForteUInt32 anSwapped[2];
+  if(CIEC_ANY::e_LREAL == paDataType) {
+    anSwapped[0] = reinterpret_cast<const TForteUInt32 *>(acDataPtr)[1];
+    anSwapped[1] = reinterpret_cast<const TForteUInt32 *>(acDataPtr)[0];
+    acDataPtr = reinterpret_cast<const TForteByte*>(&anSwapped[0]);
+  }
+# else
+  (void) paDataType;
 # endif //defined(__ARMEL__) && ! defined(__VFP_FP__)
-      for(int i = 0; i < nRetVal; i++){
-        paBytes[(nRetVal - 1) - i] = acDataPtr[i];
-      }
+  for(int i = 0; i < paSize; i++){
+    paBytes[(paSize - 1) - i] = acDataPtr[i];
+  }
 #endif //FORTE_LITTLE_ENDIAN
 
 #ifdef FORTE_BIG_ENDIAN
-      if(CIEC_ANY::e_REAL != paDataPoint.getDataTypeID()){
-        for (int i = 0; i < nRetVal; i++){
-          paBytes[(nRetVal - 1) - i] = acDataPtr[(sizeof(CIEC_ANY::TLargestUIntValueType) - 1)-i];
-        }
-      }
-      else{
-        for (unsigned int i = 0; i < nRetVal; i++){
-          paBytes[(nRetVal - 1) - i] = acDataPtr[(sizeof(TForteFloat) - 1) - i];
-        }
-      }
-#endif //FORTE_BIG_ENDIAN
+  if(CIEC_ANY::e_REAL != paDataType){
+    for (int i = 0; i < paSize; i++){
+      paBytes[(paSize - 1) - i] = acDataPtr[(sizeof(CIEC_ANY::TLargestUIntValueType) - 1)-i];
+    }
   }
   else{
-    nRetVal = -1;
+    for (int i = 0; i < paSize; i++){
+      paBytes[(paSize - 1) - i] = acDataPtr[(sizeof(TForteFloat) - 1) - i];
+    }
   }
-
-  return nRetVal;
+#endif //FORTE_BIG_ENDIAN
 }
 
 int CFBDKASN1ComLayer::serializeValueTime(TForteByte* paBytes, int paStreamSize, const CIEC_TIME & paTime){
@@ -483,6 +719,11 @@ int CFBDKASN1ComLayer::serializeArray(TForteByte *paBytes, int paStreamSize, con
   int nRetVal = -1;
   size_t nArraySize = paArray.size();
 
+  //the array length and the element tag are written before any element checks the remaining size
+  if(paStreamSize < ((CIEC_ANY::e_BOOL == paArray[0].getDataTypeID()) ? 2 : 3)){
+    return -1;
+  }
+
   //Number of array elements
   paBytes[0] = (TForteByte) ((nArraySize >> 8) & 0x00FF);
   paBytes[1] = (TForteByte) (nArraySize & 0x00FF);
@@ -896,6 +1137,16 @@ size_t CFBDKASN1ComLayer::getRequiredSerializationSize(const CIEC_ANY &paCIECDat
         unRetVal -= ((CIEC_ARRAY &)paCIECData).size() - 1;
       }
       break;
+    case CIEC_ANY::e_STRUCT: {
+      const CIEC_STRUCT &structVal = static_cast<const CIEC_STRUCT &>(paCIECData);
+      unRetVal += 1; //struct tag
+      for(size_t i = 0; i < structVal.getStructSize(); ++i){
+        const CIEC_ANY &member = *structVal.getMember(i);
+        //only BOOL members keep their tag as it carries the value
+        unRetVal += getRequiredSerializationSize(member) - ((CIEC_ANY::e_BOOL == member.getDataTypeID()) ? 0 : 1);
+      }
+      break;
+    }
 #ifdef FORTE_SUPPORT_CUSTOM_SERIALIZABLE_DATATYPES
     case CIEC_ANY::e_External:
       unRetVal += paCIECData.getRequiredSerializationSize();
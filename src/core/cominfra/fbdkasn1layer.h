@@ -24,7 +24,9 @@
 // serialize includes
 #include "../datatypes/forte_any.h"
 
+#include <cstddef>
 #include <set>
+#include <vector>
 
 class CIEC_TIME;
 class CIEC_STRUCT;
@@ -132,6 +134,52 @@ namespace forte {
 
         static const std::set<CIEC_ANY::EDataTypeID> scmSimpleEncodableDataTypes;
 
+        /*!\brief Instructions of the serialization program compiled for the SDs of the communication FB
+         */
+        enum class ESerializationOp {
+          Bytes, //!< constant bytes like tags and array lengths
+          Elementary, //!< run of elementary values of the same data type
+          Bool, //!< run of BOOL values, the value is encoded in the tag
+          String, //!< STRING value without tag
+          DataPoint, //!< any other data point serialized by serializeDataPoint
+          Value //!< any other value serialized by serializeValue
+        };
+
+        struct SSerializationStep {
+            ESerializationOp mOp;
+            CIEC_ANY::EDataTypeID mDataType;
+            //! Elementary: data of the first value, Bool, String, DataPoint and Value: the first IEC data point
+            const void *mData;
+            //! Bytes: number of constant bytes, Elementary: bytes per value
+            size_t mSize;
+            //! Bytes: offset of the constant bytes in mSerConstants
+            size_t mConstOffset;
+            //! Elementary and Bool: number of values in the run and the distance between them in bytes
+            size_t mCount;
+            std::ptrdiff_t mStride;
+        };
+
+        /*!\brief Condition under which the compiled serialization program is still valid
+         *
+         * SD guards check that an SD still holds the same value (ANY SDs change their value when getting a new data
+         * type), array guards that an array still has the same size and element storage.
+         */
+        struct SSerializationGuard {
+            //! the SD for SD guards, nullptr for array guards
+            const CIEC_ANY *mSD;
+            size_t mSDIndex;
+            //! the unwrapped SD value or the array
+            const CIEC_ANY *mValue;
+            CIEC_ANY::EDataTypeID mDataType;
+            CStringDictionary::TStringId mStructTypeName;
+            size_t mArraySize;
+            const CIEC_ANY *mFirstElement;
+        };
+
+        static bool isSimpleSerializable(CIEC_ANY::EDataTypeID paDataType){
+          return (CIEC_ANY::e_BOOL < paDataType && paDataType <= CIEC_ANY::e_DATE_AND_TIME) || (CIEC_ANY::e_REAL == paDataType) || (CIEC_ANY::e_LREAL == paDataType);
+        }
+
         /*!\brief Serialize the Null tag into a byte array
          *
          * This operation will always take one byte
@@ -157,6 +205,7 @@ namespace forte {
          *  described for static int serializeValue(TForteByte* paBytes, int paStreamSize, const CIEC_ANY* paCIECData)
          * @{*/
         static int serializeValueSimpleDataType(TForteByte* paBytes, int paStreamSize, const CIEC_ANY & paDataPoint);
+        static void serializeElementaryValue(TForteByte* paBytes, const TForteByte *paDataPtr, int paSize, CIEC_ANY::EDataTypeID paDataType);
         static int serializeValueTime(TForteByte* paBytes, int paStreamSize, const CIEC_TIME & paTime);
         static int serializeValueString(TForteByte* paBytes, int paStreamSize, const CIEC_STRING & paString);
 #ifdef FORTE_USE_WSTRING_DATATYPE
@@ -195,11 +244,33 @@ namespace forte {
 
         EComResponse openConnection(char *paLayerParameter) override;
         void closeConnection() override;
+        void resizeSerBuffer(size_t paSize);
+
+        /*!\brief Serialize the SDs with the compiled program, (re)compiling it if the SDs changed since the last send
+         *
+         * @return on success the number of bytes written into mSerBuf, -1 if the buffer is too small or on error.
+         */
+        int serializeSDs(const CIEC_ANY **paSDs, size_t paSDNum);
+        void compileSerialization(const CIEC_ANY **paSDs, size_t paSDNum);
+        void compileDataPoint(const CIEC_ANY &paValue, bool paWithTag);
+        void compileArray(const CIEC_ARRAY &paArray, bool paWithTag);
+        void addSerializationConstant(TForteByte paByte);
+        void addSerializationRun(ESerializationOp paOp, const void *paData, size_t paSize, CIEC_ANY::EDataTypeID paDataType);
+        void addSerializationStep(ESerializationOp paOp, const CIEC_ANY &paValue);
+        bool isSerializationValid(const CIEC_ANY **paSDs, size_t paSDNum) const;
+        int serializeCompiled(TForteByte *paBytes, size_t paStreamSize) const;
         void resizeDeserBuffer(unsigned int pa_size);
 
 
-        TForteByte *mStatSerBuf;
-        TForteUInt32 mStatSerBufSize;
+        //! serialization buffer reused for every send, grows to the largest message sent so far
+        TForteByte *mSerBuf;
+        size_t mSerBufSize;
+
+        std::vector<SSerializationStep> mSerSteps;
+        std::vector<TForteByte> mSerConstants;
+        std::vector<SSerializationGuard> mSerGuards;
+        size_t mSerSDNum;
+        bool mSerCompiled;
 
         TForteByte *mDeserBuf;
         TForteUInt32 mDeserBufSize;
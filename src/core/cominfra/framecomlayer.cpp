@@ -0,0 +1,252 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include "framecomlayer.h"
+#include "../../arch/devlog.h"
+#include "basecommfb.h"
+#include "../device.h"
+#include <string.h>
+#include <algorithm>
+
+using namespace forte::com_infra;
+
+CFrameComLayer::CFrameComLayer(CComLayer* paUpperLayer, CBaseCommFB* paComFB) :
+    CComLayer(paUpperLayer, paComFB), mReassemblyBuffer(nullptr), mFill(0), mSkipBytes(0), mDeliverInPlace(false),
+    mInterruptPending(false), mQueuedFramesPos(0) {
+}
+
+CFrameComLayer::~CFrameComLayer() {
+  delete[] mReassemblyBuffer;
+}
+
+unsigned int CFrameComLayer::encodeLength(TForteUInt32 paLength, TForteByte *paBuffer) {
+  unsigned int size = 0;
+  while(paLength >= 0x80) {
+    paBuffer[size++] = static_cast<TForteByte>(paLength | 0x80);
+    paLength >>= 7;
+  }
+  paBuffer[size++] = static_cast<TForteByte>(paLength);
+  return size;
+}
+
+CFrameComLayer::EDecodeResult CFrameComLayer::decodeLength(const TForteByte *paData, size_t paSize, TForteUInt32 &paLength,
+    unsigned int &paPrefixSize) {
+  TForteUInt32 length = 0;
+  const size_t maxSize = std::min(paSize, static_cast<size_t>(scmMaxLengthPrefixSize));
+  for(unsigned int i = 0; i < maxSize; ++i) {
+    if((scmMaxLengthPrefixSize - 1 == i) && (paData[i] > 0x0F)) {
+      //the fifth byte may only hold the upper four bits of a 32 bit length
+      return EDecodeResult::Invalid;
+    }
+    length |= static_cast<TForteUInt32>(paData[i] & 0x7F) << (7 * i);
+    if(0 == (paData[i] & 0x80)) {
+      paLength = length;
+      paPrefixSize = i + 1;
+      return EDecodeResult::Complete;
+    }
+  }
+  return (paSize < scmMaxLengthPrefixSize) ? EDecodeResult::Incomplete : EDecodeResult::Invalid;
+}
+
+EComResponse CFrameComLayer::sendData(void *paData, unsigned int paSize) {
+  if(nullptr == mBottomLayer) {
+    return e_ProcessDataSendFailed;
+  }
+  mSendBuffer.resize(scmMaxLengthPrefixSize + paSize);
+  const unsigned int prefixSize = encodeLength(paSize, mSendBuffer.data());
+  memcpy(mSendBuffer.data() + prefixSize, paData, paSize);
+  return mBottomLayer->sendData(mSendBuffer.data(), prefixSize + paSize);
+}
+
+EComResponse CFrameComLayer::recvData(const void *paData, unsigned int paSize) {
+  const TForteByte *data = static_cast<const TForteByte *>(paData);
+  size_t remaining = paSize;
+  EComResponse eRetVal = e_Nothing;
+  //frames received while older ones are still queued have to wait for their turn
+  mDeliverInPlace = !hasQueuedFrames();
+
+  while(0 < remaining) {
+    if(0 < mSkipBytes) {
+      const size_t skip = std::min(mSkipBytes, remaining);
+      mSkipBytes -= skip;
+      data += skip;
+      remaining -= skip;
+      continue;
+    }
+
+    EComResponse eResp;
+    if(0 < mFill) {
+      eResp = continueBufferedFrame(data, remaining);
+    } else {
+      TForteUInt32 frameSize;
+      unsigned int prefixSize;
+      switch (decodeLength(data, remaining, frameSize, prefixSize)) {
+        case EDecodeResult::Complete:
+          if(frameSize > cgFrameLayerMaxFrameSize) {
+            skipOversizedFrame(frameSize);
+            mSkipBytes += prefixSize;
+            eResp = e_ProcessDataRecvFaild;
+          } else if(prefixSize + frameSize <= remaining) {
+            //the common case: the whole frame is in the received data and handed on without copying
+            eResp = deliverFrame(data + prefixSize, frameSize);
+            data += prefixSize + frameSize;
+            remaining -= prefixSize + frameSize;
+          } else {
+            eResp = continueBufferedFrame(data, remaining);
+          }
+          break;
+        case EDecodeResult::Incomplete:
+          eResp = continueBufferedFrame(data, remaining);
+          break;
+        case EDecodeResult::Invalid:
+        default:
+          DEVLOG_ERROR("[CFrameComLayer] Invalid length prefix, discarding the received data\n");
+          resetStream();
+          remaining = 0;
+          eResp = e_ProcessDataRecvFaild;
+          break;
+      }
+    }
+    if(eResp > eRetVal) {
+      eRetVal = eResp;
+    }
+  }
+  if(hasQueuedFrames()) {
+    requestInterrupt();
+  }
+  return eRetVal;
+}
+
+EComResponse CFrameComLayer::processInterrupt() {
+  mInterruptPending = false;
+  if(!hasQueuedFrames()) {
+    return e_Nothing;
+  }
+  TForteUInt32 frameSize = 0;
+  unsigned int prefixSize = 0;
+  decodeLength(mQueuedFrames.data() + mQueuedFramesPos, mQueuedFrames.size() - mQueuedFramesPos, frameSize, prefixSize);
+  const TForteByte *frame = mQueuedFrames.data() + mQueuedFramesPos + prefixSize;
+  mQueuedFramesPos += prefixSize + frameSize;
+  EComResponse eRetVal = (nullptr != mTopLayer) ? mTopLayer->recvData(frame, frameSize) : e_Nothing;
+  if(hasQueuedFrames()) {
+    //each frame gets its own IND or CNF
+    requestInterrupt();
+  } else {
+    mQueuedFrames.clear();
+    mQueuedFramesPos = 0;
+  }
+  return eRetVal;
+}
+
+EComResponse CFrameComLayer::continueBufferedFrame(const TForteByte *&paData, size_t &paSize) {
+  if(nullptr == mReassemblyBuffer) {
+    mReassemblyBuffer = new TForteByte[scmMaxLengthPrefixSize + cgFrameLayerMaxFrameSize];
+  }
+
+  TForteUInt32 frameSize;
+  unsigned int prefixSize;
+  EDecodeResult result = decodeLength(mReassemblyBuffer, mFill, frameSize, prefixSize);
+  //complete the length prefix byte by byte, so that no byte of the next frame is taken
+  while((EDecodeResult::Incomplete == result) && (0 < paSize)) {
+    mReassemblyBuffer[mFill++] = *paData++;
+    --paSize;
+    result = decodeLength(mReassemblyBuffer, mFill, frameSize, prefixSize);
+  }
+
+  switch (result) {
+    case EDecodeResult::Incomplete:
+      return e_Nothing;
+    case EDecodeResult::Invalid:
+      DEVLOG_ERROR("[CFrameComLayer] Invalid length prefix, discarding the received data\n");
+      resetStream();
+      paData += paSize;
+      paSize = 0;
+      return e_ProcessDataRecvFaild;
+    case EDecodeResult::Complete:
+    default:
+      break;
+  }
+
+  if(frameSize > cgFrameLayerMaxFrameSize) {
+    skipOversizedFrame(frameSize);
+    mSkipBytes -= mFill - prefixSize;
+    mFill = 0;
+    return e_ProcessDataRecvFaild;
+  }
+
+  const size_t missing = std::min(prefixSize + frameSize - mFill, paSize);
+  memcpy(mReassemblyBuffer + mFill, paData, missing);
+  mFill += missing;
+  paData += missing;
+  paSize -= missing;
+  if(mFill < prefixSize + frameSize) {
+    return e_Nothing;
+  }
+  mFill = 0;
+  return deliverFrame(mReassemblyBuffer + prefixSize, frameSize);
+}
+
+EComResponse CFrameComLayer::deliverFrame(const TForteByte *paFrame, TForteUInt32 paSize) {
+  if(!mDeliverInPlace) {
+    queueFrame(paFrame, paSize);
+    return e_Nothing;
+  }
+  mDeliverInPlace = false;
+  return (nullptr != mTopLayer) ? mTopLayer->recvData(paFrame, paSize) : e_Nothing;
+}
+
+void CFrameComLayer::queueFrame(const TForteByte *paFrame, TForteUInt32 paSize) {
+  if(0 < mQueuedFramesPos) {
+    //drop the frames already handed on, so the queue does not grow while it is never drained completely
+    mQueuedFrames.erase(mQueuedFrames.begin(), mQueuedFrames.begin() + static_cast<std::ptrdiff_t>(mQueuedFramesPos));
+    mQueuedFramesPos = 0;
+  }
+  TForteByte prefix[scmMaxLengthPrefixSize];
+  const unsigned int prefixSize = encodeLength(paSize, prefix);
+  mQueuedFrames.insert(mQueuedFrames.end(), prefix, prefix + prefixSize);
+  mQueuedFrames.insert(mQueuedFrames.end(), paFrame, paFrame + paSize);
+}
+
+void CFrameComLayer::requestInterrupt() {
+  if(mInterruptPending || (nullptr == mFb)) {
+    return;
+  }
+  if(mFb->interruptCommFB(this)) {
+    mInterruptPending = true;
+    mFb->getDevice()->getDeviceExecution().startNewEventChain(mFb);
+  }
+}
+
+void CFrameComLayer::skipOversizedFrame(TForteUInt32 paFrameSize) {
+  DEVLOG_ERROR("[CFrameComLayer] Frame of %u bytes exceeds the maximum frame size of %u bytes, skipped\n", paFrameSize,
+      cgFrameLayerMaxFrameSize);
+  mSkipBytes = paFrameSize;
+}
+
+void CFrameComLayer::resetStream() {
+  mFill = 0;
+  mSkipBytes = 0;
+}
+
+void CFrameComLayer::clearQueuedFrames() {
+  mQueuedFrames.clear();
+  mQueuedFramesPos = 0;
+  mInterruptPending = false;
+}
+
+EComResponse CFrameComLayer::openConnection(char *) {
+  resetStream();
+  clearQueuedFrames();
+  return e_InitOk;
+}
+
+void CFrameComLayer::closeConnection() {
+  resetStream();
+  clearQueuedFrames();
+}
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#ifndef FRAMECOMLAYER_H_
+#define FRAMECOMLAYER_H_
+
+#include <forte_config.h>
+#include "comlayer.h"
+#include <vector>
+
+namespace forte {
+  namespace com_infra {
+
+    /*!\brief Length prefix framing for stream connections, e.g., raw[].frame[].ip[host:port]
+     *
+     * Each message is preceded by its length as unsigned LEB128 varint, so the upper layer always gets whole messages
+     * regardless of how the stream has been cut. Frames completely contained in the data of the bottom layer are handed
+     * on in place. Only the start of a frame that continues in the next data is copied into the reassembly buffer of
+     * cgFrameLayerMaxFrameSize bytes, where it is completed and handed on. Frames exceeding this size are skipped and
+     * reported as RECV_FAILED.
+     *
+     * The FB sends one IND or CNF per received data of its layers. Therefore only the first frame of the received data is
+     * handed on in place. Further frames are copied into a queue and handed on one per interrupt of the FB, which the
+     * layer requests again until the queue is drained.
+     */
+    class CFrameComLayer : public CComLayer {
+      public:
+        CFrameComLayer(CComLayer* paUpperLayer, CBaseCommFB* paComFB);
+        ~CFrameComLayer() override;
+
+        EComResponse sendData(void *paData, unsigned int paSize) override;
+        EComResponse recvData(const void *paData, unsigned int paSize) override;
+
+        //! Hand the oldest queued frame to the upper layer
+        EComResponse processInterrupt() override;
+
+        //! Maximum size of the length prefix, enough for 32 bit lengths
+        static const unsigned int scmMaxLengthPrefixSize = 5;
+
+        /*!\brief Encode paLength as length prefix
+         *
+         * \return number of bytes written to paBuffer, which has to hold scmMaxLengthPrefixSize bytes
+         */
+        static unsigned int encodeLength(TForteUInt32 paLength, TForteByte *paBuffer);
+
+      private:
+        enum class EDecodeResult {
+          Complete,
+          Incomplete, //!< more bytes are needed for the length prefix
+          Invalid //!< the prefix is longer than scmMaxLengthPrefixSize or overflows 32 bit
+        };
+
+        static EDecodeResult decodeLength(const TForteByte *paData, size_t paSize, TForteUInt32 &paLength, unsigned int &paPrefixSize);
+
+        EComResponse openConnection(char *paLayerParameter) override;
+        void closeConnection() override;
+
+        //! Append data to the frame in the reassembly buffer and hand it on once complete
+        EComResponse continueBufferedFrame(const TForteByte *&paData, size_t &paSize);
+        //! Hand on the frame in place if it is the first one of the received data, queue it otherwise
+        EComResponse deliverFrame(const TForteByte *paFrame, TForteUInt32 paSize);
+        void queueFrame(const TForteByte *paFrame, TForteUInt32 paSize);
+        bool hasQueuedFrames() const {
+          return mQueuedFramesPos < mQueuedFrames.size();
+        }
+        void requestInterrupt();
+        void clearQueuedFrames();
+        void skipOversizedFrame(TForteUInt32 paFrameSize);
+        //! Drop the partial frame, e.g., to get in sync again after an invalid length prefix
+        void resetStream();
+
+        TForteByte *mReassemblyBuffer; //!< allocated when a frame has to be reassembled the first time
+        size_t mFill;
+        size_t mSkipBytes; //!< bytes of an oversized frame still to come
+        bool mDeliverInPlace; //!< no frame has been handed on for the data being received yet
+        bool mInterruptPending; //!< the FB has been interrupted and will take the next queued frame
+        std::vector<TForteByte> mQueuedFrames; //!< frames still to be handed on, each preceded by its length prefix
+        size_t mQueuedFramesPos; //!< start of the oldest queued frame
+        std::vector<TForteByte> mSendBuffer;
+    };
+
+  }
+}
+
+#endif /* FRAMECOMLAYER_H_ */
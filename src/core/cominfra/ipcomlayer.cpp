@@ -18,21 +18,55 @@
 #include "ipcomlayer.h"
 #include "../../arch/devlog.h"
 #include "commfb.h"
+#include "../device.h"
 #include <forte_thread.h>
+#include <algorithm>
 
 using namespace forte::com_infra;
 
+namespace {
+  //! negative INIT responses report the end of the connection and must not be masked by data responses
+  bool isTerminalResponse(EComResponse paResponse){
+    return e_InitNegative == (paResponse & e_InitNegative);
+  }
+
+  //! the response of an interrupt which handled several messages, terminal responses take precedence
+  EComResponse combineResponses(EComResponse paCurrent, EComResponse paNew){
+    if(isTerminalResponse(paCurrent) != isTerminalResponse(paNew)){
+      return isTerminalResponse(paCurrent) ? paCurrent : paNew;
+    }
+    return std::max(paCurrent, paNew);
+  }
+
+  //! names of the EIPRecvQueuePolicy values, in the order of the enum
+  const char * const scmRecvQueuePolicyNames[] = { "DropOldest", "DropNewest", "CloseConnection" };
+}
+
 CIPComLayer::CIPComLayer(CComLayer* paUpperLayer, CBaseCommFB* paComFB) :
         CComLayer(paUpperLayer, paComFB),
         mSocketID(CIPComSocketHandler::scmInvalidSocketDescriptor),
         mListeningID(CIPComSocketHandler::scmInvalidSocketDescriptor),
         mInterruptResp(e_Nothing),
-        mBufFillSize(0){
-  memset(mRecvBuffer, 0, sizeof(mRecvBuffer)); //TODO change this to  mRecvBuffer{0} in the extended list when fully switching to C++11
+        mRecvQueue(nullptr),
+        mRecvQueueHead(0),
+        mRecvQueueCount(0),
+        mInterruptPending(false),
+        mReadingPaused(false),
+        mRecvQueuePolicy(EIPRecvQueuePolicy::FORTE_IP_LAYER_RECV_QUEUE_POLICY),
+        mRecvQueueHighWaterMark(0),
+        mDroppedMessages(0),
+        mClosedConnections(0)
+#ifdef FORTE_COM_IP_UDP_SEND_COALESCING
+        , mFlushingECET(nullptr)
+#endif
+        {
+  memset(mRecvSizes, 0, sizeof(mRecvSizes));
   memset(&mDestAddr, 0, sizeof(mDestAddr));
 }
 
-CIPComLayer::~CIPComLayer() = default;
+CIPComLayer::~CIPComLayer(){
+  delete[] mRecvQueue;
+}
 
 EComResponse CIPComLayer::sendData(void *paData, unsigned int paSize){
   EComResponse eRetVal = e_ProcessDataOk;
@@ -54,10 +88,14 @@ EComResponse CIPComLayer::sendData(void *paData, unsigned int paSize){
         }
         break;
       case e_Publisher:
+#ifdef FORTE_COM_IP_UDP_SEND_COALESCING
+        eRetVal = queueDatagram(static_cast<const char*>(paData), paSize);
+#else
         if(0
             >= CIPComSocketHandler::sendDataOnUDP(mSocketID, &mDestAddr, static_cast<char*>(paData), paSize)){
           eRetVal = e_InitTerminated;
         }
+#endif
         break;
       case e_Subscriber:
         //do nothing as subscribers do not send data
@@ -68,27 +106,34 @@ EComResponse CIPComLayer::sendData(void *paData, unsigned int paSize){
 }
 
 EComResponse CIPComLayer::processInterrupt(){
-  if(e_ProcessDataOk == mInterruptResp){
-    switch (mConnectionState){
-      case e_Connected:
-        if((0 < mBufFillSize) && (nullptr != mTopLayer)){
-          CCriticalRegion criticalRegion(mFb->getFBLock());
-          mInterruptResp = mTopLayer->recvData(mRecvBuffer, mBufFillSize);
-          mBufFillSize = 0;
-        }
-        break;
-      case e_Disconnected:
-        case e_Listening:
-        case e_ConnectedAndListening:
-        default:
-        break;
+  CCriticalRegion criticalRegion(mFb->getFBLock());
+  mInterruptPending = false;
+  EComResponse eRetVal = e_Nothing;
+  if(0 < mRecvQueueCount){
+    if((0 < mRecvSizes[mRecvQueueHead]) && (nullptr != mTopLayer)){
+      eRetVal = mTopLayer->recvData(getRecvSlot(mRecvQueueHead), mRecvSizes[mRecvQueueHead]);
     }
+    mRecvQueueHead = (mRecvQueueHead + 1) % cgIPLayerRecvQueueSize;
+    --mRecvQueueCount;
   }
-  return mInterruptResp;
+  if(0 < mRecvQueueCount){
+    //each message gets its own IND or CNF, the state of the connection is reported with the last one
+    restartInterrupt();
+    return eRetVal;
+  }
+  eRetVal = combineResponses(eRetVal, (e_ProcessDataOk == mInterruptResp) ? e_Nothing : mInterruptResp);
+  mInterruptResp = e_Nothing;
+  if(mReadingPaused){
+    mReadingPaused = false;
+    if(CIPComSocketHandler::scmInvalidSocketDescriptor != mSocketID){
+      getExtEvHandler<CIPComSocketHandler>().addComCallback(mSocketID, this);
+    }
+  }
+  return eRetVal;
 }
 
 EComResponse CIPComLayer::recvData(const void *paData, unsigned int){
-  mInterruptResp = e_Nothing;
+  EComResponse eRetVal = e_Nothing;
   switch (mConnectionState){
     case e_Listening:
       //TODO move this to the processInterrupt()
@@ -101,7 +146,7 @@ EComResponse CIPComLayer::recvData(const void *paData, unsigned int){
       break;
     case e_Connected:
       if(mSocketID == *(static_cast<const CIPComSocketHandler::TSocketDescriptor *>(paData))){
-        handledConnectedDataRecv();
+        eRetVal = handledConnectedDataRecv();
       }
       else if(mListeningID
           == *(static_cast<const CIPComSocketHandler::TSocketDescriptor *>(paData))){
@@ -113,11 +158,59 @@ EComResponse CIPComLayer::recvData(const void *paData, unsigned int){
       default:
       break;
   }
-  return mInterruptResp;
+  return eRetVal;
+}
+
+SIPRecvQueueStatistics CIPComLayer::getRecvQueueStatistics() const {
+  CCriticalRegion criticalRegion(mFb->getFBLock());
+  SIPRecvQueueStatistics statistics;
+  statistics.mQueueSize = cgIPLayerRecvQueueSize;
+  statistics.mQueuedMessages = mRecvQueueCount;
+  statistics.mHighWaterMark = mRecvQueueHighWaterMark;
+  statistics.mDroppedMessages = mDroppedMessages;
+  statistics.mClosedConnections = mClosedConnections;
+  return statistics;
+}
+
+void CIPComLayer::queryStatistics(CIEC_STRING &paValue, const std::string &paFBName) const {
+  if(e_Publisher == mFb->getComServiceType()){
+    //publishers do not receive
+    return;
+  }
+  SIPRecvQueueStatistics statistics = getRecvQueueStatistics();
+  paValue.append("\n    <IPRecvQueue FB=\"");
+  paValue.append(paFBName);
+  paValue.append("\" Policy=\"");
+  paValue.append(scmRecvQueuePolicyNames[static_cast<size_t>(mRecvQueuePolicy)]);
+  paValue.append("\" QueueSize=\"");
+  paValue.append(std::to_string(statistics.mQueueSize));
+  paValue.append("\" QueuedMessages=\"");
+  paValue.append(std::to_string(statistics.mQueuedMessages));
+  paValue.append("\" HighWaterMark=\"");
+  paValue.append(std::to_string(statistics.mHighWaterMark));
+  paValue.append("\" DroppedMessages=\"");
+  paValue.append(std::to_string(statistics.mDroppedMessages));
+  paValue.append("\" ClosedConnections=\"");
+  paValue.append(std::to_string(statistics.mClosedConnections));
+  paValue.append("\" />");
 }
 
 EComResponse CIPComLayer::openConnection(char *paLayerParameter){
   EComResponse eRetVal = e_InitInvalidId;
+  mRecvQueuePolicy = EIPRecvQueuePolicy::FORTE_IP_LAYER_RECV_QUEUE_POLICY;
+  char *policyName = strchr(paLayerParameter, ';');
+  if(nullptr != policyName){
+    *policyName = '\0';
+    ++policyName;
+    const char * const *policy = std::find_if(std::begin(scmRecvQueuePolicyNames), std::end(scmRecvQueuePolicyNames),
+        [policyName](const char *paName){ return 0 == strcmp(policyName, paName); });
+    if(std::end(scmRecvQueuePolicyNames) == policy){
+      DEVLOG_ERROR("[CIPComLayer] Unknown receive queue policy %s\n", policyName);
+      return e_InitInvalidId;
+    }
+    mRecvQueuePolicy = static_cast<EIPRecvQueuePolicy>(policy - std::begin(scmRecvQueuePolicyNames));
+  }
+
   const char *acInterface = CIPComSocketHandler::scmAllInterfaces;
   char *interfaceDest = strchr(paLayerParameter, '@');
   if (interfaceDest) {
@@ -158,6 +251,13 @@ EComResponse CIPComLayer::openConnection(char *paLayerParameter){
 
     if(CIPComSocketHandler::scmInvalidSocketDescriptor != nSockDes){
       if(e_Publisher != mFb->getComServiceType()){
+        if(nullptr == mRecvQueue){
+          mRecvQueue = new char[cgIPLayerRecvQueueSize * cgIPLayerRecvBufferSize];
+        }
+        mRecvQueueHead = 0;
+        mRecvQueueCount = 0;
+        mInterruptPending = false;
+        mReadingPaused = false;
         //Publishers should not be registered for receiving data
         getExtEvHandler<CIPComSocketHandler>().addComCallback(nSockDes, this);
       }
@@ -172,6 +272,14 @@ EComResponse CIPComLayer::openConnection(char *paLayerParameter){
 
 void CIPComLayer::closeConnection(){
   DEVLOG_DEBUG("CSocketBaseLayer::closeConnection() \n");
+#ifdef FORTE_COM_IP_UDP_SEND_COALESCING
+  if(nullptr != mFlushingECET){
+    //closing is done by the ECET the flush is registered with or while it is stopped
+    mFlushingECET->cancelFlush(*this);
+    mFlushingECET = nullptr;
+  }
+  sendQueuedDatagrams();
+#endif
   closeSocket(&mSocketID);
   closeSocket(&mListeningID);
 
@@ -186,51 +294,124 @@ void CIPComLayer::closeSocket(CIPComSocketHandler::TSocketDescriptor *paSocketID
   }
 }
 
-void CIPComLayer::handledConnectedDataRecv(){
-  // in case of fragmented packets, it can occur that the buffer is full,
-  // to avoid calling receiveDataFromTCP with a buffer size of 0 wait until buffer is larger 0
-  while((cgIPLayerRecvBufferSize - mBufFillSize) <= 0){
-    CThread::sleepThread(0);
+EComResponse CIPComLayer::handledConnectedDataRecv(){
+  CCriticalRegion criticalRegion(mFb->getFBLock());
+  if(CIPComSocketHandler::scmInvalidSocketDescriptor == mSocketID){
+    return e_Nothing;
   }
-  if(CIPComSocketHandler::scmInvalidSocketDescriptor != mSocketID){
-    CCriticalRegion criticalRegion(mFb->getFBLock());
-    int nRetVal = 0;
-    switch (mFb->getComServiceType()){
-      case e_Server:
-        case e_Client:
-        nRetVal =
-            CIPComSocketHandler::receiveDataFromTCP(mSocketID, &mRecvBuffer[mBufFillSize], cgIPLayerRecvBufferSize
-                - mBufFillSize);
-        break;
-      case e_Publisher:
-        //do nothing as publishers cannot receive data
-        break;
-      case e_Subscriber:
-        nRetVal =
-            CIPComSocketHandler::receiveDataFromUDP(mSocketID, &mRecvBuffer[mBufFillSize], cgIPLayerRecvBufferSize
-                - mBufFillSize);
-        break;
+  if((cgIPLayerRecvQueueSize == mRecvQueueCount) && !handleFullRecvQueue()){
+    //a closed connection still has to be reported to the FB
+    return (CIPComSocketHandler::scmInvalidSocketDescriptor == mSocketID) ? requestInterrupt() : e_Nothing;
+  }
+
+  const unsigned int tail = (mRecvQueueHead + mRecvQueueCount) % cgIPLayerRecvQueueSize;
+  int nRetVal = 0;
+  switch (mFb->getComServiceType()){
+    case e_Server:
+      case e_Client:
+      nRetVal = CIPComSocketHandler::receiveDataFromTCP(mSocketID, getRecvSlot(tail), cgIPLayerRecvBufferSize);
+      if(0 < nRetVal){
+        mRecvSizes[tail] = static_cast<unsigned int>(nRetVal);
+        nRetVal = 1;
+      }
+      break;
+    case e_Publisher:
+      //do nothing as publishers cannot receive data
+      break;
+    case e_Subscriber: {
+      //only the free slots up to the end of the ring can be filled with one call
+      const unsigned int freeSlots = std::min(cgIPLayerRecvQueueSize - mRecvQueueCount, cgIPLayerRecvQueueSize - tail);
+      nRetVal = CIPComSocketHandler::receiveDatagramsFromUDP(mSocketID, getRecvSlot(tail), cgIPLayerRecvBufferSize,
+          &mRecvSizes[tail], std::min(freeSlots, cgIPLayerUDPBatchSize));
+      break;
     }
-    switch (nRetVal){
-      case 0:
-        DEVLOG_INFO("Connection closed by peer\n");
-        mInterruptResp = e_InitTerminated;
-        closeSocket (&mSocketID);
-        if(e_Server == mFb->getComServiceType()){
-          //Move server into listening mode again
-          mConnectionState = e_Listening;
-        }
-        break;
-      case -1:
+  }
+  switch (nRetVal){
+    case 0:
+      DEVLOG_INFO("Connection closed by peer\n");
+      mInterruptResp = e_InitTerminated;
+      closeSocket (&mSocketID);
+      if(e_Server == mFb->getComServiceType()){
+        //Move server into listening mode again
+        mConnectionState = e_Listening;
+      }
+      break;
+    case -1:
+      if((e_ProcessDataOk != mInterruptResp) && !isTerminalResponse(mInterruptResp)){
         mInterruptResp = e_ProcessDataRecvFaild;
-        break;
-      default:
-        //we successfully received data
-        mBufFillSize += nRetVal;
+      }
+      break;
+    default:
+      //we successfully received data
+      mRecvQueueCount += static_cast<unsigned int>(nRetVal);
+      mRecvQueueHighWaterMark = std::max(mRecvQueueHighWaterMark, mRecvQueueCount);
+      if(e_Nothing == mInterruptResp || e_ProcessDataRecvFaild == mInterruptResp){
         mInterruptResp = e_ProcessDataOk;
-        break;
+      }
+      break;
+  }
+  return requestInterrupt();
+}
+
+bool CIPComLayer::handleFullRecvQueue(){
+  if((e_Subscriber != mFb->getComServiceType()) && (EIPRecvQueuePolicy::CloseConnection != mRecvQueuePolicy)){
+    //dropping a part of a TCP stream would corrupt it, leave the flow control to TCP until the queue has been processed
+    mReadingPaused = true;
+    getExtEvHandler<CIPComSocketHandler>().removeComCallback(mSocketID);
+    return false;
+  }
+
+  switch (mRecvQueuePolicy){
+    case EIPRecvQueuePolicy::DropOldest:
+      mRecvQueueHead = (mRecvQueueHead + 1) % cgIPLayerRecvQueueSize;
+      --mRecvQueueCount;
+      countDroppedMessage();
+      return true;
+    case EIPRecvQueuePolicy::DropNewest: {
+      //a datagram is removed from the socket even if it does not fit into the buffer
+      char discard;
+      CIPComSocketHandler::receiveDataFromUDP(mSocketID, &discard, sizeof(discard));
+      countDroppedMessage();
+      return false;
     }
-    mFb->interruptCommFB(this);
+    case EIPRecvQueuePolicy::CloseConnection:
+    default:
+      if(0 == mClosedConnections++){
+        DEVLOG_WARNING("[CIPComLayer] Receive queue full, closing the connection\n");
+      }
+      mInterruptResp = e_InitTerminated;
+      closeSocket(&mSocketID);
+      if(e_Server == mFb->getComServiceType()){
+        mConnectionState = e_Listening;
+      }
+      return false;
+  }
+}
+
+void CIPComLayer::countDroppedMessage(){
+  //only the first loss is logged to keep the log off the network thread's hot path
+  if(0 == mDroppedMessages++){
+    DEVLOG_WARNING("[CIPComLayer] Receive queue full, dropping messages\n");
+  }
+}
+
+EComResponse CIPComLayer::requestInterrupt(){
+  if(mInterruptPending){
+    //the FB will process the queue starting with the interrupt already requested
+    return e_Nothing;
+  }
+  if(!mFb->interruptCommFB(this)){
+    //the messages stay queued, the next received message requests the interrupt again
+    return e_Nothing;
+  }
+  mInterruptPending = true;
+  return mInterruptResp;
+}
+
+void CIPComLayer::restartInterrupt(){
+  if(mFb->interruptCommFB(this)){
+    mInterruptPending = true;
+    mFb->getDevice()->getDeviceExecution().startNewEventChain(mFb);
   }
 }
 
@@ -242,3 +423,48 @@ void CIPComLayer::handleConnectionAttemptInConnected() const {
     CIPComSocketHandler::closeSocket(socketID);
   }
 }
+
+#ifdef FORTE_COM_IP_UDP_SEND_COALESCING
+EComResponse CIPComLayer::queueDatagram(const char *paData, unsigned int paSize){
+  mSendBuffer.insert(mSendBuffer.end(), paData, paData + paSize);
+  mSendSizes.push_back(paSize);
+  if(cgIPLayerUDPBatchSize <= mSendSizes.size()){
+    return sendQueuedDatagrams();
+  }
+  if(nullptr == mFlushingECET){
+    mFlushingECET = mFb->getSendingECET();
+    if(nullptr == mFlushingECET){
+      //not sent from an ECET, e.g., a test driving the layer directly
+      return sendQueuedDatagrams();
+    }
+    mFlushingECET->deferFlush(*this);
+  }
+  return e_ProcessDataOk;
+}
+
+EComResponse CIPComLayer::sendQueuedDatagrams(){
+  EComResponse eRetVal = e_ProcessDataOk;
+  if(!mSendSizes.empty() && (CIPComSocketHandler::scmInvalidSocketDescriptor != mSocketID)){
+    char *datagrams[cgIPLayerUDPBatchSize];
+    char *datagram = mSendBuffer.data();
+    for(size_t i = 0; i < mSendSizes.size(); ++i){
+      datagrams[i] = datagram;
+      datagram += mSendSizes[i];
+    }
+    if(0 >= CIPComSocketHandler::sendDatagramsOnUDP(mSocketID, &mDestAddr, datagrams, mSendSizes.data(),
+        static_cast<unsigned int>(mSendSizes.size()))){
+      eRetVal = e_InitTerminated;
+    }
+  }
+  mSendBuffer.clear();
+  mSendSizes.clear();
+  return eRetVal;
+}
+
+void CIPComLayer::flush(){
+  mFlushingECET = nullptr;
+  if(e_ProcessDataOk != sendQueuedDatagrams()){
+    DEVLOG_ERROR("[CIPComLayer] Sending the coalesced datagrams failed\n");
+  }
+}
+#endif
@@ -17,13 +17,50 @@
 #include <sockhand.h>
 #include <forte_config.h>
 #include "comlayer.h"
+#ifdef FORTE_COM_IP_UDP_SEND_COALESCING
+#include "../ecet.h"
+#include <vector>
+#endif
 
 
 namespace forte {
 
   namespace com_infra {
 
-    class CIPComLayer : public CComLayer{
+    //! Handling of a received message when the receive queue of an ip layer is full
+    enum class EIPRecvQueuePolicy {
+      DropOldest, //!< discard the oldest queued message to make room for the new one
+      DropNewest, //!< discard the received message
+      CloseConnection //!< close the connection and report e_InitTerminated to the communication FB
+    };
+
+    //! Snapshot of the receive queue of an ip layer
+    struct SIPRecvQueueStatistics {
+      unsigned int mQueueSize; //!< capacity of the receive queue in messages
+      unsigned int mQueuedMessages; //!< messages waiting to be processed by the communication FB
+      unsigned int mHighWaterMark; //!< maximum number of queued messages seen
+      TForteUInt32 mDroppedMessages; //!< messages lost because the receive queue was full
+      TForteUInt32 mClosedConnections; //!< connections closed because the receive queue was full
+    };
+
+    /*!\brief Communication layer for TCP client/server and UDP publish/subscribe connections
+     *
+     * Received messages are put into a receive queue of cgIPLayerRecvQueueSize slots, which are allocated once per
+     * layer, and handed on to the upper layer with one interrupt of the communication FB each. The network thread
+     * never waits for the FB: if the queue is full the EIPRecvQueuePolicy decides which message is lost. TCP
+     * connections are never cut into pieces, with a drop policy they stop reading until the FB has processed the
+     * queue and leave the flow control to TCP. The policy is given after the address, e.g., ip[239.0.0.1:61500;DropNewest],
+     * otherwise FORTE_IP_LAYER_RECV_QUEUE_POLICY is used.
+     *
+     * Subscribers fetch up to cgIPLayerUDPBatchSize datagrams per receive call. With FORTE_COM_IP_UDP_SEND_COALESCING
+     * publishers collect the datagrams sent while an ECET processes events and send them in one call when this ECET
+     * has no more events.
+     */
+    class CIPComLayer : public CComLayer
+#ifdef FORTE_COM_IP_UDP_SEND_COALESCING
+        , private CDeferredFlush
+#endif
+    {
       public:
         CIPComLayer(CComLayer* paUpperLayer, CBaseCommFB* paComFB);
         ~CIPComLayer() override;
@@ -33,6 +70,20 @@ namespace forte {
 
         EComResponse processInterrupt() override;
 
+        //! Append the state of the receive queue as IPRecvQueue element
+        void queryStatistics(CIEC_STRING &paValue, const std::string &paFBName) const override;
+
+        void setRecvQueuePolicy(EIPRecvQueuePolicy paPolicy){
+          mRecvQueuePolicy = paPolicy;
+        }
+
+        EIPRecvQueuePolicy getRecvQueuePolicy() const {
+          return mRecvQueuePolicy;
+        }
+
+        //! Get the fill level and overflow counters of the receive queue, can be called from any thread
+        SIPRecvQueueStatistics getRecvQueueStatistics() const;
+
       protected:
         CIPComSocketHandler::TSocketDescriptor mSocketID;
         CIPComSocketHandler::TUDPDestAddr mDestAddr;
@@ -42,13 +93,49 @@ namespace forte {
 
         EComResponse openConnection(char *paLayerParameter) override;
         void closeConnection() override;
-        void handledConnectedDataRecv();
+        EComResponse handledConnectedDataRecv();
         void handleConnectionAttemptInConnected() const;
 
+        /*!\brief Apply the receive queue policy as the queue has no free slot
+         *
+         * \return true if a slot has been freed for the next message
+         */
+        bool handleFullRecvQueue();
+        void countDroppedMessage();
+        EComResponse requestInterrupt();
+        //! Request the interrupt for the next queued message from within processInterrupt()
+        void restartInterrupt();
+
+        char *getRecvSlot(unsigned int paSlot) const {
+          return &mRecvQueue[paSlot * cgIPLayerRecvBufferSize];
+        }
+#ifdef FORTE_COM_IP_UDP_SEND_COALESCING
+        EComResponse queueDatagram(const char *paData, unsigned int paSize);
+        EComResponse sendQueuedDatagrams();
+        void flush() override;
+#endif
+
         CIPComSocketHandler::TSocketDescriptor mListeningID; //!> to be used by server type connections. there the mSocketID will be used for the accepted connection.
         EComResponse mInterruptResp;
-        char mRecvBuffer[cgIPLayerRecvBufferSize];
-        unsigned int mBufFillSize;
+
+        //! ring of cgIPLayerRecvQueueSize slots of cgIPLayerRecvBufferSize bytes each, allocated on the first open
+        char *mRecvQueue;
+        unsigned int mRecvSizes[cgIPLayerRecvQueueSize];
+        unsigned int mRecvQueueHead;
+        unsigned int mRecvQueueCount;
+        bool mInterruptPending; //!< the FB has been interrupted and will process the queue
+        bool mReadingPaused; //!< the socket has been removed from the handler until the queue has been processed
+
+        EIPRecvQueuePolicy mRecvQueuePolicy;
+        unsigned int mRecvQueueHighWaterMark;
+        TForteUInt32 mDroppedMessages;
+        TForteUInt32 mClosedConnections;
+
+#ifdef FORTE_COM_IP_UDP_SEND_COALESCING
+        std::vector<char> mSendBuffer;
+        std::vector<unsigned int> mSendSizes;
+        CEventChainExecutionThread *mFlushingECET; //!< ECET the pending flush is registered with
+#endif
     };
 
   }
@@ -0,0 +1,447 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include "ippipelinedcomlayer.h"
+#include "../../arch/devlog.h"
+#include "basecommfb.h"
+#include "../device.h"
+#include "criticalregion.h"
+#include <algorithm>
+
+using namespace forte::com_infra;
+
+namespace {
+  void writeFrameHeader(char *paBuffer, TForteUInt32 paCorrelationID, TForteUInt16 paSize) {
+    paBuffer[0] = static_cast<char>(paCorrelationID >> 24);
+    paBuffer[1] = static_cast<char>(paCorrelationID >> 16);
+    paBuffer[2] = static_cast<char>(paCorrelationID >> 8);
+    paBuffer[3] = static_cast<char>(paCorrelationID);
+    paBuffer[4] = static_cast<char>(paSize >> 8);
+    paBuffer[5] = static_cast<char>(paSize);
+  }
+
+  TForteUInt32 readCorrelationID(const char *paBuffer) {
+    const unsigned char *header = reinterpret_cast<const unsigned char *>(paBuffer);
+    return (static_cast<TForteUInt32>(header[0]) << 24) | (static_cast<TForteUInt32>(header[1]) << 16) |
+        (static_cast<TForteUInt32>(header[2]) << 8) | static_cast<TForteUInt32>(header[3]);
+  }
+
+  unsigned int readPayloadSize(const char *paBuffer) {
+    const unsigned char *header = reinterpret_cast<const unsigned char *>(paBuffer);
+    return (static_cast<unsigned int>(header[4]) << 8) | static_cast<unsigned int>(header[5]);
+  }
+}
+
+CIPPipelinedComLayer::CIPPipelinedComLayer(CComLayer* paUpperLayer, CBaseCommFB* paComFB) :
+        CComLayer(paUpperLayer, paComFB),
+        mListeningID(CIPComSocketHandler::scmInvalidSocketDescriptor),
+        mInterruptResp(e_Nothing),
+        mInterruptPending(false),
+        mRecvQueue(nullptr),
+        mConnectionBuffers(nullptr),
+        mFrameHead(0),
+        mFrameCount(0),
+        mReplyRouteHead(0),
+        mReplyRouteCount(0),
+        mNumOutstandingRequests(0),
+        mNextCorrelationID(0) {
+  for(SConnection &connection : mConnections){
+    connection.mSocketID = CIPComSocketHandler::scmInvalidSocketDescriptor;
+    connection.mGeneration = 0;
+    connection.mBuffer = nullptr;
+    connection.mFill = 0;
+    connection.mPaused = false;
+  }
+}
+
+CIPPipelinedComLayer::~CIPPipelinedComLayer(){
+  delete[] mRecvQueue;
+  delete[] mConnectionBuffers;
+}
+
+EComResponse CIPPipelinedComLayer::sendData(void *paData, unsigned int paSize){
+  if(paSize > cgIPLayerRecvBufferSize){
+    //the peer could not take the frame
+    return e_ProcessDataSendFailed;
+  }
+  SSendTarget target;
+  EComResponse eRetVal;
+  {
+    CCriticalRegion criticalRegion(mFb->getFBLock());
+    switch (mFb->getComServiceType()){
+      case e_Client:
+        eRetVal = prepareClientRequest(target);
+        break;
+      case e_Server:
+        eRetVal = prepareServerResponse(target);
+        break;
+      default:
+        return e_ProcessDataOk;
+    }
+  }
+  if(e_ProcessDataOk == eRetVal){
+    eRetVal = sendFrame(target, paData, paSize);
+    if((e_ProcessDataOk != eRetVal) && (e_Server == mFb->getComServiceType())){
+      //a lost client only concerns its own requests, the server keeps on serving the others
+      eRetVal = e_ProcessDataOk;
+    }
+  } else if(e_Nothing == eRetVal){
+    eRetVal = e_ProcessDataOk;
+  }
+  return eRetVal;
+}
+
+EComResponse CIPPipelinedComLayer::prepareClientRequest(SSendTarget &paTarget){
+  const SConnection &connection = mConnections[0];
+  if(CIPComSocketHandler::scmInvalidSocketDescriptor == connection.mSocketID){
+    return e_ProcessDataNoSocket;
+  }
+  if(cgIPPipelineWindowSize == mNumOutstandingRequests){
+    return e_ProcessDataSendFailed;
+  }
+  paTarget.mConnection = 0;
+  paTarget.mGeneration = connection.mGeneration;
+  paTarget.mSocketID = connection.mSocketID;
+  paTarget.mCorrelationID = mNextCorrelationID++;
+  //taken before the sending as the response may arrive before the sending thread gets the lock again
+  mOutstandingRequests[mNumOutstandingRequests++] = paTarget.mCorrelationID;
+  return e_ProcessDataOk;
+}
+
+EComResponse CIPPipelinedComLayer::prepareServerResponse(SSendTarget &paTarget){
+  if(0 == mReplyRouteCount){
+    DEVLOG_ERROR("[CIPPipelinedComLayer] Response without a pending request\n");
+    return e_ProcessDataSendFailed;
+  }
+  const SReplyRoute route = mReplyRoutes[mReplyRouteHead];
+  mReplyRouteHead = (mReplyRouteHead + 1) % scmMaxReplyRoutes;
+  --mReplyRouteCount;
+
+  if(!mInterruptPending && canDeliverFrame()){
+    //the queued requests have been held back as the reply routes were exhausted
+    restartInterrupt();
+  }
+
+  const SConnection &connection = mConnections[route.mConnection];
+  if((connection.mGeneration != route.mGeneration) || (CIPComSocketHandler::scmInvalidSocketDescriptor == connection.mSocketID)){
+    DEVLOG_INFO("[CIPPipelinedComLayer] Client closed the connection, response dropped\n");
+    return e_Nothing;
+  }
+  paTarget.mConnection = route.mConnection;
+  paTarget.mGeneration = route.mGeneration;
+  paTarget.mSocketID = connection.mSocketID;
+  paTarget.mCorrelationID = route.mCorrelationID;
+  return e_ProcessDataOk;
+}
+
+EComResponse CIPPipelinedComLayer::sendFrame(const SSendTarget &paTarget, const void *paData, unsigned int paSize){
+  mSendBuffer.resize(scmFrameHeaderSize + paSize);
+  writeFrameHeader(mSendBuffer.data(), paTarget.mCorrelationID, static_cast<TForteUInt16>(paSize));
+  memcpy(mSendBuffer.data() + scmFrameHeaderSize, paData, paSize);
+  if(0 >= CIPComSocketHandler::sendDataOnTCP(paTarget.mSocketID, mSendBuffer.data(),
+      static_cast<unsigned int>(mSendBuffer.size()))){
+    CCriticalRegion criticalRegion(mFb->getFBLock());
+    const SConnection &connection = mConnections[paTarget.mConnection];
+    if((connection.mGeneration == paTarget.mGeneration) && (connection.mSocketID == paTarget.mSocketID)){
+      closeConnectionSlot(paTarget.mConnection);
+    }
+    return e_InitTerminated;
+  }
+  return e_ProcessDataOk;
+}
+
+EComResponse CIPPipelinedComLayer::processInterrupt(){
+  CCriticalRegion criticalRegion(mFb->getFBLock());
+  EComResponse eRetVal = mInterruptResp;
+  mInterruptResp = e_Nothing;
+  if(canDeliverFrame()){
+    EComResponse eResp = deliverFrame();
+    if(eResp > eRetVal){
+      eRetVal = eResp;
+    }
+  }
+  resumePausedConnections();
+
+  mInterruptPending = false;
+  if(canDeliverFrame()){
+    //each request or response gets its own IND or CNF
+    restartInterrupt();
+  }
+  return eRetVal;
+}
+
+EComResponse CIPPipelinedComLayer::recvData(const void *paData, unsigned int){
+  CCriticalRegion criticalRegion(mFb->getFBLock());
+  const CIPComSocketHandler::TSocketDescriptor socketID = *(static_cast<const CIPComSocketHandler::TSocketDescriptor *>(paData));
+  if(socketID == mListeningID){
+    acceptConnection();
+    return e_Nothing;
+  }
+  for(unsigned int i = 0; i < cgIPPipelineMaxConnections; ++i){
+    if(socketID == mConnections[i].mSocketID){
+      readConnection(i);
+      if(canDeliverFrame() || (e_Nothing != mInterruptResp)){
+        return requestInterrupt();
+      }
+      break;
+    }
+  }
+  return e_Nothing;
+}
+
+unsigned int CIPPipelinedComLayer::getNumOutstandingRequests(){
+  CCriticalRegion criticalRegion(mFb->getFBLock());
+  return mNumOutstandingRequests;
+}
+
+unsigned int CIPPipelinedComLayer::getNumConnections(){
+  CCriticalRegion criticalRegion(mFb->getFBLock());
+  unsigned int numConnections = 0;
+  for(const SConnection &connection : mConnections){
+    if(CIPComSocketHandler::scmInvalidSocketDescriptor != connection.mSocketID){
+      ++numConnections;
+    }
+  }
+  return numConnections;
+}
+
+EComResponse CIPPipelinedComLayer::openConnection(char *paLayerParameter){
+  const EComServiceType serviceType = mFb->getComServiceType();
+  if((e_Client != serviceType) && (e_Server != serviceType)){
+    DEVLOG_ERROR("[CIPPipelinedComLayer] Only CLIENT and SERVER FBs can use pipelined connections\n");
+    return e_InitInvalidId;
+  }
+
+  char *acPort = strchr(paLayerParameter, ':');
+  if(nullptr == acPort){
+    return e_InitInvalidId;
+  }
+  *acPort = '\0';
+  ++acPort;
+  TForteUInt16 nPort = static_cast<TForteUInt16>(forte::core::util::strtoul(acPort, nullptr, 10));
+
+  if(nullptr == mRecvQueue){
+    mRecvQueue = new char[cgIPLayerRecvQueueSize * cgIPLayerRecvBufferSize];
+    mConnectionBuffers = new char[cgIPPipelineMaxConnections * (scmFrameHeaderSize + cgIPLayerRecvBufferSize)];
+    for(unsigned int i = 0; i < cgIPPipelineMaxConnections; ++i){
+      mConnections[i].mBuffer = &mConnectionBuffers[i * (scmFrameHeaderSize + cgIPLayerRecvBufferSize)];
+    }
+  }
+  mFrameHead = 0;
+  mFrameCount = 0;
+  mReplyRouteHead = 0;
+  mReplyRouteCount = 0;
+  mNumOutstandingRequests = 0;
+  mInterruptResp = e_Nothing;
+  mInterruptPending = false;
+
+  if(e_Server == serviceType){
+    mListeningID = CIPComSocketHandler::openTCPServerConnection(paLayerParameter, nPort);
+    if(CIPComSocketHandler::scmInvalidSocketDescriptor == mListeningID){
+      return e_InitInvalidId;
+    }
+    getExtEvHandler<CIPComSocketHandler>().addComCallback(mListeningID, this);
+    mConnectionState = e_Listening;
+  } else {
+    SConnection &connection = mConnections[0];
+    connection.mSocketID = CIPComSocketHandler::openTCPClientConnection(paLayerParameter, nPort);
+    if(CIPComSocketHandler::scmInvalidSocketDescriptor == connection.mSocketID){
+      return e_InitInvalidId;
+    }
+    ++connection.mGeneration;
+    connection.mFill = 0;
+    connection.mPaused = false;
+    getExtEvHandler<CIPComSocketHandler>().addComCallback(connection.mSocketID, this);
+    mConnectionState = e_Connected;
+  }
+  return e_InitOk;
+}
+
+void CIPPipelinedComLayer::closeConnection(){
+  CCriticalRegion criticalRegion(mFb->getFBLock());
+  for(unsigned int i = 0; i < cgIPPipelineMaxConnections; ++i){
+    closeConnectionSlot(i);
+  }
+  if(CIPComSocketHandler::scmInvalidSocketDescriptor != mListeningID){
+    getExtEvHandler<CIPComSocketHandler>().removeComCallback(mListeningID);
+    CIPComSocketHandler::closeSocket(mListeningID);
+    mListeningID = CIPComSocketHandler::scmInvalidSocketDescriptor;
+  }
+  mConnectionState = e_Disconnected;
+}
+
+void CIPPipelinedComLayer::acceptConnection(){
+  CIPComSocketHandler::TSocketDescriptor socketID = CIPComSocketHandler::acceptTCPConnection(mListeningID);
+  if(CIPComSocketHandler::scmInvalidSocketDescriptor == socketID){
+    return;
+  }
+  for(SConnection &connection : mConnections){
+    if(CIPComSocketHandler::scmInvalidSocketDescriptor == connection.mSocketID){
+      connection.mSocketID = socketID;
+      ++connection.mGeneration;
+      connection.mFill = 0;
+      connection.mPaused = false;
+      getExtEvHandler<CIPComSocketHandler>().addComCallback(socketID, this);
+      DEVLOG_INFO("[CIPPipelinedComLayer] Connection established by client\n");
+      return;
+    }
+  }
+  //close the connection right away to tell the client that we are not available
+  DEVLOG_WARNING("[CIPPipelinedComLayer] All %u connections in use, client rejected\n", cgIPPipelineMaxConnections);
+  CIPComSocketHandler::closeSocket(socketID);
+}
+
+void CIPPipelinedComLayer::readConnection(unsigned int paConnection){
+  SConnection &connection = mConnections[paConnection];
+  const int nRetVal = CIPComSocketHandler::receiveDataFromTCP(connection.mSocketID, connection.mBuffer + connection.mFill,
+      scmFrameHeaderSize + cgIPLayerRecvBufferSize - connection.mFill);
+  switch (nRetVal){
+    case 0:
+      DEVLOG_INFO("[CIPPipelinedComLayer] Connection closed by peer\n");
+      closeConnectionSlot(paConnection);
+      if(e_Client == mFb->getComServiceType()){
+        mInterruptResp = e_InitTerminated;
+      }
+      break;
+    case -1:
+      if(e_Client == mFb->getComServiceType()){
+        mInterruptResp = e_ProcessDataRecvFaild;
+      }
+      break;
+    default:
+      connection.mFill += static_cast<unsigned int>(nRetVal);
+      if(!queueFrames(paConnection)){
+        connection.mPaused = true;
+        getExtEvHandler<CIPComSocketHandler>().removeComCallback(connection.mSocketID);
+      }
+      break;
+  }
+}
+
+bool CIPPipelinedComLayer::queueFrames(unsigned int paConnection){
+  SConnection &connection = mConnections[paConnection];
+  unsigned int consumed = 0;
+  bool allQueued = true;
+  while(connection.mFill - consumed >= scmFrameHeaderSize){
+    const char *frame = connection.mBuffer + consumed;
+    const unsigned int payloadSize = readPayloadSize(frame);
+    if(payloadSize > cgIPLayerRecvBufferSize){
+      DEVLOG_ERROR("[CIPPipelinedComLayer] Frame of %u bytes exceeds the receive buffer, closing the connection\n", payloadSize);
+      closeConnectionSlot(paConnection);
+      if(e_Client == mFb->getComServiceType()){
+        mInterruptResp = e_InitTerminated;
+      }
+      return true;
+    }
+    if(connection.mFill - consumed < scmFrameHeaderSize + payloadSize){
+      break;
+    }
+    if(cgIPLayerRecvQueueSize == mFrameCount){
+      allQueued = false;
+      break;
+    }
+    const unsigned int tail = (mFrameHead + mFrameCount) % cgIPLayerRecvQueueSize;
+    memcpy(getRecvSlot(tail), frame + scmFrameHeaderSize, payloadSize);
+    mFrames[tail].mConnection = paConnection;
+    mFrames[tail].mGeneration = connection.mGeneration;
+    mFrames[tail].mCorrelationID = readCorrelationID(frame);
+    mFrames[tail].mSize = payloadSize;
+    ++mFrameCount;
+    consumed += scmFrameHeaderSize + payloadSize;
+  }
+  if(0 != consumed){
+    connection.mFill -= consumed;
+    memmove(connection.mBuffer, connection.mBuffer + consumed, connection.mFill);
+  }
+  return allQueued;
+}
+
+void CIPPipelinedComLayer::resumePausedConnections(){
+  for(unsigned int i = 0; i < cgIPPipelineMaxConnections; ++i){
+    SConnection &connection = mConnections[i];
+    if(connection.mPaused && queueFrames(i) && (CIPComSocketHandler::scmInvalidSocketDescriptor != connection.mSocketID)){
+      connection.mPaused = false;
+      getExtEvHandler<CIPComSocketHandler>().addComCallback(connection.mSocketID, this);
+    }
+  }
+}
+
+void CIPPipelinedComLayer::closeConnectionSlot(unsigned int paConnection){
+  SConnection &connection = mConnections[paConnection];
+  if(CIPComSocketHandler::scmInvalidSocketDescriptor != connection.mSocketID){
+    getExtEvHandler<CIPComSocketHandler>().removeComCallback(connection.mSocketID);
+    CIPComSocketHandler::closeSocket(connection.mSocketID);
+    connection.mSocketID = CIPComSocketHandler::scmInvalidSocketDescriptor;
+  }
+  connection.mFill = 0;
+  connection.mPaused = false;
+  if(e_Client == mFb->getComServiceType()){
+    //no responses will come for the outstanding requests
+    mNumOutstandingRequests = 0;
+  }
+}
+
+bool CIPPipelinedComLayer::canDeliverFrame() const {
+  //a server hands on a request only if it can remember where the response has to go
+  return (0 < mFrameCount) && ((e_Server != mFb->getComServiceType()) || (mReplyRouteCount < scmMaxReplyRoutes));
+}
+
+EComResponse CIPPipelinedComLayer::deliverFrame(){
+  const SFrame &frame = mFrames[mFrameHead];
+  EComResponse eRetVal = e_Nothing;
+  if(e_Server == mFb->getComServiceType()){
+    if(nullptr != mTopLayer){
+      eRetVal = mTopLayer->recvData(getRecvSlot(mFrameHead), frame.mSize);
+      //a rejected request (IND-) is never answered, so no route is kept for it
+      if(0 == (eRetVal & scg_unComNegative)){
+        SReplyRoute &route = mReplyRoutes[(mReplyRouteHead + mReplyRouteCount) % scmMaxReplyRoutes];
+        route.mConnection = frame.mConnection;
+        route.mGeneration = frame.mGeneration;
+        route.mCorrelationID = frame.mCorrelationID;
+        ++mReplyRouteCount;
+      }
+    }
+  } else if(takeOutstandingRequest(frame.mCorrelationID) && (nullptr != mTopLayer)){
+    eRetVal = mTopLayer->recvData(getRecvSlot(mFrameHead), frame.mSize);
+  }
+  mFrameHead = (mFrameHead + 1) % cgIPLayerRecvQueueSize;
+  --mFrameCount;
+  return eRetVal;
+}
+
+bool CIPPipelinedComLayer::takeOutstandingRequest(TForteUInt32 paCorrelationID){
+  TForteUInt32 *const end = mOutstandingRequests + mNumOutstandingRequests;
+  TForteUInt32 *const request = std::find(mOutstandingRequests, end, paCorrelationID);
+  if(end == request){
+    DEVLOG_WARNING("[CIPPipelinedComLayer] Response %u does not belong to an outstanding request, dropped\n", paCorrelationID);
+    return false;
+  }
+  std::copy(request + 1, end, request);
+  --mNumOutstandingRequests;
+  return true;
+}
+
+EComResponse CIPPipelinedComLayer::requestInterrupt(){
+  if(mInterruptPending){
+    //the FB will look at the queue with the interrupt already requested
+    return e_Nothing;
+  }
+  if(!mFb->interruptCommFB(this)){
+    //the frames stay queued, the next received data requests the interrupt again
+    return e_Nothing;
+  }
+  mInterruptPending = true;
+  return e_ProcessDataOk;
+}
+
+void CIPPipelinedComLayer::restartInterrupt(){
+  if(e_Nothing != requestInterrupt()){
+    mFb->getDevice()->getDeviceExecution().startNewEventChain(mFb);
+  }
+}
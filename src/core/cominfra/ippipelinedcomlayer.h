@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#ifndef IPPIPELINEDCOMLAYER_H_
+#define IPPIPELINEDCOMLAYER_H_
+
+#include <sockhand.h>
+#include <forte_config.h>
+#include "comlayer.h"
+#include <vector>
+
+namespace forte {
+
+  namespace com_infra {
+
+    /*!\brief TCP client/server layer with several requests in flight (ID ipp[host:port])
+     *
+     * Each message is preceded by a frame header of scmFrameHeaderSize bytes: a 32 bit correlation ID followed by the
+     * 16 bit payload length, both in network byte order. A client sends up to cgIPPipelineWindowSize requests without
+     * waiting for the responses; a REQ beyond this window is answered with SEND_FAILED. Responses are matched to the
+     * outstanding requests by their correlation ID.
+     *
+     * A server accepts up to cgIPPipelineMaxConnections clients. Every request is handed to the SERVER FB with its own
+     * IND and the following RSP is sent to the connection the request came from, carrying the request's correlation
+     * ID. Therefore the application has to answer each IND with exactly one RSP, in the order of the INDs.
+     *
+     * Received frames are queued in cgIPLayerRecvQueueSize slots. While the queue is full the connections are not
+     * read, which leaves the flow control to TCP.
+     */
+    class CIPPipelinedComLayer : public CComLayer {
+      public:
+        CIPPipelinedComLayer(CComLayer* paUpperLayer, CBaseCommFB* paComFB);
+        ~CIPPipelinedComLayer() override;
+
+        EComResponse sendData(void *paData, unsigned int paSize) override;
+        EComResponse recvData(const void *paData, unsigned int paSize) override;
+
+        EComResponse processInterrupt() override;
+
+        //! Number of requests a client has sent without having got the response, can be called from any thread
+        unsigned int getNumOutstandingRequests();
+
+        //! Number of clients connected to a server, can be called from any thread
+        unsigned int getNumConnections();
+
+        static const unsigned int scmFrameHeaderSize = 6;
+
+        static_assert(cgIPLayerRecvBufferSize <= 0xFFFF, "the frame header holds the payload length in 16 bits");
+
+      private:
+        struct SConnection {
+          CIPComSocketHandler::TSocketDescriptor mSocketID;
+          TForteUInt32 mGeneration; //!< changed whenever the slot gets a new client, so replies to a closed one are dropped
+          char *mBuffer; //!< scmFrameHeaderSize + cgIPLayerRecvBufferSize bytes for reassembling the frames
+          unsigned int mFill;
+          bool mPaused; //!< the socket has been removed from the handler as the receive queue is full
+        };
+
+        struct SFrame {
+          unsigned int mConnection;
+          TForteUInt32 mGeneration;
+          TForteUInt32 mCorrelationID;
+          unsigned int mSize;
+        };
+
+        //! Where the response to a request handed to the SERVER FB has to go
+        struct SReplyRoute {
+          unsigned int mConnection;
+          TForteUInt32 mGeneration;
+          TForteUInt32 mCorrelationID;
+        };
+
+        //! Connection and correlation ID a frame is sent with, taken under the FB lock so the sending can go without it
+        struct SSendTarget {
+          unsigned int mConnection;
+          TForteUInt32 mGeneration;
+          CIPComSocketHandler::TSocketDescriptor mSocketID;
+          TForteUInt32 mCorrelationID;
+        };
+
+        static const unsigned int scmMaxReplyRoutes = cgIPPipelineWindowSize * cgIPPipelineMaxConnections;
+
+        EComResponse openConnection(char *paLayerParameter) override;
+        void closeConnection() override;
+
+        void acceptConnection();
+        void readConnection(unsigned int paConnection);
+        void closeConnectionSlot(unsigned int paConnection);
+
+        /*!\brief Move the complete frames of a connection into the receive queue
+         *
+         * \return false if frames are left in the connection's buffer as the receive queue is full
+         */
+        bool queueFrames(unsigned int paConnection);
+        void resumePausedConnections();
+
+        //! Hand the oldest queued frame to the upper layer
+        EComResponse deliverFrame();
+        bool canDeliverFrame() const;
+        bool takeOutstandingRequest(TForteUInt32 paCorrelationID);
+
+        /*!\brief Send a frame without holding the FB lock, so the receiving of other connections is not blocked
+         *
+         * If the sending fails the connection is closed, unless it has been given to another client meanwhile.
+         */
+        EComResponse sendFrame(const SSendTarget &paTarget, const void *paData, unsigned int paSize);
+        //! \return e_ProcessDataOk if paTarget has been filled and the request can be sent
+        EComResponse prepareClientRequest(SSendTarget &paTarget);
+        //! \return e_ProcessDataOk if paTarget has been filled, e_Nothing if the client of the request is gone
+        EComResponse prepareServerResponse(SSendTarget &paTarget);
+
+        EComResponse requestInterrupt();
+        //! Interrupt the FB from its own ECET, e.g., for the next queued frame
+        void restartInterrupt();
+
+        char *getRecvSlot(unsigned int paSlot) const {
+          return &mRecvQueue[paSlot * cgIPLayerRecvBufferSize];
+        }
+
+        CIPComSocketHandler::TSocketDescriptor mListeningID;
+        SConnection mConnections[cgIPPipelineMaxConnections];
+        EComResponse mInterruptResp;
+        bool mInterruptPending; //!< the FB has been interrupted and will take the next frame
+
+        //! ring of cgIPLayerRecvQueueSize payloads of cgIPLayerRecvBufferSize bytes each, allocated on the first open
+        char *mRecvQueue;
+        //! reassembly buffers of all connections, allocated on the first open
+        char *mConnectionBuffers;
+        SFrame mFrames[cgIPLayerRecvQueueSize];
+        unsigned int mFrameHead;
+        unsigned int mFrameCount;
+
+        SReplyRoute mReplyRoutes[scmMaxReplyRoutes];
+        unsigned int mReplyRouteHead;
+        unsigned int mReplyRouteCount;
+
+        TForteUInt32 mOutstandingRequests[cgIPPipelineWindowSize];
+        unsigned int mNumOutstandingRequests;
+        TForteUInt32 mNextCorrelationID;
+
+        //! only used by the FB's sending thread, therefore it needs no lock
+        std::vector<char> mSendBuffer;
+    };
+
+  }
+
+}
+
+#endif /* IPPIPELINEDCOMLAYER_H_ */
@@ -19,6 +19,8 @@
 #include "../resource.h"
 #include "../device.h"
 #include "../utils/criticalregion.h"
+#include "../ecet.h"
+#include <algorithm>
 
 
 using namespace forte::com_infra;
@@ -26,7 +28,7 @@ using namespace forte::com_infra;
 CLocalComLayer::CLocalCommGroupsManager CLocalComLayer::smLocalCommGroupsManager;
 
 CLocalComLayer::CLocalComLayer(CComLayer* paUpperLayer, CBaseCommFB * paFB) :
-  CComLayer(paUpperLayer, paFB), mLocalCommGroup(nullptr){
+  CComLayer(paUpperLayer, paFB), mLocalCommGroup(nullptr), mInterruptPending(false), mInterruptDropped(false){
 }
 
 CLocalComLayer::~CLocalComLayer(){
@@ -34,31 +36,58 @@ CLocalComLayer::~CLocalComLayer(){
 }
 
 EComResponse CLocalComLayer::sendData(void *, unsigned int){
-  CIEC_ANY **sds = mFb->getSDs();
-  TPortId numSDs = mFb->getNumSD();
+  if(nullptr == mLocalCommGroup){
+    return e_ProcessDataSendFailed;
+  }
 
-  CLocalCommGroup* comGroup = getLocalCommGroupsManager().getComGroup(mGroupID);
+  CLocalCommGroup &comGroup(*mLocalCommGroup);
+  CCriticalRegion publishRegion(comGroup.mPublishSync);
+  comGroup.publish(*this, mFb->getSDs(), mFb->getNumSD());
 
-  if (comGroup == nullptr) {
-    return e_ProcessDataSendFailed;
+  for(auto runner : comGroup.mSublList){
+    if(!runner->mInterruptPending.exchange(true) || runner->mInterruptDropped){
+      forte::com_infra::CBaseCommFB& subFb(*runner->getCommFB());
+      {
+        CCriticalRegion criticalRegion(subFb.getFBLock());
+        //with a full queue the interrupt stays pending, the subscriber is woken to drain it and interrupted again
+        //with the next publication
+        runner->mInterruptDropped = !subFb.interruptCommFB(runner);
+      }
+      comGroup.mWakeList.push_back(&subFb);
+    }
   }
 
-  for(auto runner : comGroup->mSublList){
-    forte::com_infra::CBaseCommFB& subFb(*runner->getCommFB());
-    CCriticalRegion criticalRegion(subFb.getFBLock());
-    setRDs(subFb, sds, numSDs);
-    subFb.interruptCommFB(runner);
-    subFb.getDevice()->getDeviceExecution().startNewEventChain(&subFb);
+  if(!comGroup.mWakeList.empty()){
+    const size_t numNotWoken = mFb->getDevice()->getDeviceExecution().startNewEventChains(comGroup.mWakeList.data(),
+        comGroup.mWakeList.size(), comGroup.mWakeBatch);
+    if(0 != numNotWoken){
+      //subscribers which have not been woken must be interrupted again with the next publication
+      auto notWokenEnd = comGroup.mWakeList.begin() + static_cast<std::ptrdiff_t>(numNotWoken);
+      for(auto runner : comGroup.mSublList){
+        if(notWokenEnd != std::find(comGroup.mWakeList.begin(), notWokenEnd, runner->getCommFB())){
+          runner->mInterruptPending = false;
+        }
+      }
+    }
+    comGroup.mWakeList.clear();
   }
-  
+
   return e_ProcessDataOk;
 }
 
+EComResponse CLocalComLayer::processInterrupt(){
+  //clear the flag before reading so that a publication while reading interrupts this subscriber again
+  mInterruptPending = false;
+  if(nullptr != mLocalCommGroup){
+    CCriticalRegion criticalRegion(mFb->getFBLock());
+    mLocalCommGroup->readValues(mFb->getRDs(), mFb->getNumRD());
+  }
+  return e_ProcessDataOk;
+}
 
-void CLocalComLayer::setRDs(forte::com_infra::CBaseCommFB& paSubl, CIEC_ANY **paSDs, TPortId paNumSDs){
-  CIEC_ANY **aRDs = paSubl.getRDs();
+void CLocalComLayer::setGroupValues(CIEC_ANY **paGroupValues, CIEC_ANY *const *, CIEC_ANY **paSDs, TPortId paNumSDs){
   for(size_t i = 0; i < paNumSDs; ++i){
-      aRDs[i]->setValue(*paSDs[i]);
+    paGroupValues[i]->setValue(paSDs[i]->unwrap());
   }
 }
 
@@ -91,6 +120,51 @@ void CLocalComLayer::closeConnection(){
   }
 }
 
+/********************** CLocalCommGroup *************************************/
+CLocalComLayer::CLocalCommGroup::CLocalCommGroup(CStringDictionary::TStringId paGroupName, TLocalComDataTypeList paDataTypes,
+    CIEC_ANY **paDataPins, TPortId paNumDataPins) :
+    mGroupName(paGroupName), mPublList(), mSublList(), mDataTypes(std::move(paDataTypes)), mFront(0){
+  for(TValueBuffer &buffer : mValues){
+    buffer.reserve(paNumDataPins);
+    for(size_t i = 0; nullptr != paDataPins && i < paNumDataPins; ++i){
+      buffer.push_back(paDataPins[i]->unwrap().clone(nullptr));
+    }
+  }
+}
+
+CLocalComLayer::CLocalCommGroup::~CLocalCommGroup(){
+  for(TValueBuffer &buffer : mValues){
+    for(CIEC_ANY *value : buffer){
+      delete value;
+    }
+  }
+}
+
+void CLocalComLayer::CLocalCommGroup::publish(CLocalComLayer &paPublisher, CIEC_ANY **paSDs, TPortId paNumSDs){
+  //subscribers only read the front buffer, so the back buffer can be written without blocking them
+  TValueBuffer &back = mValues[1 - mFront];
+  paPublisher.setGroupValues(back.data(), mValues[mFront].data(), paSDs, std::min(paNumSDs, static_cast<TPortId>(back.size())));
+  CCriticalRegion criticalRegion(mFrontSync);
+  mFront = 1 - mFront;
+}
+
+void CLocalComLayer::CLocalCommGroup::readValues(CIEC_ANY **paRDs, TPortId paNumRDs){
+  CCriticalRegion criticalRegion(mFrontSync);
+  const TValueBuffer &front = mValues[mFront];
+  for(size_t i = 0; i < paNumRDs && i < front.size(); ++i){
+    paRDs[i]->setValue(*front[i]);
+  }
+}
+
+void CLocalComLayer::CLocalCommGroup::addSubscriber(CLocalComLayer *paLayer){
+  CEventChainExecutionThread *eventChainExecutor = paLayer->getCommFB()->getEventChainExecutor();
+  auto iter = std::find_if(mSublList.rbegin(), mSublList.rend(), [eventChainExecutor](CLocalComLayer *paSubscriber) {
+    return paSubscriber->getCommFB()->getEventChainExecutor() == eventChainExecutor;
+  });
+  mSublList.insert(iter.base(), paLayer);
+  mWakeList.reserve(mSublList.size());
+}
+
 /********************** CLocalCommGroupsManager *************************************/
 CLocalComLayer::CLocalCommGroup* CLocalComLayer::CLocalCommGroupsManager::registerPubl(const CStringDictionary::TStringId paID, CLocalComLayer *paLayer){
   forte::com_infra::CBaseCommFB *commFb = paLayer->getCommFB();
@@ -98,9 +172,10 @@ CLocalComLayer::CLocalCommGroup* CLocalComLayer::CLocalCommGroupsManager::regist
 }
 
 CLocalComLayer::CLocalCommGroup* CLocalComLayer::CLocalCommGroupsManager::getComGroup(const CStringDictionary::TStringId paGroupID) {
+  CCriticalRegion criticalRegion(mSync);
   auto iterator = getLocalCommGroupIterator(paGroupID);
   if (isGroupIteratorForGroup(iterator, paGroupID)) {
-    return &(*iterator);
+    return iterator->get();
   }
   return nullptr;
 }
@@ -110,6 +185,7 @@ CLocalComLayer::CLocalCommGroup* CLocalComLayer::CLocalCommGroupsManager::regist
   CCriticalRegion criticalRegion(mSync);
   CLocalCommGroup *const group = findOrCreateLocalCommGroup(paID, paDataPins, paNumDataPins);
   if(group != nullptr){
+    CCriticalRegion publishRegion(group->mPublishSync);
     group->mPublList.push_back(paLayer);
   }
   return group;
@@ -117,7 +193,10 @@ CLocalComLayer::CLocalCommGroup* CLocalComLayer::CLocalCommGroupsManager::regist
 
 void CLocalComLayer::CLocalCommGroupsManager::unregisterPubl(CLocalCommGroup *paGroup, CLocalComLayer *paLayer){
   CCriticalRegion criticalRegion(mSync);
-  removeListEntry(paGroup->mPublList, paLayer);
+  {
+    CCriticalRegion publishRegion(paGroup->mPublishSync);
+    removeListEntry(paGroup->mPublList, paLayer);
+  }
   if((paGroup->mPublList.empty()) && (paGroup->mSublList.empty())){
     removeCommGroup(*paGroup);
   }
@@ -128,14 +207,18 @@ CLocalComLayer::CLocalCommGroup* CLocalComLayer::CLocalCommGroupsManager::regist
   forte::com_infra::CBaseCommFB *commFb = paLayer->getCommFB();
   CLocalCommGroup *const group = findOrCreateLocalCommGroup(paID, commFb->getRDs(), commFb->getNumRD());
   if(group != nullptr){
-    group->mSublList.push_back(paLayer);
+    CCriticalRegion publishRegion(group->mPublishSync);
+    group->addSubscriber(paLayer);
   }
   return group;
 }
 
 void CLocalComLayer::CLocalCommGroupsManager::unregisterSubl(CLocalCommGroup *paGroup, CLocalComLayer *paLayer){
   CCriticalRegion criticalRegion(mSync);
-  removeListEntry(paGroup->mSublList, paLayer);
+  {
+    CCriticalRegion publishRegion(paGroup->mPublishSync);
+    removeListEntry(paGroup->mSublList, paLayer);
+  }
   if((paGroup->mPublList.empty()) && (paGroup->mSublList.empty())){
     removeCommGroup(*paGroup);
   }
@@ -144,9 +227,9 @@ void CLocalComLayer::CLocalCommGroupsManager::unregisterSubl(CLocalCommGroup *pa
 CLocalComLayer::CLocalCommGroupsManager::TLocalCommGroupList::iterator CLocalComLayer::CLocalCommGroupsManager::getLocalCommGroupIterator(
     CStringDictionary::TStringId paID){
   return lower_bound(mLocalCommGroups.begin(), mLocalCommGroups.end(), paID,
-                                  [](const CLocalCommGroup& locGroup,
+                                  [](const std::unique_ptr<CLocalCommGroup>& locGroup,
                                      CStringDictionary::TStringId groupId) {
-                                    return locGroup.mGroupName < groupId;
+                                    return locGroup->mGroupName < groupId;
                                   });
 }
 
@@ -154,12 +237,13 @@ CLocalComLayer::CLocalCommGroup* CLocalComLayer::CLocalCommGroupsManager::findOr
     CIEC_ANY **paDataPins, TPortId paNumDataPins){
   auto iter = getLocalCommGroupIterator(paID);
   if(isGroupIteratorForGroup(iter, paID)){
-    if(checkDataTypes(*iter, paDataPins, paNumDataPins)){
-      return &(*iter);
+    if(checkDataTypes(**iter, paDataPins, paNumDataPins)){
+      return iter->get();
     }
     return nullptr;
   }
-  return &(*mLocalCommGroups.insert(iter, CLocalCommGroup(paID, buildDataTypeList(paDataPins, paNumDataPins))));
+  return mLocalCommGroups.insert(iter, std::make_unique<CLocalCommGroup>(paID, buildDataTypeList(paDataPins, paNumDataPins),
+      paDataPins, paNumDataPins))->get();
 }
 
 void CLocalComLayer::CLocalCommGroupsManager::removeListEntry(CLocalCommGroup::TLocalComLayerList  &paComLayerList, CLocalComLayer *paLayer){
@@ -17,15 +17,25 @@
 
 #include "comlayer.h"
 #include "../stringdict.h"
+#include "../devexec.h"
 #include <forte_sync.h>
+#include <atomic>
+#include <memory>
 #include <vector>
 
 class CIEC_ANY;
+class CEventSourceFB;
 
 namespace forte {
 
   namespace com_infra {
 
+    /*!\brief Publish/subscribe between the FBs of one FORTE instance (ID loc[groupname])
+     *
+     * A publisher writes its SDs once into the values of its group, subscribers copy the latest values into their RDs
+     * when they process their interrupt. A subscriber which has not yet processed a publication is not interrupted
+     * again, it receives only the latest values (last value wins).
+     */
     class CLocalComLayer : public CComLayer{
 
       public:
@@ -37,36 +47,67 @@ namespace forte {
           return e_ProcessDataOk;
         }
 
-        EComResponse processInterrupt() override {
-          return e_ProcessDataOk;
-        }
+        EComResponse processInterrupt() override;
 
       protected:
-        virtual void setRDs(forte::com_infra::CBaseCommFB& paSubl, CIEC_ANY **paSDs, TPortId paNumSDs);
-
-
+        /*!\brief Write the published SDs into the values of the group
+         *
+         * \param paGroupValues values of the group to write, they are outdated by at least one publication
+         * \param paLatestValues values of the group as published last
+         * \param paSDs the SDs to publish
+         * \param paNumSDs number of SDs
+         */
+        virtual void setGroupValues(CIEC_ANY **paGroupValues, CIEC_ANY *const *paLatestValues, CIEC_ANY **paSDs, TPortId paNumSDs);
+
+
+        /*!\brief Publishers and subscribers of a group and the values published last
+         *
+         * The values are double buffered. Publishers write the back buffer and swap it with the front buffer,
+         * subscribers copy the front buffer. Publishers only wait for subscribers when swapping the buffers.
+         */
         class CLocalCommGroup {
           public:
             using TLocalComLayerList = std::vector<CLocalComLayer *>;
             using TLocalComDataTypeList = std::vector<CStringDictionary::TStringId>;
 
-            explicit CLocalCommGroup(CStringDictionary::TStringId paGroupName, TLocalComDataTypeList paDataTypes) :
-                mGroupName(paGroupName), mPublList(), mSublList(), mDataTypes(paDataTypes){
-            }
+            CLocalCommGroup(CStringDictionary::TStringId paGroupName, TLocalComDataTypeList paDataTypes, CIEC_ANY **paDataPins,
+                TPortId paNumDataPins);
+            ~CLocalCommGroup();
 
-            CLocalCommGroup(const CLocalCommGroup& paLocalCommGroup) :
-                mGroupName(paLocalCommGroup.mGroupName),
-                mPublList(paLocalCommGroup.mPublList),
-                mSublList(paLocalCommGroup.mSublList),
-                mDataTypes(paLocalCommGroup.mDataTypes){
-            }
+            CLocalCommGroup(const CLocalCommGroup&) = delete;
+            CLocalCommGroup& operator=(const CLocalCommGroup&) = delete;
+
+            //! Write the SDs of paPublisher into the back buffer and make it the front buffer, needs mPublishSync
+            void publish(CLocalComLayer &paPublisher, CIEC_ANY **paSDs, TPortId paNumSDs);
 
-            ~CLocalCommGroup() = default;
+            //! Copy the values published last into paRDs
+            void readValues(CIEC_ANY **paRDs, TPortId paNumRDs);
+
+            //! Add a subscriber next to the subscribers with the same event chain execution thread, needs mPublishSync
+            void addSubscriber(CLocalComLayer *paLayer);
 
             CStringDictionary::TStringId mGroupName;
             TLocalComLayerList mPublList;
             TLocalComLayerList mSublList;
             TLocalComDataTypeList mDataTypes;
+
+            //! Serializes the publishers and protects mSublList against changes while publishing
+            CSyncObject mPublishSync;
+
+            //! Subscribers to wake after a publication, kept to avoid allocations when publishing
+            std::vector<CEventSourceFB *> mWakeList;
+
+            //! Batch buffers for waking the subscribers, needs mPublishSync
+            CDeviceExecution::SEventChainBatch mWakeBatch;
+
+          private:
+            using TValueBuffer = std::vector<CIEC_ANY *>;
+
+            TValueBuffer mValues[2];
+            size_t mFront; //!< index of the buffer holding the values published last
+
+            //! Protects mFront against swapping while a subscriber copies the front buffer
+            CSyncObject mFrontSync;
         };
 
         class CLocalCommGroupsManager{
@@ -83,7 +124,7 @@ namespace forte {
             CLocalCommGroup* getComGroup(const CStringDictionary::TStringId paGroupID);
 
           private:
-            using TLocalCommGroupList = std::vector<CLocalCommGroup>;
+            using TLocalCommGroupList = std::vector<std::unique_ptr<CLocalCommGroup>>;
 
             CLocalCommGroupsManager() = default;
 
@@ -93,7 +134,7 @@ namespace forte {
             void removeCommGroup(CLocalCommGroup &paGroup);
 
             bool isGroupIteratorForGroup(TLocalCommGroupList::iterator iter, CStringDictionary::TStringId paID){
-              return (iter != mLocalCommGroups.end() && iter->mGroupName == paID);
+              return (iter != mLocalCommGroups.end() && (*iter)->mGroupName == paID);
             }
 
             static void removeListEntry(CLocalCommGroup::TLocalComLayerList  &paComLayerList, CLocalComLayer *paLayer);
@@ -123,6 +164,12 @@ namespace forte {
         CLocalCommGroup *mLocalCommGroup;
         CStringDictionary::TStringId mGroupID;
 
+        //! Set while this subscriber has an interrupt pending for the latest values of its group
+        std::atomic<bool> mInterruptPending;
+
+        //! The pending interrupt did not fit into the FB's interrupt queue and is queued again with the next publication, needs mPublishSync
+        bool mInterruptDropped;
+
       private:
         static CLocalCommGroupsManager smLocalCommGroupsManager;
 
@@ -24,8 +24,10 @@ CStructMemberLocalComLayer::CStructMemberLocalComLayer(CComLayer* paUpperLayer,
     CLocalComLayer(paUpperLayer, paFB){
 }
 
-void CStructMemberLocalComLayer::setRDs(forte::com_infra::CBaseCommFB &paSubl, CIEC_ANY **paSDs, TPortId ){
-  CIEC_ANY* target = getTargetByIndex(static_cast<CIEC_STRUCT*>(&(paSubl.getRDs()[0]->unwrap())), mIndexList);
+void CStructMemberLocalComLayer::setGroupValues(CIEC_ANY **paGroupValues, CIEC_ANY *const *paLatestValues, CIEC_ANY **paSDs, TPortId){
+  //only the member is written, all other members keep their latest published values
+  paGroupValues[0]->setValue(*paLatestValues[0]);
+  CIEC_ANY* target = getTargetByIndex(static_cast<CIEC_STRUCT*>(&(paGroupValues[0]->unwrap())), mIndexList);
   if (nullptr != target)
     target->setValue(paSDs[0]->unwrap());
 }
@@ -55,7 +55,7 @@ namespace forte {
         CStructMemberLocalComLayer(CComLayer *paUpperLayer, CBaseCommFB *paFB);
 
       protected:
-        void setRDs(forte::com_infra::CBaseCommFB &paSubl, CIEC_ANY **paSDs, TPortId paNumSDs);
+        void setGroupValues(CIEC_ANY **paGroupValues, CIEC_ANY *const *paLatestValues, CIEC_ANY **paSDs, TPortId paNumSDs) override;
 
       private:
         using TTargetStructIndexList = std::vector<TForteInt16>;
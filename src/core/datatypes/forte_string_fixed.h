@@ -9,6 +9,8 @@
  * Contributors:
  *    Martin Melik Merkumians
  *      - initial implementation
+ *    Contributors to the Eclipse Foundation
+ *      - reserve the buffer with the first long value and keep it
  *******************************************************************************/
 
 #pragma once
@@ -18,69 +20,108 @@
 #include <string>
 #include <algorithm>
 
+/*!\ingroup COREDTS CIEC_STRING_FIXED represents STRING[maxLength] according to IEC 61131.
+ *
+ * Short strings fit into the inline buffer of std::string. The first value which does not fit reserves a buffer for at
+ * least scmInitialCapacity characters, which is kept afterwards: all assignments, including moves and the value
+ * transfers of data connections, copy into this buffer. Only values longer than the buffer grow it, which then keeps
+ * its size. Using STRING[n] instead of STRING therefore keeps copies along connections off the heap, while temporaries
+ * and values which stay short, like an ARRAY OF STRING[255] of mostly empty elements, do not allocate at all.
+ */
 template<size_t maxLength>
 class CIEC_STRING_FIXED final : public CIEC_STRING {
   static_assert(maxLength > 0, "Length must be larger than 0");
   static_assert(maxLength <= CIEC_STRING::scmMaxStringLen, "Length must be smaller than CIEC_STRING::scmMaxStringLen");
   public:
     static constexpr size_t scmMaxStringLen = maxLength;
+    //! characters reserved when the first value longer than the inline buffer of std::string is stored
+    static constexpr size_t scmInitialCapacity = std::min(maxLength, static_cast<size_t>(64));
     using CIEC_STRING::at;
     using CIEC_STRING::operator[];
 
-    CIEC_STRING_FIXED() : CIEC_STRING() {}
+    CIEC_STRING_FIXED() : CIEC_STRING() {
+    }
 
     //Char has size 1 so it should always fit
-    CIEC_STRING_FIXED(const CIEC_CHAR &paValue) : CIEC_STRING(paValue) {}
+    CIEC_STRING_FIXED(const CIEC_CHAR &paValue) : CIEC_STRING_FIXED() {
+      *this = paValue;
+    }
 
     // Copy maxLength substring from CIEC_STRING
-    CIEC_STRING_FIXED(const CIEC_STRING &paValue) : CIEC_STRING(paValue.getStorage().substr(0, maxLength)) {}
+    CIEC_STRING_FIXED(const CIEC_STRING &paValue) : CIEC_STRING_FIXED() {
+      assignTruncated(paValue.getStorage());
+    }
 
     // Same size, just copy
-    CIEC_STRING_FIXED(const CIEC_STRING_FIXED &paValue) : CIEC_STRING(paValue) {}
-    // Same size, just move
-    CIEC_STRING_FIXED(CIEC_STRING_FIXED &&paValue) : CIEC_STRING(std::move(paValue)) {}
+    CIEC_STRING_FIXED(const CIEC_STRING_FIXED &paValue) : CIEC_STRING_FIXED() {
+      assignKept(paValue.getStorage());
+    }
+
+    // Same size, just move; the moved-from value reserves a new buffer when it is assigned a long value again
+    CIEC_STRING_FIXED(CIEC_STRING_FIXED &&paValue) : CIEC_STRING(std::move(paValue)) {
+    }
 
     template <size_t otherLength>
-    CIEC_STRING_FIXED(const CIEC_STRING_FIXED<otherLength> &paValue) : CIEC_STRING(paValue.getStorage().substr(0, std::min(maxLength, otherLength))) {}
+    CIEC_STRING_FIXED(const CIEC_STRING_FIXED<otherLength> &paValue) : CIEC_STRING_FIXED() {
+      assignTruncated(paValue.getStorage());
+    }
 
+    // The other buffer may be smaller than ours, so copy instead of taking it over
     template <size_t otherLength>
-    CIEC_STRING_FIXED(CIEC_STRING_FIXED<otherLength> &&paValue) : CIEC_STRING(std::move(paValue)) {
-      const size_t currentLength = static_cast<size_t>(this->length());
-      // currentLength should be never larger than maxLengths
-      getStorageMutable().resize(std::min(currentLength, maxLength));
+    CIEC_STRING_FIXED(CIEC_STRING_FIXED<otherLength> &&paValue) : CIEC_STRING_FIXED() {
+      assignTruncated(paValue.getStorage());
+    }
+
+    explicit CIEC_STRING_FIXED(const std::string &paValue) : CIEC_STRING_FIXED() {
+      assignTruncated(paValue);
     }
 
-    explicit CIEC_STRING_FIXED(const std::string paValue) : CIEC_STRING(paValue.substr(0, maxLength)) {}
-    explicit CIEC_STRING_FIXED(const char *paValue, const size_t paLength) : CIEC_STRING(paValue, std::min(paLength, maxLength)) {}
+    explicit CIEC_STRING_FIXED(const char *paValue, const size_t paLength) : CIEC_STRING_FIXED() {
+      assign(paValue, std::min(paLength, maxLength));
+    }
 
     ~CIEC_STRING_FIXED() = default;
 
     using CIEC_STRING::operator=;
 
+    CIEC_STRING_FIXED &operator=(const CIEC_CHAR &paValue) {
+      getStorageMutable().assign(1, static_cast<char>(static_cast<CIEC_CHAR::TValueType>(paValue)));
+      return *this;
+    }
+
     // Also handles the case of two different fix sized strings, as only the own maxLength is relevant
     CIEC_STRING_FIXED &operator=(const CIEC_STRING &paValue) {
-      const std::string_view stringView(paValue.getStorage());
-      getStorageMutable() = stringView.substr(0, maxLength);
+      assignTruncated(paValue.getStorage());
       return *this;
     }
 
     CIEC_STRING_FIXED &operator=(CIEC_STRING &&paValue) {
-      CIEC_STRING::operator=(std::move(paValue));
-      const size_t currentLength = static_cast<size_t>(this->length());
-      getStorageMutable().resize(std::min(currentLength, maxLength));
+      assignTruncated(paValue.getStorage());
       return *this;
     }
 
     CIEC_STRING_FIXED &operator=(const CIEC_STRING_FIXED &paValue) {
-      getStorageMutable() = paValue.getStorage();
+      assignKept(paValue.getStorage());
       return *this;
     }
 
     CIEC_STRING_FIXED &operator=(CIEC_STRING_FIXED &&paValue) {
-      getStorageMutable() = std::move(paValue.getStorageMutable());
+      assignKept(paValue.getStorage());
       return *this;
     }
 
+    void setValue(const CIEC_ANY &paValue) override {
+      if(paValue.getDataTypeID() == CIEC_ANY::e_STRING) {
+        assignTruncated(static_cast<const CIEC_STRING &>(paValue).getStorage());
+      } else {
+        CIEC_STRING::setValue(paValue);
+      }
+    }
+
+    CIEC_ANY *clone(TForteByte *paDataBuf) const override {
+      return (nullptr != paDataBuf) ? new(paDataBuf) CIEC_STRING_FIXED(*this) : new CIEC_STRING_FIXED(*this);
+    }
+
     size_t getMaximumLength() const override {
       return maxLength;
     }
@@ -93,7 +134,9 @@ class CIEC_STRING_FIXED final : public CIEC_STRING {
     }
 
     void assign(const char *paData, const TForteUInt16 paLen) override {
-      getStorageMutable().assign(paData, std::min(static_cast<size_t>(paLen), maxLength));
+      const size_t length = std::min(static_cast<size_t>(paLen), maxLength);
+      reserveFor(length);
+      getStorageMutable().assign(paData, length);
     }
 
     using CIEC_STRING::append;
@@ -103,16 +146,39 @@ class CIEC_STRING_FIXED final : public CIEC_STRING {
     void append(const char *paData, const TForteUInt16 paLen) override {
       const size_t currentLength = this->length();
       if (currentLength < maxLength) {
-        const size_t remainingSpace = maxLength - currentLength;
-        getStorageMutable().append(paData, std::min(static_cast<size_t>(paLen), remainingSpace));
+        const size_t appendLength = std::min(static_cast<size_t>(paLen), maxLength - currentLength);
+        reserveFor(currentLength + appendLength);
+        getStorageMutable().append(paData, appendLength);
       }
     }
 
     void append(const std::string &paValue) override {
       const size_t currentLength = length();
       if (currentLength < maxLength) {
-        const size_t remainingSpace = maxLength - currentLength;
-        getStorageMutable().append(paValue, 0, remainingSpace);
+        const size_t appendLength = std::min(paValue.length(), maxLength - currentLength);
+        reserveFor(currentLength + appendLength);
+        getStorageMutable().append(paValue, 0, appendLength);
       }
     }
+
+  private:
+    //! Make room for paLength characters, the first buffer holds at least scmInitialCapacity characters
+    void reserveFor(size_t paLength) {
+      std::string &storage = getStorageMutable();
+      if(paLength > storage.capacity()) {
+        storage.reserve(std::max(paLength, scmInitialCapacity));
+      }
+    }
+
+    //! Copy into the kept buffer, unlike the copy assignment of std::string, which may replace it
+    void assignKept(const std::string &paValue) {
+      reserveFor(paValue.length());
+      getStorageMutable().assign(paValue.data(), paValue.length());
+    }
+
+    void assignTruncated(const std::string &paValue) {
+      const size_t length = std::min(paValue.length(), maxLength);
+      reserveFor(length);
+      getStorageMutable().assign(paValue.data(), length);
+    }
 };
\ No newline at end of file
@@ -38,11 +38,11 @@ CDeviceExecution::~CDeviceExecution() {
 }
 
 void CDeviceExecution::startNewEventChain(CEventSourceFB* paECStartFB) const {
-  // maybe in the future here has to be added something for handling priority adaption and stuff like this.
   if(nullptr != paECStartFB) {
     CEventChainExecutionThread *poEventChainExecutor = paECStartFB->getEventChainExecutor();
     if(nullptr != poEventChainExecutor) {
-      poEventChainExecutor->startEventChain(*paECStartFB->getEventSourceEventEntry());
+      //the ECET orders the new chain according to the priority class of its event source
+      poEventChainExecutor->startEventChain(*paECStartFB->getEventSourceEventEntry(), paECStartFB->getEventChainPriority());
     } else {
       DEVLOG_ERROR("[CDeviceExecution] Couldn't start new event chain because the event has no CEventChainExecutionThread");
     }
@@ -51,6 +51,36 @@ void CDeviceExecution::startNewEventChain(CEventSourceFB* paECStartFB) const {
   }
 }
 
+size_t CDeviceExecution::startNewEventChains(CEventSourceFB **paECStartFBs, size_t paNumECStartFBs, SEventChainBatch &paBatch) const {
+  size_t numNotStarted = 0;
+  size_t i = 0;
+  while(i < paNumECStartFBs) {
+    CEventChainExecutionThread *eventChainExecutor = paECStartFBs[i]->getEventChainExecutor();
+    EEventChainPriority priority = paECStartFBs[i]->getEventChainPriority();
+    if(nullptr == eventChainExecutor) {
+      DEVLOG_ERROR("[CDeviceExecution] Couldn't start new event chain because the event has no CEventChainExecutionThread");
+      paECStartFBs[numNotStarted++] = paECStartFBs[i++];
+      continue;
+    }
+    const size_t batchStart = i;
+    size_t batchSize = 0;
+    //batches larger than an external event list can not be added at once anyway
+    while(i < paNumECStartFBs && batchSize < cgEventChainExternalEventListSize
+        && paECStartFBs[i]->getEventChainExecutor() == eventChainExecutor && paECStartFBs[i]->getEventChainPriority() == priority) {
+      paBatch.mEvents[batchSize++] = *paECStartFBs[i++]->getEventSourceEventEntry();
+    }
+    if(!eventChainExecutor->startEventChains(paBatch.mEvents, batchSize, priority, paBatch.mAdded)) {
+      //the not started ones never overtake the entries still to be read
+      for(size_t j = 0; j < batchSize; ++j) {
+        if(!paBatch.mAdded[j]) {
+          paECStartFBs[numNotStarted++] = paECStartFBs[batchStart + j];
+        }
+      }
+    }
+  }
+  return numNotStarted;
+}
+
 CExternalEventHandler* CDeviceExecution::getExtEvHandler(size_t paIdentifer) const {
   return mRegisteredEventHandlers[paIdentifer].mHandler;
 }
@@ -20,6 +20,7 @@ class CTimerHandler;
 class CDevice;
 
 #include <forte_config.h>
+#include "event.h"
 
 /**\ingroup CORE
  Handles all the IEC 61499 execution requests and aspects within one device
@@ -28,6 +29,12 @@ class CDevice;
  */
 class CDeviceExecution {
   public:
+    //! Buffers in which startNewEventChains collects the event chains handed to one event chain execution thread
+    struct SEventChainBatch {
+        TEventEntry mEvents[cgEventChainExternalEventListSize];
+        bool mAdded[cgEventChainExternalEventListSize]; //!< whether each of mEvents has been added to the external event list
+    };
+
     CDeviceExecution(CDevice& paDevice);
 
     ~CDeviceExecution();
@@ -45,6 +52,18 @@ class CDeviceExecution {
      * \param paECStartFB The start FB of the event chain
      */
     void startNewEventChain(CEventSourceFB* paECStartFB) const;
+
+    /*!\brief external events occurred at several ESs and their event chains are to start.
+     *
+     * Consecutive ESs with the same event chain execution thread and priority class are handed to it as one batch, so
+     * that the thread is woken only once per batch.
+     * \param paECStartFBs The start FBs of the event chains, on return the ones whose event chain could not be started
+     *                     are moved to its front
+     * \param paNumECStartFBs number of entries in paECStartFBs
+     * \param paBatch batch buffers of the caller, which must not be used concurrently by other callers
+     * \return number of event chains which could not be started
+     */
+    size_t startNewEventChains(CEventSourceFB **paECStartFBs, size_t paNumECStartFBs, SEventChainBatch &paBatch) const;
     /*!\brief Check if an occurrence of the given event handler is currently allowed.
      *
      * With this function the device execution can disable or enable the notification on external events.
@@ -18,22 +18,70 @@
 #include <fortenew.h>
 #include "ecet.h"
 #include "esfb.h"
-#include "utils/criticalregion.h"
 #include "../arch/devlog.h"
+#include "forte_architecture_time.h"
 
 CEventChainExecutionThread::CEventChainExecutionThread() :
-    CThread(), mSuspendSemaphore(false), mProcessingEvents(false){
+    CThread(), mCurrentPriority(EEventChainPriority::Normal), mProcessingEvents(false), mSuspendSemaphore(false), mSuspended(false),
+    mOverflowPolicy(EEventQueueOverflowPolicy::FORTE_EVENT_QUEUE_OVERFLOW_POLICY), mBlockTimeout(cgEventChainOverflowBlockTimeout),
+    mEventListHighWaterMark(0), mExternalEventListHighWaterMark(0),
+    mDroppedEvents(0), mDroppedExternalEvents(0), mCoalescedEvents(0){
+  for(std::atomic<TExternalEventList *> &externalEventList : mExternalEventLists){
+    externalEventList.store(nullptr, std::memory_order_relaxed);
+  }
+  mExternalEventLists[getPriorityIndex(EEventChainPriority::Normal)].store(&mNormalExternalEventList, std::memory_order_relaxed);
   clear();
 }
 
-CEventChainExecutionThread::~CEventChainExecutionThread() = default;
+CEventChainExecutionThread::~CEventChainExecutionThread(){
+  for(std::atomic<TExternalEventList *> &externalEventList : mExternalEventLists){
+    if(&mNormalExternalEventList != externalEventList.load(std::memory_order_relaxed)){
+      delete externalEventList.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+CEventChainExecutionThread::TExternalEventList &CEventChainExecutionThread::getExternalEventList(EEventChainPriority paPriority){
+  std::atomic<TExternalEventList *> &slot = mExternalEventLists[getPriorityIndex(paPriority)];
+  TExternalEventList *externalEventList = slot.load(std::memory_order_acquire);
+  if(nullptr == externalEventList){
+    //several event sources may start the first event of this class concurrently, only one list is kept
+    auto *newList = new TExternalEventList();
+    if(slot.compare_exchange_strong(externalEventList, newList, std::memory_order_acq_rel, std::memory_order_acquire)){
+      externalEventList = newList;
+    } else {
+      delete newList;
+    }
+  }
+  return *externalEventList;
+}
+
+void CEventChainExecutionThread::enableEventListGrowth(size_t paMaxSegments){
+  for(CEventList &eventList : mEventLists){
+    eventList.enableGrowth(paMaxSegments);
+  }
+}
+
+namespace {
+  //! the ECET running on the calling thread, nullptr on all other threads
+  thread_local const CEventChainExecutionThread *gCurrentECET = nullptr;
+}
 
 void CEventChainExecutionThread::run(){
+  setAsCurrentThread();
   while(isAlive()){ //thread is allowed to execute
     mainRun();
   }
 }
 
+void CEventChainExecutionThread::setAsCurrentThread() const {
+  gCurrentECET = this;
+}
+
+bool CEventChainExecutionThread::isCurrentThread() const {
+  return this == gCurrentECET;
+}
+
 void CEventChainExecutionThread::onAliveChanged(bool paNewValue) {
   if(!paNewValue){
     resumeSelfSuspend();
@@ -44,8 +92,9 @@ void CEventChainExecutionThread::mainRun(){
   if(externalEventOccured()){
     transferExternalEvents();
   }
-  TEventEntry *event = mEventList.pop();
+  TEventEntry *event = popEventEntry();
   if(nullptr == event){
+    flushDeferred();
     mProcessingEvents = false;
     selfSuspend();
     mProcessingEvents = true; //set this flag here to true as well in case the suspend just went through and processing was not finished
@@ -56,34 +105,205 @@ void CEventChainExecutionThread::mainRun(){
 }
 
 void CEventChainExecutionThread::clear(){
-  mEventList.clear();
+  for(CEventList &eventList : mEventLists){
+    eventList.clear();
+  }
 
-  {
-    CCriticalRegion criticalRegion(mExternalEventListSync);
-    mExternalEventList.clear();
+  //drain instead of reset as event sources may still add events concurrently
+  TEventEntry entry;
+  for(size_t i = 0; i < scmNumberOfPriorities; ++i){
+    TExternalEventList *externalEventList = findExternalEventList(i);
+    while(nullptr != externalEventList && externalEventList->pop(entry)){
+    }
   }
 }
 
+void CEventChainExecutionThread::runDeferredFlushes(){
+  //flushes registered meanwhile are appended and handled in the same run
+  for(size_t i = 0; i < mDeferredFlushes.size(); ++i){
+    if(nullptr != mDeferredFlushes[i]){
+      mDeferredFlushes[i]->flush();
+    }
+  }
+  mDeferredFlushes.clear();
+}
+
 void CEventChainExecutionThread::transferExternalEvents(){
-  CCriticalRegion criticalRegion(mExternalEventListSync);
   //this while is built in a way that it checks also if we got here by accident
-  while(!mExternalEventList.isEmpty()){
-    addEventEntry(*mExternalEventList.pop());
+  TEventEntry entry;
+  size_t transferred = 0;
+  for(size_t i = 0; i < scmNumberOfPriorities; ++i){
+    TExternalEventList *externalEventList = findExternalEventList(i);
+    while(nullptr != externalEventList && externalEventList->pop(entry)){
+      addEventEntry(entry, static_cast<EEventChainPriority>(i));
+      ++transferred;
+    }
+  }
+  //the ECET is the only writer of the high water mark
+  if(transferred > mExternalEventListHighWaterMark.load(std::memory_order_relaxed)){
+    mExternalEventListHighWaterMark.store(transferred, std::memory_order_relaxed);
+  }
+}
+
+void CEventChainExecutionThread::handleEventListOverflow(const TEventEntry &paEventToAdd, EEventChainPriority paPriority){
+  CEventList &eventList = mEventLists[getPriorityIndex(paPriority)];
+  switch(getOverflowPolicy()){
+    case EEventQueueOverflowPolicy::DropOldest:
+      if(eventList.replaceOldest(paEventToAdd)){
+        countDroppedEvent(mDroppedEvents, "Event queue is full, oldest event dropped!\n");
+      }
+      break;
+    case EEventQueueOverflowPolicy::Coalesce:
+      if(eventList.contains(paEventToAdd)){
+        mCoalescedEvents.fetch_add(1, std::memory_order_relaxed);
+        break;
+      }
+      countDroppedEvent(mDroppedEvents, "Event queue is full, event dropped!\n");
+      break;
+    default:
+      countDroppedEvent(mDroppedEvents, "Event queue is full, event dropped!\n");
+      break;
+  }
+}
+
+void CEventChainExecutionThread::handleFanOutOverflow(const TEventEntry *paEventsToAdd, size_t paNumEvents){
+  CEventList &eventList = mEventLists[getPriorityIndex(mCurrentPriority)];
+  switch(getOverflowPolicy()){
+    case EEventQueueOverflowPolicy::DropOldest:
+      //a fan-out larger than the whole event list can never be delivered, keep the queued events then
+      if(paNumEvents <= eventList.getCapacity()){
+        const size_t numDropped = paNumEvents - eventList.getFreeSpace();
+        eventList.dropOldest(numDropped);
+        eventList.pushAll(paEventsToAdd, paNumEvents);
+        updateEventListHighWaterMark();
+        countDroppedEvent(mDroppedEvents, "Event queue is full, oldest events dropped!\n", static_cast<TForteUInt32>(numDropped));
+        return;
+      }
+      break;
+    case EEventQueueOverflowPolicy::Coalesce:
+      if(std::all_of(paEventsToAdd, paEventsToAdd + paNumEvents,
+          [&eventList](const TEventEntry &paEvent){ return eventList.contains(paEvent); })){
+        mCoalescedEvents.fetch_add(static_cast<TForteUInt32>(paNumEvents), std::memory_order_relaxed);
+        return;
+      }
+      break;
+    default:
+      break;
+  }
+  countDroppedEvent(mDroppedEvents, "Event queue is full, fan-out dropped!\n", static_cast<TForteUInt32>(paNumEvents));
+}
+
+bool CEventChainExecutionThread::handleExternalEventListOverflow(const TEventEntry &paEventToAdd, TExternalEventList &paExternalEventList){
+  switch(getOverflowPolicy()){
+    case EEventQueueOverflowPolicy::DropOldest: {
+      TEventEntry oldest;
+      if(paExternalEventList.pop(oldest) && paExternalEventList.push(paEventToAdd)){
+        countDroppedEvent(mDroppedExternalEvents, "External event queue is full, oldest external event dropped!\n");
+        return true;
+      }
+      break;
+    }
+    case EEventQueueOverflowPolicy::Coalesce:
+      if(paExternalEventList.contains(paEventToAdd)){
+        mCoalescedEvents.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      break;
+    case EEventQueueOverflowPolicy::BlockWithTimeout: {
+      if(isCurrentThread()){
+        //only this thread drains the list, waiting would stall it until the timeout
+        break;
+      }
+      uint_fast64_t deadline = getNanoSecondsMonotonic() + getBlockTimeout();
+      do{
+        resumeSelfSuspend(); //make sure the ECET is draining the list
+        CThread::sleepThread(1);
+        if(paExternalEventList.push(paEventToAdd)){
+          return true;
+        }
+      } while(getNanoSecondsMonotonic() < deadline);
+      break;
+    }
+    default:
+      break;
   }
+  countDroppedEvent(mDroppedExternalEvents, "External event queue is full, external event dropped!\n");
+  return false;
 }
 
-void CEventChainExecutionThread::startEventChain(TEventEntry paEventToAdd){
+void CEventChainExecutionThread::countDroppedEvent(std::atomic<TForteUInt32> &paCounter, const char *paMessage, TForteUInt32 paNumEvents){
+  if(0 == paCounter.fetch_add(paNumEvents, std::memory_order_relaxed)){
+    DEVLOG_ERROR("%s", paMessage);
+  }
+  (void)paMessage; //avoid unused warning if logging is disabled
+}
+
+SEventQueueStatistics CEventChainExecutionThread::getEventQueueStatistics() const {
+  SEventQueueStatistics statistics;
+  statistics.mEventListSize = mEventLists[0].getCapacity();
+  statistics.mEventListHighWaterMark = mEventListHighWaterMark.load(std::memory_order_relaxed);
+  statistics.mExternalEventListSize = TExternalEventList::getCapacity();
+  statistics.mExternalEventListHighWaterMark = mExternalEventListHighWaterMark.load(std::memory_order_relaxed);
+  statistics.mDroppedEvents = mDroppedEvents.load(std::memory_order_relaxed);
+  statistics.mDroppedExternalEvents = mDroppedExternalEvents.load(std::memory_order_relaxed);
+  statistics.mCoalescedEvents = mCoalescedEvents.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+void CEventChainExecutionThread::resetEventQueueStatistics(){
+  mEventListHighWaterMark.store(0, std::memory_order_relaxed);
+  mExternalEventListHighWaterMark.store(0, std::memory_order_relaxed);
+  mDroppedEvents.store(0, std::memory_order_relaxed);
+  mDroppedExternalEvents.store(0, std::memory_order_relaxed);
+  mCoalescedEvents.store(0, std::memory_order_relaxed);
+}
+
+void CEventChainExecutionThread::selfSuspend(){
+  mSuspended.store(true, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if(!externalEventOccured()){
+    mSuspendSemaphore.waitIndefinitely();
+  }
+  mSuspended.store(false, std::memory_order_relaxed);
+}
+
+void CEventChainExecutionThread::startEventChain(TEventEntry paEventToAdd, EEventChainPriority paPriority){
   FORTE_TRACE("CEventChainExecutionThread::startEventChain\n");
-  {
-    CCriticalRegion criticalRegion(mExternalEventListSync);
-    if(mExternalEventList.push(paEventToAdd)){
-      mProcessingEvents = true;
-      resumeSelfSuspend();
+  addExternalEvent(paEventToAdd, paPriority);
+}
+
+bool CEventChainExecutionThread::addExternalEvent(const TEventEntry &paEventToAdd, EEventChainPriority paPriority){
+  TExternalEventList &externalEventList = getExternalEventList(paPriority);
+  if(externalEventList.push(paEventToAdd) || handleExternalEventListOverflow(paEventToAdd, externalEventList)){
+    notifyExternalEvent();
+    return true;
+  }
+  return false;
+}
+
+bool CEventChainExecutionThread::startEventChains(const TEventEntry *paEventsToAdd, size_t paNumEvents, EEventChainPriority paPriority,
+    bool *paAdded){
+  if(0 == paNumEvents){
+    return true;
+  }
+  if(getExternalEventList(paPriority).pushAll(paEventsToAdd, paNumEvents)){
+    notifyExternalEvent();
+    if(nullptr != paAdded){
+      std::fill_n(paAdded, paNumEvents, true);
     }
-    else{
-      DEVLOG_ERROR("External event queue is full, external event dropped!\n");
+    return true;
+  }
+  //let the thread drain the list while the remaining events are added
+  notifyExternalEvent();
+  bool allAdded = true;
+  for(size_t i = 0; i < paNumEvents; ++i){
+    const bool added = addExternalEvent(paEventsToAdd[i], paPriority);
+    if(nullptr != paAdded){
+      paAdded[i] = added;
     }
-  } // End critical region
+    allAdded = added && allAdded;
+  }
+  return allAdded;
 }
 
 void CEventChainExecutionThread::changeExecutionState(EMGMCommandType paCommand){
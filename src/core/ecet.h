@@ -17,12 +17,59 @@
 #include "event.h"
 #include "datatypes/forte_time.h"
 #include "utils/ringbuf.h"
+#include "utils/mpscringbuf.h"
+#include "utils/segmentedringbuf.h"
 #include <forte_thread.h>
 #include <forte_sync.h>
 #include <forte_sem.h>
+#include <algorithm>
+#include <vector>
+
+/*! \ingroup CORE\brief Policy applied when one of the event lists of an ECET is full.
+ */
+enum class EEventQueueOverflowPolicy {
+  DropNewest, //!< discard the event to be added (default)
+  DropOldest, //!< discard the oldest queued event to make room for the new one
+  Coalesce, //!< discard the new event if the same FB/port is already queued, otherwise drop the new event
+  /*! wait for free space in the external event list up to the configured timeout, then drop the new event.
+   * The ECET's own event list can not block as the ECET is its own consumer, there this behaves like DropNewest. The
+   * same holds for external events added from the ECET's own thread, e.g., a local publish to a subscriber of the same
+   * resource.
+   */
+  BlockWithTimeout
+};
+
+/*! \ingroup CORE\brief Snapshot of the fill level and overflow counters of the event lists of an ECET.
+ */
+struct SEventQueueStatistics {
+  size_t mEventListSize; //!< capacity of the event list of one priority class
+  size_t mEventListHighWaterMark; //!< maximum number of entries seen in the event lists
+  size_t mExternalEventListSize; //!< capacity of the external event list of one priority class
+  size_t mExternalEventListHighWaterMark; //!< maximum number of external events transferred at once
+  TForteUInt32 mDroppedEvents; //!< events lost because the event list was full
+  TForteUInt32 mDroppedExternalEvents; //!< external events lost because the external event list was full
+  TForteUInt32 mCoalescedEvents; //!< events merged with an already queued event for the same FB/port
+};
+
+/*! \ingroup CORE\brief Work collected while an ECET delivers events and completed once it has no more events
+ *
+ * Allows, e.g., communication layers to coalesce the messages sent by the FBs executed in one event processing pass.
+ */
+class CDeferredFlush {
+  public:
+    virtual void flush() = 0;
+
+  protected:
+    ~CDeferredFlush() = default;
+};
 
 /*! \ingroup CORE\brief Class for executing one event chain.
  *
+ * Event chains are executed according to their priority class. Every priority class has its own external event list
+ * and event list. All events triggered while an event is delivered inherit the priority of this event. Before each
+ * event delivery the ECET takes over newly started event chains and then continues with the highest priority event.
+ * A newly started event chain therefore waits at most for the FB execution currently in progress, regardless of how
+ * many events of lower priority are queued.
  */
 class CEventChainExecutionThread : public CThread{
   public:
@@ -34,18 +81,104 @@ class CEventChainExecutionThread : public CThread{
      *
      * \param paEventToAdd event of the EC to start
      */
-    void startEventChain(TEventEntry paEventToAdd);
+    void startEventChain(TEventEntry paEventToAdd){
+      startEventChain(paEventToAdd, EEventChainPriority::Normal);
+    }
+
+    /*!\brief Start the a new event chain with the given event and priority class.
+     *
+     * \param paEventToAdd event of the EC to start
+     * \param paPriority priority class of the new event chain
+     */
+    virtual void startEventChain(TEventEntry paEventToAdd, EEventChainPriority paPriority);
+
+    /*!\brief Start several new event chains of the same priority class at once
+     *
+     * The events are added to the external event list with one reservation and the thread is woken only once. If the
+     * list can not take all of them, the thread is woken and the events are added one by one applying the overflow
+     * policy.
+     *
+     * \param paEventsToAdd contiguous list of the events of the ECs to start
+     * \param paNumEvents number of entries in paEventsToAdd
+     * \param paPriority priority class of the new event chains
+     * \param paAdded if not nullptr, receives for each event whether it has been added
+     * \return false if any of the events has been dropped
+     */
+    virtual bool startEventChains(const TEventEntry *paEventsToAdd, size_t paNumEvents, EEventChainPriority paPriority,
+        bool *paAdded = nullptr);
 
     /*!\brief Add an new event entry to the event chain
+     *
+     * The event inherits the priority of the event currently delivered.
      *
      * \param paEventToAdd new event entry
      */
     void addEventEntry(TEventEntry paEventToAdd){
-      if(!mEventList.push(paEventToAdd)){
-        DEVLOG_ERROR("Event queue is full, event dropped!\n");
+      addEventEntry(paEventToAdd, mCurrentPriority);
+    }
+
+    /*!\brief Add the events of a fan-out connection to the event chain
+     *
+     * The free space is checked once for all events. If the event list can not take all of them the overflow policy
+     * is applied to the fan-out as a whole, so an event is never delivered to only some of its destinations:
+     * DropOldest removes old events until the whole fan-out fits, Coalesce merges the fan-out only if all destinations
+     * are already queued, otherwise the whole fan-out is dropped.
+     *
+     * \param paEventsToAdd contiguous list of new event entries
+     * \param paNumEvents number of entries in paEventsToAdd
+     */
+    void addEventEntries(const TEventEntry *paEventsToAdd, size_t paNumEvents){
+      if(mEventLists[getPriorityIndex(mCurrentPriority)].pushAll(paEventsToAdd, paNumEvents)){
+        updateEventListHighWaterMark();
+      }
+      else{
+        handleFanOutOverflow(paEventsToAdd, paNumEvents);
       }
     }
 
+    /*!\brief Allow the event lists to grow beyond cgEventChainEventListSize
+     *
+     * When a fixed event list is full further events are stored in segments of cgEventChainEventListSegmentSize
+     * entries which are allocated on demand and freed again when the burst has been processed. Must be called before
+     * the ECET is started. Calling it again changes the limit as long as no events are stored in the segments.
+     *
+     * @param paMaxSegments maximum number of additional segments per priority class
+     */
+    void enableEventListGrowth(size_t paMaxSegments);
+
+    /*!\brief Set the policy applied when the event lists are full
+     *
+     * Can be changed while the ECET is running, event sources pick up the new policy with their next overflow.
+     *
+     * @param paPolicy the overflow policy to use
+     * @param paBlockTimeout maximum time in nanoseconds an event source waits for free space with BlockWithTimeout
+     */
+    void setOverflowPolicy(EEventQueueOverflowPolicy paPolicy, TForteUInt64 paBlockTimeout = 0){
+      mOverflowPolicy.store(paPolicy, std::memory_order_relaxed);
+      mBlockTimeout.store(paBlockTimeout, std::memory_order_relaxed);
+    }
+
+    EEventQueueOverflowPolicy getOverflowPolicy() const {
+      return mOverflowPolicy.load(std::memory_order_relaxed);
+    }
+
+    TForteUInt64 getBlockTimeout() const {
+      return mBlockTimeout.load(std::memory_order_relaxed);
+    }
+
+    //! true if called from the thread of this ECET
+    bool isCurrentThread() const;
+
+    /*!\brief Get the current fill level and overflow counters of the event lists
+     *
+     * Can be called from any thread. The values are read without locking and therefore form only an approximate
+     * snapshot.
+     */
+    SEventQueueStatistics getEventQueueStatistics() const;
+
+    //! Reset the high water marks and overflow counters
+    void resetEventQueueStatistics();
+
     /*!\brief allow to start, stop, and kill the execution of the event chain execution thread
      *
      * @param paCommand the management command to be executed
@@ -60,66 +193,277 @@ class CEventChainExecutionThread : public CThread{
       return mProcessingEvents;
     }
 
+    //! true if the thread is parked (or about to park) waiting for new external events
+    bool isSuspended() const {
+      return mSuspended.load(std::memory_order_relaxed);
+    }
+
     void resumeSelfSuspend(){
       mSuspendSemaphore.inc();
     }
 
+    /*!\brief Flush paFlush once this ECET has delivered all pending events
+     *
+     * Must only be called from within this ECET. Every registration results in one call of paFlush.flush().
+     */
+    void deferFlush(CDeferredFlush &paFlush){
+      mDeferredFlushes.push_back(&paFlush);
+    }
+
+    //! Drop the pending flushes of paFlush, must only be called from within this ECET or while it is stopped
+    void cancelFlush(CDeferredFlush &paFlush){
+      std::replace(mDeferredFlushes.begin(), mDeferredFlushes.end(), &paFlush, static_cast<CDeferredFlush*>(nullptr));
+    }
+
     static CEventChainExecutionThread* createEcet();
 
   protected:
-    /*! \brief List of input events to deliver.
+    /*! \brief Event list of one priority class
      *
-     * This list stores the necessary information for all events to deliver that occurred within this event chain.
+     * A fixed ring buffer which can optionally be extended by a CSegmentedRingBuffer taking the events that do not fit
+     * into the ring. Events go to the fixed ring as long as no events are waiting in the extension. This keeps all
+     * events in FIFO order as the fixed ring is always drained first. The fixed ring is allocated with the first event,
+     * so priority classes which are never used cost no ring.
      */
-    forte::core::util::CRingBuffer<TEventEntry, cgEventChainEventListSize> mEventList;
+    class CEventList {
+      public:
+        CEventList() : mFixed(nullptr), mExtension(nullptr) {
+        }
 
-    void mainRun();
+        ~CEventList() {
+          delete mFixed;
+          delete mExtension;
+        }
 
-  private:
-    /*! \brief The thread run()-method where the events are sent to the FBs and the FBs are executed in.
+        CEventList(const CEventList&) = delete;
+        CEventList& operator=(const CEventList&) = delete;
+
+        bool push(const TEventEntry &paEvent) {
+          TFixedEventList &fixed = getFixed();
+          if(nullptr == mExtension) {
+            return fixed.push(paEvent);
+          }
+          refillFixed();
+          return (mExtension->isEmpty() && fixed.push(paEvent)) || mExtension->push(paEvent);
+        }
+
+        //! Add all events or none of them, spilling into the extension as push() would do
+        bool pushAll(const TEventEntry *paEvents, size_t paNumEvents) {
+          TFixedEventList &fixed = getFixed();
+          if(nullptr == mExtension) {
+            return fixed.pushAll(paEvents, paNumEvents);
+          }
+          refillFixed();
+          if(!mExtension->isEmpty()) {
+            return mExtension->pushAll(paEvents, paNumEvents);
+          }
+          size_t numFixed = std::min(paNumEvents, fixed.getFreeSpace());
+          if(paNumEvents - numFixed > mExtension->getFreeSpace()) {
+            return false;
+          }
+          fixed.pushAll(paEvents, numFixed);
+          return mExtension->pushAll(paEvents + numFixed, paNumEvents - numFixed);
+        }
+
+        TEventEntry *pop() {
+          if(nullptr == mFixed) {
+            //the extension is only used once the fixed ring is full
+            return nullptr;
+          }
+          TEventEntry *event = mFixed->pop();
+          if(nullptr == event && nullptr != mExtension) {
+            event = mExtension->pop();
+          }
+          return event;
+        }
+
+        //! Remove the paNumEvents oldest events
+        void dropOldest(size_t paNumEvents) {
+          for(size_t i = 0; i < paNumEvents && nullptr != pop(); ++i) {
+          }
+        }
+
+        /*!\brief Add the given event, making room by dropping the oldest event if the list is full
+         *
+         * \return true if an event has been dropped
+         */
+        bool replaceOldest(const TEventEntry &paEvent) {
+          const bool full = (0 == getFreeSpace());
+          if(full) {
+            pop();
+          }
+          push(paEvent);
+          return full;
+        }
+
+        bool contains(const TEventEntry &paEvent) const {
+          return (nullptr != mFixed && mFixed->contains(paEvent)) || (nullptr != mExtension && mExtension->contains(paEvent));
+        }
+
+        bool isEmpty() const {
+          return 0 == getNumberOfElements();
+        }
+
+        size_t getNumberOfElements() const {
+          return ((nullptr != mFixed) ? mFixed->getNumberOfElements() : 0) +
+              ((nullptr != mExtension) ? mExtension->getNumberOfElements() : 0);
+        }
+
+        size_t getCapacity() const {
+          return TFixedEventList::getCapacity() + ((nullptr != mExtension) ? mExtension->getMaxCapacity() : 0);
+        }
+
+        size_t getFreeSpace() const {
+          return getCapacity() - getNumberOfElements();
+        }
+
+        void enableGrowth(size_t paMaxSegments) {
+          if(nullptr != mExtension) {
+            if(!mExtension->isEmpty()) {
+              return; //events are still stored in the extension, keep its current limit
+            }
+            delete mExtension;
+          }
+          mExtension = new forte::core::util::CSegmentedRingBuffer<TEventEntry, cgEventChainEventListSegmentSize>(paMaxSegments);
+        }
+
+        void clear() {
+          if(nullptr != mFixed) {
+            mFixed->clear();
+          }
+          if(nullptr != mExtension) {
+            mExtension->clear();
+          }
+        }
+
+      private:
+        typedef forte::core::util::CRingBuffer<TEventEntry, cgEventChainEventListSize> TFixedEventList;
+
+        TFixedEventList &getFixed() {
+          if(nullptr == mFixed) {
+            mFixed = new TFixedEventList();
+          }
+          return *mFixed;
+        }
+
+        //! Move the oldest events of the extension into the space popping has freed in mFixed, keeping the FIFO order
+        void refillFixed() {
+          while(!mExtension->isEmpty() && 0 != mFixed->getFreeSpace()) {
+            mFixed->push(*mExtension->pop());
+          }
+        }
+
+        TFixedEventList *mFixed; //!< nullptr until the first event is added
+        //! Segmented extension taking the events that do not fit into mFixed, nullptr if growth is not enabled
+        forte::core::util::CSegmentedRingBuffer<TEventEntry, cgEventChainEventListSegmentSize> *mExtension;
+    };
+
+    typedef forte::core::util::CMPSCRingBuffer<TEventEntry, cgEventChainExternalEventListSize> TExternalEventList;
+
+    static const size_t scmNumberOfPriorities = static_cast<size_t>(EEventChainPriority::High) + 1;
+
+    static size_t getPriorityIndex(EEventChainPriority paPriority) {
+      return static_cast<size_t>(paPriority);
+    }
+
+    /*! \brief Lists of input events to deliver, one per priority class.
      *
-     * If there is an entry in the Event List the event will be delivered and the FB executed.
-     * If there is no entry in this list the CEventChainExecutionThread will suspend itself and remove itself from the
-     * active EventChainExecutionlist in CFBNExecution.
-     * \return true if thread execution ended successfully
+     * These lists store the necessary information for all events to deliver that occurred within this event chain.
      */
-    void run() override;
+    CEventList mEventLists[scmNumberOfPriorities];
 
-    void onAliveChanged(bool paNewValue) override;
+    //! Priority class of the event currently delivered, events added during its execution inherit it
+    EEventChainPriority mCurrentPriority;
 
-    /*! \brief Clear the event chain.
-     */
-    void clear();
+    void mainRun();
+
+    //! Register this ECET as the one running on the calling thread, to be called first in run()
+    void setAsCurrentThread() const;
+
+    //! Add an event to the event list of the given priority class
+    void addEventEntry(const TEventEntry &paEventToAdd, EEventChainPriority paPriority){
+      if(mEventLists[getPriorityIndex(paPriority)].push(paEventToAdd)){
+        updateEventListHighWaterMark();
+      }
+      else{
+        handleEventListOverflow(paEventToAdd, paPriority);
+      }
+    }
+
+    //! Take the next event of the highest priority class which has events pending and make it the current priority
+    TEventEntry *popEventEntry(){
+      for(size_t i = scmNumberOfPriorities; i > 0; --i){
+        TEventEntry *event = mEventLists[i - 1].pop();
+        if(nullptr != event){
+          mCurrentPriority = static_cast<EEventChainPriority>(i - 1);
+          return event;
+        }
+      }
+      return nullptr;
+    }
 
     bool externalEventOccured() const {
-      /* we should not need a protection here as we are just comparing the both
-       * the only value that could change during the compare is mExternalEventListEnd. In the worst case
-       * this results in a to early or to late detection. However as the transfer is protected this should be no
-       * big issue.
-       * TODO perform test to verify this assumption
-       */
-      return !mExternalEventList.isEmpty();
+      for(size_t i = 0; i < scmNumberOfPriorities; ++i){
+        const TExternalEventList *externalEventList = findExternalEventList(i);
+        if(nullptr != externalEventList && !externalEventList->isEmpty()){
+          return true;
+        }
+      }
+      return false;
     }
 
-    //! Transfer elements stored in the external event list to the main event list
+    //! Get the external event list of a priority class, the lists of Low and High are allocated on their first use
+    TExternalEventList &getExternalEventList(EEventChainPriority paPriority);
+
+    //! nullptr if no event of this priority class has been started yet
+    TExternalEventList *findExternalEventList(size_t paIndex) const {
+      return mExternalEventLists[paIndex].load(std::memory_order_acquire);
+    }
+
+    /*!\brief Add an event to the external event list of the given priority class and wake the thread
+     *
+     * \return false if the event has been dropped according to the overflow policy
+     */
+    bool addExternalEvent(const TEventEntry &paEventToAdd, EEventChainPriority paPriority);
+
+    //! Transfer elements stored in the external event lists to the event lists of the same priority class
     void transferExternalEvents();
 
-    void selfSuspend(){
-      mSuspendSemaphore.waitIndefinitely();
+    //! Wake the thread after an event has been pushed to one of its external event lists
+    void notifyExternalEvent(){
+      mProcessingEvents = true;
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if(mSuspended.load(std::memory_order_relaxed)){
+        resumeSelfSuspend();
+      }
+    }
+
+    //! Carry out the deferred flushes, called whenever the event lists ran empty
+    void flushDeferred(){
+      if(!mDeferredFlushes.empty()){
+        runDeferredFlushes();
+      }
     }
 
-    /*! \brief List of external events that occurred during one FB's execution
+    /*! \brief Park the thread until a new external event arrives
      *
-     * This list stores external events that may have occurred during the execution of a FB or during when the
-     * Event-Chain execution was sleeping. with this second list we omit the need for a mutex protection of the event
-     * list. This is a great performance gain.
+     * mSuspended is published before the external event lists are checked a last time. Together with the fence in
+     * startEventChain this guarantees that either the consumer sees the new event or the producer sees the parked
+     * flag, so no wake-up can get lost.
      */
-    forte::core::util::CRingBuffer<TEventEntry, cgEventChainExternalEventListSize> mExternalEventList;
+    void selfSuspend();
 
-    //! SyncObject for protecting the list in regard to several accesses
-    CSyncObject mExternalEventListSync;
+    /*! \brief Lists of external events that occurred during one FB's execution, one per priority class
+     *
+     * These lists store external events that may have occurred during the execution of a FB or during when the
+     * Event-Chain execution was sleeping. with these second lists we omit the need for a mutex protection of the event
+     * lists. They are lock-free so that several event sources (e.g., timer and network handlers) can add events
+     * concurrently without serializing on a mutex.
+     */
+    std::atomic<TExternalEventList *> mExternalEventLists[scmNumberOfPriorities];
 
-    forte::arch::CSemaphore mSuspendSemaphore;
+    //! the external event list of the Normal class, which nearly all event sources use
+    TExternalEventList mNormalExternalEventList;
 
     /*! \brief Flag indicating if this event chain execution thread is currently processing any events
      *
@@ -130,6 +474,77 @@ class CEventChainExecutionThread : public CThread{
      * TODO consider surrounding the usage points of this flag with #defines such that it is only used for testing.
      */
     bool mProcessingEvents;
+
+  private:
+    void updateEventListHighWaterMark(){
+      //only the ECET itself adds to the event list, therefore relaxed load and store are sufficient
+      size_t fillLevel = getEventListFillLevel();
+      if(fillLevel > mEventListHighWaterMark.load(std::memory_order_relaxed)){
+        mEventListHighWaterMark.store(fillLevel, std::memory_order_relaxed);
+      }
+    }
+
+    size_t getEventListFillLevel() const {
+      size_t fillLevel = 0;
+      for(const CEventList &eventList : mEventLists){
+        fillLevel += eventList.getNumberOfElements();
+      }
+      return fillLevel;
+    }
+
+    /*! \brief The thread run()-method where the events are sent to the FBs and the FBs are executed in.
+     *
+     * If there is an entry in the Event List the event will be delivered and the FB executed.
+     * If there is no entry in this list the CEventChainExecutionThread will suspend itself and remove itself from the
+     * active EventChainExecutionlist in CFBNExecution.
+     * \return true if thread execution ended successfully
+     */
+    void run() override;
+
+    void onAliveChanged(bool paNewValue) override;
+
+    /*! \brief Clear the event chain.
+     */
+    void clear();
+
+    void runDeferredFlushes();
+
+    //! Apply the overflow policy for an event that did not fit into the event list of its priority class
+    void handleEventListOverflow(const TEventEntry &paEventToAdd, EEventChainPriority paPriority);
+
+    //! Apply the overflow policy to a fan-out that did not fit into the event list as a whole
+    void handleFanOutOverflow(const TEventEntry *paEventsToAdd, size_t paNumEvents);
+
+    /*! \brief Apply the overflow policy for an external event that did not fit into the external event list
+     *
+     * \return true if the event could be added to the external event list after all
+     */
+    bool handleExternalEventListOverflow(const TEventEntry &paEventToAdd, TExternalEventList &paExternalEventList);
+
+    /*!\brief Count one lost event
+     *
+     * Only the first loss of a counter is logged. Further losses are only counted to keep the global log lock off the
+     * hot path. The counters can be read with getEventQueueStatistics().
+     */
+    static void countDroppedEvent(std::atomic<TForteUInt32> &paCounter, const char *paMessage, TForteUInt32 paNumEvents = 1);
+
+    forte::arch::CSemaphore mSuspendSemaphore;
+
+    //! Flag indicating that the thread is parked (or about to park) on mSuspendSemaphore and needs to be signaled
+    std::atomic<bool> mSuspended;
+
+    std::atomic<EEventQueueOverflowPolicy> mOverflowPolicy;
+    std::atomic<TForteUInt64> mBlockTimeout; //!< maximum wait time in nanoseconds for EEventQueueOverflowPolicy::BlockWithTimeout
+
+    std::atomic<size_t> mEventListHighWaterMark;
+    std::atomic<size_t> mExternalEventListHighWaterMark;
+    std::atomic<TForteUInt32> mDroppedEvents;
+    std::atomic<TForteUInt32> mDroppedExternalEvents;
+    std::atomic<TForteUInt32> mCoalescedEvents;
+
+    //! Flushes registered with deferFlush in registration order, cancelled entries are nullptr
+    std::vector<CDeferredFlush*> mDeferredFlushes;
+
 };
 
 #endif /*ECET_H_*/
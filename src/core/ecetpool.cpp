@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include "ecetpool.h"
+#include "funcbloc.h"
+
+class CEventChainExecutionThreadPool::CWorker : public CEventChainExecutionThread {
+  public:
+    explicit CWorker(CEventChainExecutionThreadPool &paPool) :
+        mPool(paPool) {
+    }
+
+    ~CWorker() override {
+      //stop the thread while our run() and onAliveChanged() are still in place
+      end();
+    }
+
+    using CEventChainExecutionThread::startEventChain;
+
+    void startEventChain(TEventEntry paEventToAdd, EEventChainPriority paPriority) override {
+      mPool.dispatchEventChain(paEventToAdd, paPriority);
+    }
+
+    //! the chains are distributed to the workers one by one, so that idle siblings can take some of them
+    bool startEventChains(const TEventEntry *paEventsToAdd, size_t paNumEvents, EEventChainPriority paPriority,
+        bool *paAdded = nullptr) override {
+      bool allAdded = true;
+      for(size_t i = 0; i < paNumEvents; ++i) {
+        const bool added = mPool.dispatchEventChain(paEventsToAdd[i], paPriority);
+        if(nullptr != paAdded) {
+          paAdded[i] = added;
+        }
+        allAdded = added && allAdded;
+      }
+      return allAdded;
+    }
+
+    //! add a new event chain to this worker's own external event lists, false if it has been dropped
+    bool enqueueEventChain(const TEventEntry &paEventToAdd, EEventChainPriority paPriority) {
+      return addExternalEvent(paEventToAdd, paPriority);
+    }
+
+    //! add a new event chain only if the external event list has room for it, the overflow policy is not applied
+    bool tryEnqueueEventChain(const TEventEntry &paEventToAdd, EEventChainPriority paPriority) {
+      if(!getExternalEventList(paPriority).push(paEventToAdd)) {
+        return false;
+      }
+      notifyExternalEvent();
+      return true;
+    }
+
+    //! parked and not yet handed any new event chain
+    bool isIdle() const {
+      return isSuspended() && !externalEventOccured();
+    }
+
+    //! the external event lists support concurrent consumers, so siblings may take event chains from them
+    bool giveEventChain(TEventEntry &paEvent, EEventChainPriority paPriority) {
+      TExternalEventList *externalEventList = findExternalEventList(getPriorityIndex(paPriority));
+      return (nullptr != externalEventList) && externalEventList->pop(paEvent);
+    }
+
+  private:
+    void run() override;
+
+    CEventChainExecutionThreadPool &mPool;
+};
+
+void CEventChainExecutionThreadPool::CWorker::run(){
+  setAsCurrentThread();
+  while(isAlive()){
+    if(externalEventOccured()){
+      transferExternalEvents();
+    }
+    TEventEntry *event = popEventEntry();
+    if(nullptr != event){
+      mPool.executeEvent(*event, *this);
+      continue;
+    }
+    TEventEntry stolen;
+    EEventChainPriority priority;
+    if(mPool.stealEventChain(*this, stolen, priority)){
+      addEventEntry(stolen, priority);
+    }
+    else{
+      flushDeferred();
+      mProcessingEvents = false;
+      selfSuspend();
+      mProcessingEvents = true;
+    }
+  }
+}
+
+CEventChainExecutionThreadPool::CEventChainExecutionThreadPool(size_t paNumberOfWorkers) :
+    mNextWorker(0){
+  for(std::atomic<bool> &lock : mFBLocks){
+    lock.store(false, std::memory_order_relaxed);
+  }
+  if(0 == paNumberOfWorkers){
+    paNumberOfWorkers = 1;
+  }
+  mWorkers.reserve(paNumberOfWorkers);
+  for(size_t i = 0; i < paNumberOfWorkers; ++i){
+    mWorkers.push_back(new CWorker(*this));
+  }
+}
+
+CEventChainExecutionThreadPool::~CEventChainExecutionThreadPool(){
+  //all workers have to be stopped before the first one is deleted as they steal from each other
+  changeExecutionState(EMGMCommandType::Stop);
+  for(CWorker *worker : mWorkers){
+    worker->end();
+  }
+  for(CWorker *worker : mWorkers){
+    delete worker;
+  }
+}
+
+CEventChainExecutionThread *CEventChainExecutionThreadPool::getWorker(size_t paIndex) const {
+  return (paIndex < mWorkers.size()) ? mWorkers[paIndex] : nullptr;
+}
+
+void CEventChainExecutionThreadPool::changeExecutionState(EMGMCommandType paCommand){
+  for(CWorker *worker : mWorkers){
+    worker->changeExecutionState(paCommand);
+  }
+}
+
+bool CEventChainExecutionThreadPool::isProcessingEvents() const {
+  for(const CWorker *worker : mWorkers){
+    if(worker->isProcessingEvents()){
+      return true;
+    }
+  }
+  return false;
+}
+
+bool CEventChainExecutionThreadPool::dispatchEventChain(const TEventEntry &paEventToAdd, EEventChainPriority paPriority){
+  size_t numWorkers = mWorkers.size();
+  size_t start = mNextWorker.fetch_add(1, std::memory_order_relaxed);
+  for(size_t i = 0; i < numWorkers; ++i){
+    CWorker *worker = mWorkers[(start + i) % numWorkers];
+    if(worker->isIdle() && worker->tryEnqueueEventChain(paEventToAdd, paPriority)){
+      return true;
+    }
+  }
+  //a parked worker stays suspended until it is scheduled, so skip workers whose external event list is full
+  for(size_t i = 0; i < numWorkers; ++i){
+    if(mWorkers[(start + i) % numWorkers]->tryEnqueueEventChain(paEventToAdd, paPriority)){
+      return true;
+    }
+  }
+  return mWorkers[start % numWorkers]->enqueueEventChain(paEventToAdd, paPriority);
+}
+
+bool CEventChainExecutionThreadPool::stealEventChain(const CWorker &paThief, TEventEntry &paEvent, EEventChainPriority &paPriority){
+  for(int priority = static_cast<int>(EEventChainPriority::High); priority >= 0; --priority){
+    paPriority = static_cast<EEventChainPriority>(priority);
+    for(CWorker *victim : mWorkers){
+      if(victim != &paThief && victim->giveEventChain(paEvent, paPriority)){
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void CEventChainExecutionThreadPool::executeEvent(const TEventEntry &paEvent, CEventChainExecutionThread &paECET){
+  //copy the entry as delivering the event may add new entries to the worker's event list
+  CFunctionBlock *fb = paEvent.mFB;
+  TPortId portId = paEvent.mPortId;
+  std::atomic<bool> &fbLock = getFBLock(fb);
+  while(fbLock.exchange(true, std::memory_order_acquire)){
+    CThread::sleepThread(0);
+  }
+  fb->receiveInputEvent(portId, &paECET);
+  fbLock.store(false, std::memory_order_release);
+}
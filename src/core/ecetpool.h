@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#ifndef _ECETPOOL_H_
+#define _ECETPOOL_H_
+
+#include "ecet.h"
+#include <atomic>
+#include <vector>
+
+class CFunctionBlock;
+
+/*! \ingroup CORE\brief Pool of event chain execution threads executing the event chains of one resource in parallel.
+ *
+ * Every worker is a full CEventChainExecutionThread. New event chains started on any worker are placed on an idle
+ * worker if there is one, otherwise they are distributed round robin. A worker running out of events steals pending
+ * event chain starts from the external event lists of its siblings. Once started, an event chain stays on its worker.
+ *
+ * An FB is executed by one worker at a time: before delivering an event a worker acquires the ownership lock of the
+ * receiving FB. FBs are mapped onto a fixed set of lock stripes, so unrelated FBs may occasionally wait for each
+ * other. A worker holds at most one of these locks at a time, so they can not dead-lock among themselves.
+ *
+ * The FB locks only serialize the execution of each FB, they do not protect data connections. The source FB writes
+ * its outputs while holding its own lock and the destination FB reads its inputs while holding another one. If the
+ * two run on different workers at the same time, the transfer is a data race and the destination may read a partly
+ * written value. Event chains running in parallel therefore must not exchange data with each other, i.e., the pool
+ * is only suitable for resources hosting independent event chains.
+ */
+class CEventChainExecutionThreadPool {
+  public:
+    explicit CEventChainExecutionThreadPool(size_t paNumberOfWorkers);
+    ~CEventChainExecutionThreadPool();
+
+    size_t getNumberOfWorkers() const {
+      return mWorkers.size();
+    }
+
+    /*!\brief Get one of the workers
+     *
+     * Any worker can be handed out as event chain executor to event source FBs, starting an event chain on it will
+     * dispatch the chain within the whole pool.
+     */
+    CEventChainExecutionThread *getWorker(size_t paIndex) const;
+
+    //! start, stop, or kill all workers
+    void changeExecutionState(EMGMCommandType paCommand);
+
+    //! true if any of the workers is processing events
+    bool isProcessingEvents() const;
+
+    CEventChainExecutionThreadPool(const CEventChainExecutionThreadPool&) = delete;
+    CEventChainExecutionThreadPool& operator=(const CEventChainExecutionThreadPool&) = delete;
+
+  private:
+    class CWorker;
+
+    /*!\brief place a new event chain on an idle worker or, if all workers are busy, on the next worker in round robin
+     * order that has room for it. Only if all external event lists are full the overflow policy is applied.
+     *
+     * \return false if the event chain has been dropped
+     */
+    bool dispatchEventChain(const TEventEntry &paEventToAdd, EEventChainPriority paPriority);
+
+    //! take a pending event chain start, preferring the highest priority, from one of the other workers
+    bool stealEventChain(const CWorker &paThief, TEventEntry &paEvent, EEventChainPriority &paPriority);
+
+    //! deliver the event while holding the ownership lock of the receiving FB
+    void executeEvent(const TEventEntry &paEvent, CEventChainExecutionThread &paECET);
+
+    std::atomic<bool> &getFBLock(const CFunctionBlock *paFB) {
+      return mFBLocks[(reinterpret_cast<uintptr_t>(paFB) >> 4) % scmNumberOfFBLocks];
+    }
+
+    static const size_t scmNumberOfFBLocks = 256;
+
+    std::vector<CWorker*> mWorkers;
+    std::atomic<size_t> mNextWorker;
+    std::atomic<bool> mFBLocks[scmNumberOfFBLocks];
+};
+
+#endif /*_ECETPOOL_H_*/
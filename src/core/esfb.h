@@ -25,13 +25,15 @@ private:
  */
   CEventChainExecutionThread *mEventChainExecutor;
   TEventEntry mEventSourceEventEntry; //! the event entry to start the event chain
+  EEventChainPriority mEventChainPriority; //! priority class of the event chains started by this ES
 
 public:
   CEventSourceFB(forte::core::CFBContainer &paContainer, const SFBInterfaceSpec *paInterfaceSpec,
                  CStringDictionary::TStringId paInstanceNameId) :
           CFunctionBlock(paContainer, paInterfaceSpec, paInstanceNameId),
           mEventChainExecutor(nullptr),
-          mEventSourceEventEntry(this, cgExternalEventID) {
+          mEventSourceEventEntry(this, cgExternalEventID),
+          mEventChainPriority(EEventChainPriority::Normal) {
   }
 
   ~CEventSourceFB() override = default;
@@ -39,6 +41,9 @@ public:
   CEventChainExecutionThread * getEventChainExecutor() { return mEventChainExecutor; };
 
   TEventEntry *getEventSourceEventEntry() { return &mEventSourceEventEntry; };
+
+  void setEventChainPriority(EEventChainPriority paPriority) { mEventChainPriority = paPriority; };
+  EEventChainPriority getEventChainPriority() const { return mEventChainPriority; };
 };
 
 #define EVENT_SOURCE_FUNCTION_BLOCK_CTOR(fbclass) \
@@ -40,6 +40,17 @@ const TPortId cgInternal2InterfaceRemovalMask = cgInvalidPortId;
 static_assert((cgInternal2InterfaceRemovalMask & (cgInternal2InterfaceRemovalMask + 1)) == 0,
               "cgInternal2InterfaceRemovalMask must be a valid bitmask");
 
+/*!\ingroup CORE \brief Priority classes of event chains.
+ *
+ * Events of a higher priority class are delivered before queued events of lower priority classes. Event chains are
+ * preempted only between two FB executions.
+ */
+enum class EEventChainPriority {
+  Low, //!< background chains, e.g., logging or housekeeping
+  Normal, //!< default priority class of all event chains
+  High //!< time critical chains, e.g., triggered by fieldbus or process inputs
+};
+
 /*!\ingroup CORE \brief Structure to hold the information needed for delivering input events to FBs.
 */
 typedef CConnectionPoint TEventEntry;
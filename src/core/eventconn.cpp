@@ -53,10 +53,8 @@ EMGMResponse CEventConnection::disconnect(CFunctionBlock *paDstFB, CStringDictio
 }
 
 void CEventConnection::triggerEvent(CEventChainExecutionThread *paExecEnv) const {
-  if(paExecEnv != nullptr){
-    for(const auto& runner : mDestinationIds){
-      paExecEnv->addEventEntry(runner);
-    }
+  if(paExecEnv != nullptr && !mDestinationIds.empty()){
+    paExecEnv->addEventEntries(mDestinationIds.data(), mDestinationIds.size());
   }
 }
 
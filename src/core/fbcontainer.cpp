@@ -46,6 +46,10 @@ CFBContainer::CFBContainer(CStringDictionary::TStringId paContainerName, CFBCont
 }
 
 CFBContainer::~CFBContainer() {
+  deleteContainedFBs();
+}
+
+void CFBContainer::deleteContainedFBs() {
   for (TFunctionBlockList::iterator itRunner(mFunctionBlocks.begin()); itRunner != mFunctionBlocks.end(); ++itRunner) {
     CTypeLib::deleteFB(*itRunner);
   }
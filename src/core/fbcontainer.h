@@ -24,6 +24,9 @@ class CDevice;
 
 namespace forte {
   namespace core {
+    namespace util {
+      class CArena;
+    }
 
     class CFBContainer{
       public:
@@ -58,12 +61,20 @@ namespace forte {
           return mFunctionBlocks;
         }
 
+        const TFunctionBlockList &getFBList() const {
+          return mFunctionBlocks;
+        }
+
         typedef std::vector<CFBContainer *> TFBContainerList;
 
         TFBContainerList &getSubContainerList(){
           return mSubContainers;
         }
 
+        const TFBContainerList &getSubContainerList() const {
+          return mSubContainers;
+        }
+
         CFBContainer& getParent() const { return mParent;}
 
         virtual CResource* getResource(){
@@ -80,6 +91,11 @@ namespace forte {
           return const_cast<CFBContainer*>(this)->getDevice();
         }
 
+        //! the arena the FBs of this container and their interface data are allocated from, nullptr if they are allocated on the heap
+        virtual util::CArena *getFBArena(){
+          return mParent.getFBArena();
+        }
+
         virtual std::string getFullQualifiedApplicationInstanceName(const char sepChar) const;
 
       protected:
@@ -121,6 +137,9 @@ namespace forte {
         //! Change the execution state of all contained FBs and also recursively in all contained containers
         EMGMResponse changeContainedFBsExecutionState(EMGMCommandType paCommand);
 
+        //! Delete all contained FBs and containers, for derived classes which have to do this before their own members are gone
+        void deleteContainedFBs();
+
       private:
         /*!\brief Retrieve a FBContainer with given name. If it does not exist create it.
          *
@@ -26,6 +26,7 @@
 #include "device.h"
 #include "connectiondestinationtype.h"
 #include "utils/criticalregion.h"
+#include "utils/arena.h"
 #include "../arch/timerha.h"
 #include <string.h>
 #include <stdlib.h>
@@ -41,7 +42,7 @@ CFunctionBlock::CFunctionBlock(forte::core::CFBContainer &paContainer, const SFB
         mInterfaceSpec(paInterfaceSpec),
         mEOConns(nullptr), mDIConns(nullptr), mDOConns(nullptr), mDIs(nullptr), mDOs(nullptr),
         mAdapters(nullptr),
-        mFBConnData(nullptr), mFBVarsData(nullptr),
+        mFBConnData(nullptr), mFBVarsData(nullptr), mFBConnDataSize(0), mFBVarsDataSize(0), mDataArena(nullptr),
         mContainer(paContainer),
 #ifdef FORTE_SUPPORT_MONITORING
         mEOMonitorCount(nullptr), mEIMonitorCount(nullptr),
@@ -60,6 +61,73 @@ CFunctionBlock::~CFunctionBlock(){
   freeAllData();
 }
 
+namespace {
+  //! without a resource arena chunk size FBs and their data are always allocated on the heap and carry no header
+  constexpr bool scmFBArenas = (0 != cgResourceArenaChunkSize);
+
+  //! placed in front of every FB if arenas are configured, tells operator delete where the FB's memory came from
+  union UFBAllocationHeader {
+    struct {
+      forte::core::util::CArena *mArena; //!< nullptr if the FB is allocated on the heap
+      size_t mSize; //!< bytes allocated from the arena, including the header
+    } mOrigin;
+    std::max_align_t mAlignment;
+  };
+}
+
+void *CFunctionBlock::operator new(size_t paSize, forte::core::CFBContainer &paContainer) {
+  forte::core::util::CArena *arena = scmFBArenas ? paContainer.getFBArena() : nullptr;
+  if(nullptr == arena) {
+    return operator new(paSize);
+  }
+  const size_t size = sizeof(UFBAllocationHeader) + paSize;
+  UFBAllocationHeader *header = new(arena->allocate(size)) UFBAllocationHeader;
+  header->mOrigin.mArena = arena;
+  header->mOrigin.mSize = size;
+  return header + 1;
+}
+
+void *CFunctionBlock::operator new(size_t paSize) {
+  if constexpr (!scmFBArenas) {
+    return ::operator new(paSize);
+  }
+  UFBAllocationHeader *header = new(::operator new(sizeof(UFBAllocationHeader) + paSize)) UFBAllocationHeader;
+  header->mOrigin.mArena = nullptr;
+  header->mOrigin.mSize = 0;
+  return header + 1;
+}
+
+void CFunctionBlock::operator delete(void *paMemory) {
+  if constexpr (!scmFBArenas) {
+    ::operator delete(paMemory);
+    return;
+  }
+  if(nullptr != paMemory) {
+    UFBAllocationHeader *header = static_cast<UFBAllocationHeader *>(paMemory) - 1;
+    if(nullptr != header->mOrigin.mArena) {
+      header->mOrigin.mArena->deallocate(header, header->mOrigin.mSize);
+    } else {
+      ::operator delete(header);
+    }
+  }
+}
+
+void CFunctionBlock::operator delete(void *paMemory, forte::core::CFBContainer &) {
+  operator delete(paMemory);
+}
+
+void *CFunctionBlock::allocateFBData(size_t paSize) {
+  return (nullptr != mDataArena) ? mDataArena->allocate(paSize) : ::operator new(paSize);
+}
+
+void CFunctionBlock::freeFBData(void *paData, size_t paSize) {
+  if(nullptr != mDataArena) {
+    mDataArena->deallocate(paData, paSize);
+  } else {
+    ::operator delete(paData);
+  }
+}
+
 void CFunctionBlock::freeAllData(){
   if(nullptr != mInterfaceSpec){
     if(nullptr != mEOConns) {
@@ -96,12 +164,14 @@ void CFunctionBlock::freeAllData(){
         delete mAdapters[i];
       }
     }
-  }
 
-  operator delete(mFBConnData);
+    freeFBData(mFBConnData, mFBConnDataSize);
+    freeFBData(mFBVarsData, mFBVarsDataSize);
+  }
   mFBConnData = nullptr;
-  operator delete(mFBVarsData);
   mFBVarsData = nullptr;
+  mFBConnDataSize = 0;
+  mFBVarsDataSize = 0;
 
 #ifdef  FORTE_SUPPORT_MONITORING
   delete[] mEOMonitorCount;
@@ -594,12 +664,13 @@ void CFunctionBlock::setupFBInterface(const SFBInterfaceSpec *paInterfaceSpec) {
   freeAllData();
 
   mInterfaceSpec = const_cast<SFBInterfaceSpec *>(paInterfaceSpec);
+  mDataArena = scmFBArenas ? mContainer.getFBArena() : nullptr;
 
   if (nullptr != paInterfaceSpec) {
-    size_t connDataSize = calculateFBConnDataSize(*paInterfaceSpec);
-    size_t varsDataSize = calculateFBVarsDataSize(*paInterfaceSpec);
-    mFBConnData = connDataSize ? operator new(connDataSize) : nullptr;
-    mFBVarsData = varsDataSize ? operator new(varsDataSize) : nullptr;
+    mFBConnDataSize = calculateFBConnDataSize(*paInterfaceSpec);
+    mFBVarsDataSize = calculateFBVarsDataSize(*paInterfaceSpec);
+    mFBConnData = mFBConnDataSize ? allocateFBData(mFBConnDataSize) : nullptr;
+    mFBVarsData = mFBVarsDataSize ? allocateFBData(mFBVarsDataSize) : nullptr;
 
     auto *connData = reinterpret_cast<TForteByte *>(mFBConnData);
     auto *varsData = reinterpret_cast<TForteByte *>(mFBVarsData);
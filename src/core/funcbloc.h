@@ -45,6 +45,12 @@ typedef CFunctionBlock *TFunctionBlockPtr;
 namespace forte {
   namespace core {
     class CFBContainer;
+    namespace util {
+      class CArena;
+    }
+  }
+  namespace com_infra {
+    class CBaseCommFB;
   }
 }
 
@@ -130,6 +136,16 @@ class CFunctionBlock {
 
     virtual ~CFunctionBlock();
 
+    /*!\brief Allocate an FB in the arena of the container it is created in
+     *
+     * The type lib creates all FBs and adapters with this operator. If the container has no arena, or arenas are
+     * disabled with a cgResourceArenaChunkSize of 0, the FB is allocated on the heap.
+     */
+    static void *operator new(size_t paSize, forte::core::CFBContainer &paContainer);
+    static void *operator new(size_t paSize);
+    static void operator delete(void *paMemory);
+    static void operator delete(void *paMemory, forte::core::CFBContainer &paContainer);
+
     /*!\brief Get the resource the function block is contained in.
      */
     virtual CResource* getResource();
@@ -154,6 +170,15 @@ class CFunctionBlock {
      */
     virtual CStringDictionary::TStringId getFBTypeId() const = 0;
 
+    /*!\brief Get this FB as communication FB
+     *
+     * Lets the runtime find the communication FBs of a container without RTTI.
+     * \return this FB if it is a communication FB, nullptr otherwise
+     */
+    virtual const forte::com_infra::CBaseCommFB *asCommFB() const {
+      return nullptr;
+    }
+
 
     /*!\brief Returns the type name of this FB instance
      */
@@ -641,6 +666,11 @@ class CFunctionBlock {
 
     void freeAllData();
 
+    //! Allocate a data buffer for this FB, from the arena of its container if there is one
+    void *allocateFBData(size_t paSize);
+    //! Free a buffer of paSize bytes allocated with allocateFBData, nullptr is ignored
+    void freeFBData(void *paData, size_t paSize);
+
     const SFBInterfaceSpec *mInterfaceSpec; //!< Pointer to the interface specification
     CEventConnection *mEOConns; //!< A list of event connections pointers storing for each event output the event connection. If the output event is not connected the pointer is nullptr.
     CDataConnection **mDIConns; //!< A list of data connections pointers storing for each data input the data connection. If the data input is not connected the pointer is nullptr.
@@ -650,6 +680,9 @@ class CFunctionBlock {
     CAdapter **mAdapters; //!< A list of pointers to the adapters. This allows to implement a general getAdapter().
     void *mFBConnData; //!< Connection data buffer
     void *mFBVarsData; //!< Variable data buffer
+    size_t mFBConnDataSize; //!< Size of mFBConnData, recorded as derived classes may free their interface spec before freeAllData()
+    size_t mFBVarsDataSize; //!< Size of mFBVarsData
+    forte::core::util::CArena *mDataArena; //!< the arena the data buffers are allocated from, nullptr for the heap
   private:
 
     /*!\brief Function providing the functionality of the FB (e.g. execute ECC for basic FBs).
@@ -14,6 +14,7 @@
 #define _GENFB_H_
 
 #include "funcbloc.h"
+#include "genfbspeccache.h"
 
 template <class T>
 class CGenFunctionBlock : public T {
@@ -43,7 +44,31 @@ class CGenFunctionBlock : public T {
     static size_t getDataPointSpecSize(const CIEC_ANY &paValue);
     static void fillDataPointSpec(const CIEC_ANY &paValue, CStringDictionary::TStringId *&paDataTypeIds);
 
+    //! the interface spec created by createInterfaceSpec, empty if this instance uses a spec of the interface spec cache
+    const SFBInterfaceSpec &getGenInterfaceSpec() const {
+      return mGenInterfaceSpec;
+    }
+
   private:
+    /*! \brief Can instances of the same configured type share one interface spec
+     *
+     * Generic FBs whose interface spec only depends on the config string and which don't derive any further state
+     * while creating it can return true. Then only the first instance of a configured type creates the interface spec
+     * and all instances use a copy of it from the CGenFBInterfaceSpecCache.
+     */
+    virtual bool hasSharedInterfaceSpec() const {
+      return false;
+    }
+
+    /*! \brief Free the lists createInterfaceSpec has allocated for the interface spec
+     *
+     * Called once the interface spec has been copied into the CGenFBInterfaceSpecCache, so that the first instance of a
+     * configured type does not keep lists of its own. Generic FBs with a shared interface spec have to implement it if
+     * createInterfaceSpec allocates any lists.
+     */
+    virtual void freeGenInterfaceSpec() {
+    }
+
     /*! \brief parse the config string and generate the according interface specification
      *
      * This function is to be implemented by a generic fb and should parse the given interface
@@ -62,6 +87,7 @@ class CGenFunctionBlock : public T {
 
     CStringDictionary::TStringId mConfiguredFBTypeNameId;
     SFBInterfaceSpec mGenInterfaceSpec;  //!< the interface spec for this specific instance of generic FB
+    bool mUsesCachedInterfaceSpec; //!< the interface spec is taken from the CGenFBInterfaceSpecCache and has to be released
 };
 
 #include "genfb.tpp"
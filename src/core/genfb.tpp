@@ -17,7 +17,7 @@
 template<class T>
 CGenFunctionBlock<T>::CGenFunctionBlock(forte::core::CFBContainer &paContainer, const CStringDictionary::TStringId paInstanceNameId) :
     T(paContainer, nullptr, paInstanceNameId),
-    mConfiguredFBTypeNameId(CStringDictionary::scmInvalidStringId), mGenInterfaceSpec() {
+    mConfiguredFBTypeNameId(CStringDictionary::scmInvalidStringId), mGenInterfaceSpec(), mUsesCachedInterfaceSpec(false) {
 
   static_assert((std::is_base_of_v<CFunctionBlock, T>), "TFunctionBlock");
 }
@@ -28,11 +28,28 @@ CGenFunctionBlock<T>::~CGenFunctionBlock(){
     T::freeAllData();  //clean the interface and connections first.
     T::mInterfaceSpec = nullptr; //this stops the base classes from any wrong clean-up
   }
+  if(mUsesCachedInterfaceSpec){
+    CGenFBInterfaceSpecCache::getInstance().release(mConfiguredFBTypeNameId);
+  }
 }
 
 template<class T>
 bool CGenFunctionBlock<T>::configureFB(const char *paConfigString){
   setConfiguredTypeNameId(CStringDictionary::getInstance().insert(paConfigString));
+  if(hasSharedInterfaceSpec()){
+    const SFBInterfaceSpec *cachedSpec = CGenFBInterfaceSpecCache::getInstance().acquire(mConfiguredFBTypeNameId);
+    if(nullptr == cachedSpec){
+      if(!createInterfaceSpec(paConfigString, mGenInterfaceSpec)){
+        return false;
+      }
+      cachedSpec = CGenFBInterfaceSpecCache::getInstance().add(mConfiguredFBTypeNameId, mGenInterfaceSpec);
+      freeGenInterfaceSpec();
+      mGenInterfaceSpec = SFBInterfaceSpec();
+    }
+    mUsesCachedInterfaceSpec = true;
+    T::setupFBInterface(cachedSpec);
+    return true;
+  }
   if(createInterfaceSpec(paConfigString, mGenInterfaceSpec)){
     T::setupFBInterface(&mGenInterfaceSpec);
     return true;
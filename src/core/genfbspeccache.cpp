@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include "genfbspeccache.h"
+#ifdef FORTE_ENABLE_GENERATED_SOURCE_CPP
+#include "genfbspeccache_gen.cpp"
+#endif
+#include "utils/criticalregion.h"
+#include <algorithm>
+
+DEFINE_SINGLETON(CGenFBInterfaceSpecCache)
+
+namespace {
+  //! number of entries in a data type list, where an ARRAY is followed by its bounds and element type
+  size_t getDataTypeListSize(const CStringDictionary::TStringId *paDataTypeIds, TPortId paNumPorts) {
+    size_t size = 0;
+    if(nullptr != paDataTypeIds) {
+      for(TPortId i = 0; i < paNumPorts; ++i) {
+        while(g_nStringIdARRAY == paDataTypeIds[size++]) {
+          size += 2;
+        }
+      }
+    }
+    return size;
+  }
+
+  //! number of entries in a with list, up to the delimiter of the list ending last
+  size_t getWithListSize(const TDataIOID *paWith, const TForteInt16 *paWithIndexes, TEventID paNumEvents) {
+    size_t size = 0;
+    if(nullptr != paWith && nullptr != paWithIndexes) {
+      for(TEventID i = 0; i < paNumEvents; ++i) {
+        if(0 <= paWithIndexes[i]) {
+          size_t end = static_cast<size_t>(paWithIndexes[i]);
+          while(CFunctionBlock::scmWithListDelimiter != paWith[end]) {
+            ++end;
+          }
+          size = std::max(size, end + 1);
+        }
+      }
+    }
+    return size;
+  }
+
+  template<typename T>
+  const T *copyList(forte::core::util::CMixedStorage &paStorage, const T *paList, size_t paSize) {
+    return (nullptr != paList && 0 != paSize) ? paStorage.write(paList, paSize) : nullptr;
+  }
+}
+
+CGenFBInterfaceSpecCache::CGenFBInterfaceSpecCache() = default;
+
+CGenFBInterfaceSpecCache::~CGenFBInterfaceSpecCache() = default;
+
+const SFBInterfaceSpec *CGenFBInterfaceSpecCache::acquire(CStringDictionary::TStringId paTypeNameId) {
+  CCriticalRegion criticalRegion(mSync);
+  auto it = mEntries.find(paTypeNameId);
+  if(mEntries.end() == it) {
+    return nullptr;
+  }
+  ++it->second.mRefCount;
+  return static_cast<const SFBInterfaceSpec *>(it->second.mStorage.data());
+}
+
+const SFBInterfaceSpec *CGenFBInterfaceSpecCache::add(CStringDictionary::TStringId paTypeNameId, const SFBInterfaceSpec &paSpec) {
+  CCriticalRegion criticalRegion(mSync);
+  SEntry &entry = mEntries[paTypeNameId];
+  if(0 == entry.mRefCount) {
+    copySpec(paSpec, entry.mStorage);
+  }
+  ++entry.mRefCount;
+  return static_cast<const SFBInterfaceSpec *>(entry.mStorage.data());
+}
+
+void CGenFBInterfaceSpecCache::release(CStringDictionary::TStringId paTypeNameId) {
+  CCriticalRegion criticalRegion(mSync);
+  auto it = mEntries.find(paTypeNameId);
+  if(mEntries.end() != it && 0 == --it->second.mRefCount) {
+    mEntries.erase(it);
+  }
+}
+
+SGenFBInterfaceSpecStatistics CGenFBInterfaceSpecCache::getStatistics() {
+  CCriticalRegion criticalRegion(mSync);
+  SGenFBInterfaceSpecStatistics statistics = { mEntries.size(), 0, 0, 0 };
+  for(auto &entry : mEntries) {
+    statistics.mNumInstances += entry.second.mRefCount;
+    statistics.mSpecBytes += entry.second.mStorage.size();
+    statistics.mSavedBytes += (entry.second.mRefCount - 1) * entry.second.mStorage.size();
+  }
+  return statistics;
+}
+
+void CGenFBInterfaceSpecCache::copySpec(const SFBInterfaceSpec &paSpec, forte::core::util::CMixedStorage &paStorage) {
+  const size_t numDITypes = getDataTypeListSize(paSpec.mDIDataTypeNames, paSpec.mNumDIs);
+  const size_t numDOTypes = getDataTypeListSize(paSpec.mDODataTypeNames, paSpec.mNumDOs);
+  const size_t numEIWith = getWithListSize(paSpec.mEIWith, paSpec.mEIWithIndexes, paSpec.mNumEIs);
+  const size_t numEOWith = getWithListSize(paSpec.mEOWith, paSpec.mEOWithIndexes, paSpec.mNumEOs);
+  const size_t numEIWithIndexes = (nullptr != paSpec.mEIWithIndexes) ? paSpec.mNumEIs : 0;
+  const size_t numEOWithIndexes = (nullptr != paSpec.mEOWithIndexes) ? paSpec.mNumEOs : 0;
+
+  //reserve everything up front so that the pointers into the storage stay valid, larger elements first for alignment
+  paStorage.clear();
+  paStorage.reserve(sizeof(SFBInterfaceSpec) + paSpec.mNumAdapters * sizeof(SAdapterInstanceDef) +
+      (paSpec.mNumEIs + paSpec.mNumEOs + paSpec.mNumDIs + numDITypes + paSpec.mNumDOs + numDOTypes + paSpec.mNumDIOs) *
+          sizeof(CStringDictionary::TStringId) +
+      (numEIWithIndexes + numEOWithIndexes) * sizeof(TForteInt16) + (numEIWith + numEOWith) * sizeof(TDataIOID));
+
+  SFBInterfaceSpec *spec = paStorage.write(paSpec);
+  spec->mAdapterInstanceDefinition = copyList(paStorage, paSpec.mAdapterInstanceDefinition, paSpec.mNumAdapters);
+  spec->mEINames = copyList(paStorage, paSpec.mEINames, paSpec.mNumEIs);
+  spec->mEONames = copyList(paStorage, paSpec.mEONames, paSpec.mNumEOs);
+  spec->mDINames = copyList(paStorage, paSpec.mDINames, paSpec.mNumDIs);
+  spec->mDIDataTypeNames = copyList(paStorage, paSpec.mDIDataTypeNames, numDITypes);
+  spec->mDONames = copyList(paStorage, paSpec.mDONames, paSpec.mNumDOs);
+  spec->mDODataTypeNames = copyList(paStorage, paSpec.mDODataTypeNames, numDOTypes);
+  spec->mDIONames = copyList(paStorage, paSpec.mDIONames, paSpec.mNumDIOs);
+  spec->mEIWithIndexes = copyList(paStorage, paSpec.mEIWithIndexes, numEIWithIndexes);
+  spec->mEOWithIndexes = copyList(paStorage, paSpec.mEOWithIndexes, numEOWithIndexes);
+  spec->mEIWith = copyList(paStorage, paSpec.mEIWith, numEIWith);
+  spec->mEOWith = copyList(paStorage, paSpec.mEOWith, numEOWith);
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#ifndef _GENFBSPECCACHE_H_
+#define _GENFBSPECCACHE_H_
+
+#include "funcbloc.h"
+#include "utils/singlet.h"
+#include "utils/mixedStorage.h"
+#include <forte_sync.h>
+#include <unordered_map>
+
+//! Figures of the interface spec cache for the statistics query
+struct SGenFBInterfaceSpecStatistics {
+    size_t mNumSpecs; //!< configured generic types with a cached spec
+    size_t mNumInstances; //!< FB instances using a cached spec
+    size_t mSpecBytes; //!< memory held by the cached specs
+    size_t mSavedBytes; //!< memory the instances would need for own copies of the specs
+};
+
+/*!\ingroup CORE\brief Interned interface specs of configured generic FB types (e.g., PUBLISH_2)
+ *
+ * The first instance of a configured type creates its interface spec as usual. The cache copies the spec into one
+ * block which all further instances of this type use instead of creating their own. A spec is freed when its last
+ * instance is deleted.
+ */
+class CGenFBInterfaceSpecCache {
+  DECLARE_SINGLETON(CGenFBInterfaceSpecCache)
+  public:
+    /*!\brief Get the cached spec of a configured type and take a reference on it
+     *
+     * \return the spec or nullptr if none is cached for this type
+     */
+    const SFBInterfaceSpec *acquire(CStringDictionary::TStringId paTypeNameId);
+
+    /*!\brief Put a copy of paSpec into the cache and take a reference on it
+     *
+     * If another instance has added a spec for this type in the meantime that one is returned.
+     */
+    const SFBInterfaceSpec *add(CStringDictionary::TStringId paTypeNameId, const SFBInterfaceSpec &paSpec);
+
+    //! Drop a reference taken by acquire or add
+    void release(CStringDictionary::TStringId paTypeNameId);
+
+    SGenFBInterfaceSpecStatistics getStatistics();
+
+  private:
+    struct SEntry {
+        forte::core::util::CMixedStorage mStorage; //!< the SFBInterfaceSpec followed by its lists
+        size_t mRefCount;
+    };
+
+    static void copySpec(const SFBInterfaceSpec &paSpec, forte::core::util::CMixedStorage &paStorage);
+
+    std::unordered_map<CStringDictionary::TStringId, SEntry> mEntries;
+    CSyncObject mSync;
+};
+
+#endif /* _GENFBSPECCACHE_H_ */
@@ -51,7 +51,7 @@ CAdapter* CLuaAdapterTypeEntry::createAdapterInstance(CStringDictionary::TString
   if(!luaEngine->load(this) && (!luaEngine->loadString(cmLuaScriptAsString))) {
     return nullptr;
   }
-  return new CLuaAdapter(paInstanceNameId, this, paIsPlug, paContainer);
+  return new(paContainer) CLuaAdapter(paInstanceNameId, this, paIsPlug, paContainer);
 }
 
 bool CLuaAdapterTypeEntry::initInterfaceSpec(SFBInterfaceSpec& paInterfaceSpec, CLuaEngine* paLuaEngine, int paIndex) {
@@ -70,7 +70,7 @@ CFunctionBlock* CLuaBFBTypeEntry::createFBInstance(CStringDictionary::TStringId
     luaEngine->store(this); //store ECC
   }
   luaEngine->pop(); //pop ECC / loaded defs
-  return new CLuaBFB(paInstanceNameId, this, paContainer);
+  return new(paContainer) CLuaBFB(paInstanceNameId, this, paContainer);
 }
 
 bool CLuaBFBTypeEntry::initInterfaceSpec(SFBInterfaceSpec& paInterfaceSpec, CLuaEngine* paLuaEngine, int paIndex) {
@@ -106,7 +106,7 @@ CFunctionBlock* CLuaCFBTypeEntry::createFBInstance(CStringDictionary::TStringId
   if(!luaEngine->load(this) && (!luaEngine->loadString(cmLuaScriptAsString))) {
     return nullptr;
   }
-  return new CLuaCFB(paInstanceNameId, this, getFbnSpec(), paContainer);
+  return new(paContainer) CLuaCFB(paInstanceNameId, this, getFbnSpec(), paContainer);
 }
 
 bool CLuaCFBTypeEntry::initInterfaceSpec(SFBInterfaceSpec& paInterfaceSpec, CLuaEngine* paLuaEngine, int paIndex) {
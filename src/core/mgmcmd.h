@@ -214,6 +214,16 @@ enum class EMGMCommandType : uint8_t {
    *    - mAdditionalParams the read value is stored here
    */
   QueryAdapterType = 0x87,
+
+  /*! \brief Read runtime statistics of a resource (e.g., event queue fill levels and overflow counters).
+   *
+   * The parameters of the SManagementCMD are defined as:
+   *    - mDestination = "resname" for reading the statistics of a resource
+   *    - mFirstParam = not used
+   *    - mSecondParam = not used
+   *    - mAdditionalParams the read value is stored here
+   */
+  QueryStatistics = 0x97,
 #endif
 
   /*! \brief reset a FB, resource or the device.
@@ -28,8 +28,14 @@
 #include "adapterconn.h"
 #include "if2indco.h"
 #include "utils/criticalregion.h"
+#include "utils/arena.h"
 #include "utils/fixedcapvector.h"
 #include "ecet.h"
+#include "ecetpool.h"
+#include "cominfra/basecommfb.h"
+#include "cominfra/comlayer.h"
+#include "genfbspeccache.h"
+#include "forte_uint.h"
 
 #ifdef FORTE_DYNAMIC_TYPE_LOAD
 #include "lua/luaengine.h"
@@ -38,24 +44,61 @@
 #include "lua/luaadaptertypeentry.h"
 #endif
 
+#include <algorithm>
 #include <string>
+#include <string.h>
 
 using namespace std::string_literals;
 
+namespace {
+  //! names of the EEventQueueOverflowPolicy values, in the order of the enum
+  const char * const scmOverflowPolicyNames[] = { "DropNewest", "DropOldest", "Coalesce", "BlockWithTimeout" };
+
+  const char * const scmOverflowPolicyParameter = "EventQueueOverflowPolicy";
+  const char * const scmBlockTimeoutParameter = "EventQueueBlockTimeout";
+  const char * const scmEventListGrowthParameter = "EventListGrowthSegments";
+
+  //! names of the EEventChainPriority values, in the order of the enum
+  const char * const scmPriorityNames[] = { "Low", "Normal", "High" };
+
+  const char * const scmProcessInterfacePriorityParameter = "ProcessInterfacePriority";
+}
+
+template<typename F>
+void CResource::forEachResourceECET(F paFunction) const {
+  if(nullptr != mResourceExecutionPool){
+    for(size_t i = 0; i < mResourceExecutionPool->getNumberOfWorkers(); ++i){
+      paFunction(*mResourceExecutionPool->getWorker(i));
+    }
+  } else if(nullptr != mResourceEventExecution){
+    paFunction(*mResourceEventExecution);
+  }
+}
+
 CResource::CResource(forte::core::CFBContainer &paDevice, const SFBInterfaceSpec *paInterfaceSpec, const CStringDictionary::TStringId paInstanceNameId) :
     CFunctionBlock(paDevice, paInterfaceSpec, paInstanceNameId), forte::core::CFBContainer(CStringDictionary::scmInvalidStringId, paDevice), // the fbcontainer of resources does not have a seperate name as it is stored in the resource
-    mResourceEventExecution(CEventChainExecutionThread::createEcet()), mResIf2InConnections(nullptr)
+    mResourceEventExecution(nullptr), mResourceExecutionPool(nullptr), mResIf2InConnections(nullptr),
+    mFBArena((0 != cgResourceArenaChunkSize) ? new forte::core::util::CArena(cgResourceArenaChunkSize) : nullptr),
+    mProcessInterfacePriority(EEventChainPriority::Normal)
 #ifdef FORTE_SUPPORT_MONITORING
 , mMonitoringHandler(*this)
 #endif
 #ifdef FORTE_TRACE_CTF
 , tracePlatformContext(paInstanceNameId, FORTE_TRACE_CTF_BUFFER_SIZE)
 #endif
-{}
+{
+  if(cgResourceExecutionWorkers > 1){
+    mResourceExecutionPool = new CEventChainExecutionThreadPool(cgResourceExecutionWorkers);
+    mResourceEventExecution = mResourceExecutionPool->getWorker(0);
+  } else {
+    mResourceEventExecution = CEventChainExecutionThread::createEcet();
+  }
+}
 
 CResource::CResource(const SFBInterfaceSpec *paInterfaceSpec, const CStringDictionary::TStringId paInstanceNameId) :
     CFunctionBlock(*this, paInterfaceSpec, paInstanceNameId), forte::core::CFBContainer(CStringDictionary::scmInvalidStringId, *this), // the fbcontainer of resources does not have a seperate name as it is stored in the resource
-    mResourceEventExecution(nullptr), mResIf2InConnections(nullptr)
+    mResourceEventExecution(nullptr), mResourceExecutionPool(nullptr), mResIf2InConnections(nullptr), mFBArena(nullptr),
+    mProcessInterfacePriority(EEventChainPriority::Normal)
 #ifdef FORTE_SUPPORT_MONITORING
 , mMonitoringHandler(*this)
 #endif
@@ -79,8 +122,17 @@ CResource::~CResource(){
 #ifdef FORTE_DYNAMIC_TYPE_LOAD
   delete luaEngine;
 #endif
-  delete mResourceEventExecution;
+  if(nullptr != mResourceExecutionPool){
+    delete mResourceExecutionPool; //the pool owns mResourceEventExecution
+  } else {
+    delete mResourceEventExecution;
+  }
   delete[] mResIf2InConnections;
+  if(nullptr != mFBArena){
+    //the FBs live in the arena, so they have to go before it, then all of their memory is freed at once
+    deleteContainedFBs();
+    delete mFBArena;
+  }
 }
 
 EMGMResponse CResource::executeMGMCommand(forte::core::SManagementCMD &paCommand){
@@ -149,6 +201,9 @@ EMGMResponse CResource::executeMGMCommand(forte::core::SManagementCMD &paCommand
         case EMGMCommandType::QueryConnection:
         retVal = queryConnections(paCommand.mAdditionalParams, *this);
         break;
+        case EMGMCommandType::QueryStatistics:
+        retVal = queryStatistics(paCommand.mAdditionalParams);
+        break;
 #endif //FORTE_SUPPORT_QUERY_CMD
       default:
 #ifdef FORTE_SUPPORT_MONITORING
@@ -175,7 +230,9 @@ EMGMResponse CResource::changeFBExecutionState(EMGMCommandType paCommand){
           }
         }
       }
-      if(nullptr != mResourceEventExecution){
+      if(nullptr != mResourceExecutionPool){
+        mResourceExecutionPool->changeExecutionState(paCommand);
+      } else if(nullptr != mResourceEventExecution){
         // if we have a mResourceEventExecution handle it
         mResourceEventExecution->changeExecutionState(paCommand);
       }
@@ -242,6 +299,10 @@ EMGMResponse CResource::writeValue(forte::core::TNameIdentifier &paNameList, con
 
   CStringDictionary::TStringId portName = paNameList.back();
   paNameList.popBack();
+  //resources like EMB_RES have no interface, all their inputs are execution parameters
+  if(paNameList.isEmpty() && ((nullptr == getFBInterfaceSpec()) || (nullptr == getVar(&portName, 1)))){
+    return writeExecutionParameter(portName, paValue);
+  }
   forte::core::TNameIdentifier::CIterator runner(paNameList.begin());
 
   CFunctionBlock *fb = this;
@@ -274,6 +335,62 @@ EMGMResponse CResource::writeValue(forte::core::TNameIdentifier &paNameList, con
   return retVal;
 }
 
+EMGMResponse CResource::writeExecutionParameter(CStringDictionary::TStringId paName, const CIEC_STRING &paValue){
+  const char *name = CStringDictionary::getInstance().get(paName);
+  if(nullptr == name){
+    return EMGMResponse::NoSuchObject;
+  }
+  if(0 == strcmp(name, scmOverflowPolicyParameter)){
+    const char * const *policyName = std::find_if(std::begin(scmOverflowPolicyNames), std::end(scmOverflowPolicyNames),
+        [&paValue](const char *paPolicyName){ return paValue.getStorage() == paPolicyName; });
+    if(std::end(scmOverflowPolicyNames) == policyName){
+      return EMGMResponse::BadParams;
+    }
+    const auto policy = static_cast<EEventQueueOverflowPolicy>(policyName - std::begin(scmOverflowPolicyNames));
+    forEachResourceECET([policy](CEventChainExecutionThread &paECET){
+      paECET.setOverflowPolicy(policy, paECET.getBlockTimeout());
+    });
+    return EMGMResponse::Ready;
+  }
+  if(0 == strcmp(name, scmBlockTimeoutParameter)){
+    CIEC_TIME timeout;
+    if((paValue.length() == 0) || (static_cast<int>(paValue.length()) != timeout.fromString(paValue.getStorage().c_str()))
+        || (timeout.getInNanoSeconds() < 0)){
+      return EMGMResponse::BadParams;
+    }
+    const auto blockTimeout = static_cast<TForteUInt64>(timeout.getInNanoSeconds());
+    forEachResourceECET([blockTimeout](CEventChainExecutionThread &paECET){
+      paECET.setOverflowPolicy(paECET.getOverflowPolicy(), blockTimeout);
+    });
+    return EMGMResponse::Ready;
+  }
+  if(0 == strcmp(name, scmEventListGrowthParameter)){
+    CIEC_UINT maxSegments;
+    if((paValue.length() == 0) || (static_cast<int>(paValue.length()) != maxSegments.fromString(paValue.getStorage().c_str()))
+        || (0 == static_cast<CIEC_UINT::TValueType>(maxSegments))){
+      return EMGMResponse::BadParams;
+    }
+    if(E_FBStates::Running == getState()){
+      //the event lists belong to the ECETs and can only be changed while they are not executing
+      return EMGMResponse::InvalidState;
+    }
+    forEachResourceECET([&maxSegments](CEventChainExecutionThread &paECET){
+      paECET.enableEventListGrowth(static_cast<CIEC_UINT::TValueType>(maxSegments));
+    });
+    return EMGMResponse::Ready;
+  }
+  if(0 == strcmp(name, scmProcessInterfacePriorityParameter)){
+    const char * const *priorityName = std::find_if(std::begin(scmPriorityNames), std::end(scmPriorityNames),
+        [&paValue](const char *paPriorityName){ return paValue.getStorage() == paPriorityName; });
+    if(std::end(scmPriorityNames) == priorityName){
+      return EMGMResponse::BadParams;
+    }
+    mProcessInterfacePriority = static_cast<EEventChainPriority>(priorityName - std::begin(scmPriorityNames));
+    return EMGMResponse::Ready;
+  }
+  return EMGMResponse::NoSuchObject;
+}
+
 EMGMResponse CResource::readValue(forte::core::TNameIdentifier &paNameList, CIEC_STRING & paValue){
   EMGMResponse retVal = EMGMResponse::NoSuchObject;
   CIEC_ANY *const var = getVariable(paNameList);
@@ -402,6 +519,93 @@ EMGMResponse CResource::querySubapps(CIEC_STRING & paValue, CFBContainer& contai
   return EMGMResponse::Ready;
 }
 
+EMGMResponse CResource::queryStatistics(CIEC_STRING & paValue) const {
+  if(nullptr == mResourceEventExecution){
+    return EMGMResponse::UnsupportedCmd;
+  }
+  //sizes are the same for all ECETs, high water marks are the maximum and the counters the sum of all ECETs
+  SEventQueueStatistics statistics = {};
+  size_t numECETs = 0;
+  forEachResourceECET([&statistics, &numECETs](const CEventChainExecutionThread &paECET){
+    const SEventQueueStatistics ecetStatistics = paECET.getEventQueueStatistics();
+    statistics.mEventListSize = ecetStatistics.mEventListSize;
+    statistics.mEventListHighWaterMark = std::max(statistics.mEventListHighWaterMark, ecetStatistics.mEventListHighWaterMark);
+    statistics.mExternalEventListSize = ecetStatistics.mExternalEventListSize;
+    statistics.mExternalEventListHighWaterMark = std::max(statistics.mExternalEventListHighWaterMark, ecetStatistics.mExternalEventListHighWaterMark);
+    statistics.mDroppedEvents += ecetStatistics.mDroppedEvents;
+    statistics.mDroppedExternalEvents += ecetStatistics.mDroppedExternalEvents;
+    statistics.mCoalescedEvents += ecetStatistics.mCoalescedEvents;
+    ++numECETs;
+  });
+  paValue.append("<EventQueue OverflowPolicy=\"");
+  paValue.append(scmOverflowPolicyNames[static_cast<size_t>(mResourceEventExecution->getOverflowPolicy())]);
+  paValue.append("\" ECETs=\"");
+  paValue.append(std::to_string(numECETs));
+  paValue.append("\" EventListSize=\"");
+  paValue.append(std::to_string(statistics.mEventListSize));
+  paValue.append("\" EventListHighWaterMark=\"");
+  paValue.append(std::to_string(statistics.mEventListHighWaterMark));
+  paValue.append("\" DroppedEvents=\"");
+  paValue.append(std::to_string(statistics.mDroppedEvents));
+  paValue.append("\" ExternalEventListSize=\"");
+  paValue.append(std::to_string(statistics.mExternalEventListSize));
+  paValue.append("\" ExternalEventListHighWaterMark=\"");
+  paValue.append(std::to_string(statistics.mExternalEventListHighWaterMark));
+  paValue.append("\" DroppedExternalEvents=\"");
+  paValue.append(std::to_string(statistics.mDroppedExternalEvents));
+  paValue.append("\" CoalescedEvents=\"");
+  paValue.append(std::to_string(statistics.mCoalescedEvents));
+  paValue.append("\" />");
+  queryComInterruptStatistics(paValue, *this, "");
+  //the interface spec cache is shared by all resources
+  SGenFBInterfaceSpecStatistics specStatistics = CGenFBInterfaceSpecCache::getInstance().getStatistics();
+  paValue.append("<GenericInterfaceSpecs Specs=\"");
+  paValue.append(std::to_string(specStatistics.mNumSpecs));
+  paValue.append("\" Instances=\"");
+  paValue.append(std::to_string(specStatistics.mNumInstances));
+  paValue.append("\" SpecBytes=\"");
+  paValue.append(std::to_string(specStatistics.mSpecBytes));
+  paValue.append("\" SavedBytes=\"");
+  paValue.append(std::to_string(specStatistics.mSavedBytes));
+  paValue.append("\" />");
+  if(nullptr != mFBArena){
+    paValue.append("<FBArena ReservedBytes=\"");
+    paValue.append(std::to_string(mFBArena->getReservedBytes()));
+    paValue.append("\" AllocatedBytes=\"");
+    paValue.append(std::to_string(mFBArena->getAllocatedBytes()));
+    paValue.append("\" Allocations=\"");
+    paValue.append(std::to_string(mFBArena->getNumAllocations()));
+    paValue.append("\" />");
+  }
+  return EMGMResponse::Ready;
+}
+
+void CResource::queryComInterruptStatistics(CIEC_STRING & paValue, const CFBContainer& paContainer, const std::string &paPrefix){
+  for(const CFunctionBlock *fb : paContainer.getFBList()){
+    const forte::com_infra::CBaseCommFB *commFB = fb->asCommFB();
+    if(nullptr != commFB){
+      forte::com_infra::SComInterruptStatistics statistics = commFB->getInterruptStatistics();
+      paValue.append("\n    <ComInterruptQueue FB=\"");
+      paValue.append(paPrefix);
+      paValue.append(commFB->getInstanceName());
+      paValue.append("\" QueueSize=\"");
+      paValue.append(std::to_string(statistics.mQueueSize));
+      paValue.append("\" HighWaterMark=\"");
+      paValue.append(std::to_string(statistics.mHighWaterMark));
+      paValue.append("\" DroppedInterrupts=\"");
+      paValue.append(std::to_string(statistics.mDroppedInterrupts));
+      paValue.append("\" />");
+      const std::string fbName = paPrefix + commFB->getInstanceName();
+      for(const forte::com_infra::CComLayer *layer = commFB->getTopOfComStack(); nullptr != layer; layer = layer->getBottomLayer()){
+        layer->queryStatistics(paValue, fbName);
+      }
+    }
+  }
+  for(const CFBContainer *subapp : paContainer.getSubContainerList()){
+    queryComInterruptStatistics(paValue, *subapp, paPrefix + subapp->getName() + ".");
+  }
+}
+
 EMGMResponse CResource::queryConnections(CIEC_STRING & paReqResult, CFBContainer& container){
 
   EMGMResponse retVal = EMGMResponse::UnsupportedType;
@@ -32,6 +32,7 @@ class CLuaEngine;
 #endif
 
 class CInterface2InternalDataConnection;
+class CEventChainExecutionThreadPool;
 
 /*! \ingroup CORE\brief Base class for all resources handling the reconfiguration management within this
  * resource and the background execution of event chains.
@@ -84,6 +85,10 @@ class CResource : public CFunctionBlock, public forte::core::CFBContainer{
       return CFBContainer::getDevice();
     }
 
+    forte::core::util::CArena *getFBArena() override {
+      return mFBArena;
+    }
+
     std::string getFullQualifiedApplicationInstanceName(const char ) const override{
       // we don't want to add anything here as the resource name should be excluded
       return std::string();
@@ -93,9 +98,17 @@ class CResource : public CFunctionBlock, public forte::core::CFBContainer{
       return mResourceEventExecution;
     };
 
+    //! Priority class of the event chains started by the process interface FBs of this resource
+    EEventChainPriority getProcessInterfacePriority() const {
+      return mProcessInterfacePriority;
+    }
+
     EMGMResponse changeFBExecutionState(EMGMCommandType paCommand) override;
 
     /*!\brief Write a parameter value to a given FB-input
+     *
+     * Names without an FB that are no input of the resource address the execution parameters of the resource, see
+     * writeExecutionParameter.
      *
      * @param paNameList the identifier name list of the parameter to be written
      * @param paValue the value to be writen
@@ -207,6 +220,16 @@ class CResource : public CFunctionBlock, public forte::core::CFBContainer{
     EMGMResponse querySubapps(CIEC_STRING& paValue, CFBContainer& container, std::string prefix);
 
     EMGMResponse queryConnections(CIEC_STRING &paValue, CFBContainer& container);
+
+    /*!\brief Retrieve the runtime statistics of this resource
+     *
+     * @param paValue the result of the query
+     * @return response of the command execution as defined in IEC 61499
+     */
+    EMGMResponse queryStatistics(CIEC_STRING& paValue) const;
+
+    //! Append the interrupt queue and com layer statistics of the communication FBs in paContainer and its subapps
+    static void queryComInterruptStatistics(CIEC_STRING& paValue, const CFBContainer& paContainer, const std::string &paPrefix);
     void createEOConnectionResponse(const CFunctionBlock& paFb, CIEC_STRING& paReqResult);
     void createDOConnectionResponse(const CFunctionBlock& paFb, CIEC_STRING& paReqResult);
     void createAOConnectionResponse(const CFunctionBlock& paFb, CIEC_STRING& paReqResult);
@@ -255,14 +278,46 @@ class CResource : public CFunctionBlock, public forte::core::CFBContainer{
 
     CConnection *getResIf2InConnection(CStringDictionary::TStringId paResInput) const;
 
+    /*!\brief Set an execution parameter of the resource, applied to all of its ECETs
+     *
+     * Execution parameters are written like the inputs of the resource, e.g., from a boot file, but are not part of
+     * its interface:
+     *  - EventQueueOverflowPolicy: DropNewest, DropOldest, Coalesce, or BlockWithTimeout
+     *  - EventQueueBlockTimeout: maximum wait of BlockWithTimeout as TIME literal, e.g., T#1ms
+     *  - EventListGrowthSegments: number of segments the event lists may grow by, see
+     *    CEventChainExecutionThread::enableEventListGrowth(), only while the resource is not running
+     *  - ProcessInterfacePriority: Low, Normal, or High, the priority class of the event chains started by process
+     *    interface FBs created afterwards
+     *
+     * @param paName name of the execution parameter
+     * @param paValue the new value
+     * @return response of the command execution as defined in IEC 61499
+     */
+    EMGMResponse writeExecutionParameter(CStringDictionary::TStringId paName, const CIEC_STRING &paValue);
+
+    //! call paFunction for each ECET of the resource, i.e., its single ECET or all workers of its pool
+    template<typename F>
+    void forEachResourceECET(F paFunction) const;
+
     void initializeResIf2InConnections();
 
     /*!\brief The event chain execution of background (low priority) event chains started within this resource
      */
     CEventChainExecutionThread *mResourceEventExecution;
 
+    /*!\brief Pool of event chain execution threads if the resource executes its event chains in parallel
+     *
+     * Only created if cgResourceExecutionWorkers is larger than one. mResourceEventExecution then is one of the pool's
+     * workers and starting an event chain on it dispatches the chain within the pool.
+     */
+    CEventChainExecutionThreadPool *mResourceExecutionPool;
+
     CInterface2InternalDataConnection *mResIf2InConnections; //!< List of all connections from the res interface to internal FBs
 
+    forte::core::util::CArena *mFBArena; //!< the contained FBs are allocated from this arena, nullptr if they are allocated on the heap
+
+    EEventChainPriority mProcessInterfacePriority;
+
 #ifdef FORTE_SUPPORT_MONITORING
     forte::core::CMonitoringHandler mMonitoringHandler;
 #endif //#ifdef FORTE_SUPPORT_MONITORING
@@ -22,55 +22,57 @@
 #include <stringlist.h>
 #include <string.h>
 #include <stdlib.h>
+#include <algorithm>
 #include "devlog.h"
+#include "utils/criticalregion.h"
+#include "utils/mpscringbuf.h"
 
 DEFINE_SINGLETON(CStringDictionary)
 
-CStringDictionary::CStringDictionary(){
+namespace {
+  //! keep the index at most half full so that probe sequences stay short
+  size_t getIndexSize(size_t paNrOfStrings) {
+    return forte::core::util::roundUpToPowerOfTwo(2 * paNrOfStrings);
+  }
+}
+
+CStringDictionary::CStringDictionary() :
+    mNrOfChunks(0), mHashTable(nullptr), mStringBufSize(0), mMaxNrOfStrings(0), mNrOfStrings(0) {
+  SHashTable *table;
 #ifdef FORTE_STRING_DICT_FIXED_MEMORY
-  mStringBufAddr = scmConstStringBuf;
-  mStringIdBufAddr = scmIdList;
+  static SHashSlot sFixedSlots[forte::core::util::roundUpToPowerOfTwo(2 * cgStringDictInitialMaxNrOfStrings)];
+  static SHashTable sFixedTable = { sFixedSlots, (sizeof(sFixedSlots) / sizeof(SHashSlot)) - 1, nullptr };
+  table = &sFixedTable;
 
-  mStringBufSize = cgStringDictInitialStringBufSize;
+  //the strings are added to the constant strings in the same buffer
+  mChunks[0].mAddr = scmConstStringBuf;
+  mChunks[0].mSize = cgStringDictInitialStringBufSize;
   mMaxNrOfStrings = cgStringDictInitialMaxNrOfStrings;
-
-  mNrOfStrings = cgNumOfConstStrings;
-  mNextString = g_nStringIdNextFreeId;
 #else
-  mStringIdBufAddr = nullptr;
-  mStringBufSize = 0;
-  mMaxNrOfStrings = 0;
-  mNrOfStrings = 0;
-  mNextString = CStringDictionary::scmInvalidStringId;
-  size_t nStringBufSize = cgStringDictInitialStringBufSize;
-  if(nStringBufSize < g_nStringIdNextFreeId){
-    nStringBufSize = (g_nStringIdNextFreeId * 3) >> 1;
-  }
-
-  unsigned int nMaxNrOfStrings = cgStringDictInitialMaxNrOfStrings;
-  if(nMaxNrOfStrings < cgNumOfConstStrings){
-    nMaxNrOfStrings = (cgNumOfConstStrings * 3) >> 1;
+  table = new SHashTable;
+  table->mMask = getIndexSize(std::max(static_cast<size_t>(cgStringDictInitialMaxNrOfStrings), static_cast<size_t>(cgNumOfConstStrings))) - 1;
+  table->mSlots = new SHashSlot[table->mMask + 1];
+  table->mRetired = nullptr;
+
+  //the constant strings are used in place as first chunk
+  mChunks[0].mAddr = const_cast<char *>(scmConstStringBuf);
+  mChunks[0].mSize = g_nStringIdNextFreeId;
+  mMaxNrOfStrings = std::numeric_limits<unsigned int>::max();
+#endif
+  for(size_t i = 0; i <= table->mMask; ++i) {
+    table->mSlots[i].mId.store(scmInvalidStringId, std::memory_order_relaxed);
   }
-
-  mStringBufAddr = (char *) forte_malloc(nStringBufSize * sizeof(char));
-  if(nullptr != mStringBufAddr){
-    mStringIdBufAddr = (TStringId *) forte_malloc(nMaxNrOfStrings * sizeof(TStringId));
-    if(nullptr != mStringIdBufAddr){
-      memcpy(mStringBufAddr, scmConstStringBuf, g_nStringIdNextFreeId);
-      memcpy(mStringIdBufAddr, scmIdList, (cgNumOfConstStrings * sizeof(TStringId)));
-
-      mStringBufSize = nStringBufSize;
-      mMaxNrOfStrings = nMaxNrOfStrings;
-
-      mNrOfStrings = cgNumOfConstStrings;
-      mNextString = g_nStringIdNextFreeId;
-    }
-    else{
-      forte_free(mStringBufAddr);
-      mStringBufAddr = nullptr;
-    }
+  mHashTable.store(table, std::memory_order_relaxed);
+
+  mChunks[0].mFirstId = 0;
+  mChunks[0].mUsed.store(g_nStringIdNextFreeId, std::memory_order_relaxed);
+  mStringBufSize = mChunks[0].mSize;
+  for(unsigned int i = 0; i < cgNumOfConstStrings; ++i) {
+    const char *str = scmConstStringBuf + scmIdList[i];
+    addToIndex(scmIdList[i], hash(str, strlen(str)));
   }
-#endif
+  mNrOfStrings = cgNumOfConstStrings;
+  mNrOfChunks.store(1, std::memory_order_release);
 }
 
 CStringDictionary::~CStringDictionary(){
@@ -79,26 +81,42 @@ CStringDictionary::~CStringDictionary(){
 
 // clear
 void CStringDictionary::clear(){
+  unsigned int nrOfChunks = mNrOfChunks.load(std::memory_order_relaxed);
+  mNrOfChunks.store(0, std::memory_order_relaxed);
+  //the first chunk holds the constant strings
+  for(unsigned int i = 1; i < nrOfChunks; ++i) {
+    forte_free(mChunks[i].mAddr);
+    mChunks[i].mAddr = nullptr;
+  }
 #ifndef FORTE_STRING_DICT_FIXED_MEMORY
-  forte_free(mStringBufAddr);
-  forte_free(mStringIdBufAddr);
+  SHashTable *table = mHashTable.load(std::memory_order_relaxed);
+  while(nullptr != table) {
+    SHashTable *retired = table->mRetired;
+    delete[] table->mSlots;
+    delete table;
+    table = retired;
+  }
 #endif
-  mStringIdBufAddr = nullptr;
-  mStringBufAddr = nullptr;
+  mHashTable.store(nullptr, std::memory_order_relaxed);
   mStringBufSize = 0;
   mMaxNrOfStrings = 0;
   mNrOfStrings = 0;
-  mNextString = 0;
 }
 
 // get a string (0 if not found)
 const char *CStringDictionary::get(TStringId paId){
-  if(paId >= mNextString) {
+  const SStringChunk *chunk = findChunk(paId);
+  if(nullptr == chunk) {
     return nullptr;
   }
 
-  const char *adr = getStringAddress(paId);
-  if(paId > 0 && adr[-1] != '\0') {
+  const size_t offset = paId - chunk->mFirstId;
+  if(offset >= chunk->mUsed.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+
+  const char *adr = chunk->mAddr + offset;
+  if(offset > 0 && adr[-1] != '\0') {
     return nullptr;
   }
 
@@ -111,164 +129,163 @@ CStringDictionary::TStringId CStringDictionary::insert(const char *paStr) {
 
 // insert a string and return a string id (InvalidTStringId for no memory or other error)
 CStringDictionary::TStringId CStringDictionary::insert(const char *paStr, size_t paStrSize){
-  TStringId nRetVal = scmInvalidStringId;
-
-  if(nullptr != paStr){
-    unsigned int idx;
-    nRetVal = findEntry(paStr, paStrSize, idx);
-    if(scmInvalidStringId == nRetVal){
-      size_t nRequiredSize = mNextString + paStrSize + 1;
+  if(nullptr == paStr){
+    return scmInvalidStringId;
+  }
 
-      if(mNrOfStrings >= mMaxNrOfStrings){
-#ifdef FORTE_STRING_DICT_FIXED_MEMORY
+  const TForteUInt32 strHash = hash(paStr, paStrSize);
+  TStringId nRetVal = findEntry(paStr, paStrSize, strHash);
+  if(scmInvalidStringId == nRetVal){
+    CCriticalRegion writeRegion(mWriteLock);
+    //another writer may have inserted it while we waited for the lock
+    nRetVal = findEntry(paStr, paStrSize, strHash);
+    const SHashTable *table = mHashTable.load(std::memory_order_relaxed);
+    if(scmInvalidStringId == nRetVal && nullptr != table && mNrOfStrings < mMaxNrOfStrings){
+      if(2 * (mNrOfStrings + 1) > table->mMask + 1 && !growIndex()){
         return scmInvalidStringId;
-#else
-        //grow exponentially by 1.5 according to Herb Sutter best strategy
-        if(!reallocateStringIdBuf((mMaxNrOfStrings * 3) >> 1)){
-          return scmInvalidStringId;
-        }
-#endif
-
       }
-      if(nRequiredSize > mStringBufSize){
-#ifdef FORTE_STRING_DICT_FIXED_MEMORY
-        return scmInvalidStringId;
-#else
-        //grow exponentially by 1.5 according to Herb Sutter best strategy
-        if(!reallocateStringBuf((nRequiredSize * 3) >> 1)){
-          return scmInvalidStringId;
-        }
-#endif
+      nRetVal = appendString(paStr, paStrSize);
+      if(scmInvalidStringId != nRetVal){
+        addToIndex(nRetVal, strHash);
+        mNrOfStrings++;
       }
-      nRetVal = insertAt(paStr, idx, paStrSize);
     }
   }
   return nRetVal;
 }
 
-CStringDictionary::TStringId CStringDictionary::findEntry(const char *paStr, unsigned int &paIdx) const{
-  paIdx = 0;
-  if(mNrOfStrings == 0) {
-    return scmInvalidStringId;
+TForteUInt32 CStringDictionary::hash(const char *paStr, size_t paStrSize){
+  //FNV-1a
+  TForteUInt32 nHash = 2166136261U;
+  for(size_t i = 0; i < paStrSize; ++i){
+    nHash ^= static_cast<TForteByte>(paStr[i]);
+    nHash *= 16777619U;
   }
-
-  int r = 0;
-
-  unsigned int low = 0, high = mNrOfStrings;
-
-  while(low < high){
-    paIdx = (low + high) / 2;
-
-    r = strcmp(paStr, getStringAddress(mStringIdBufAddr[paIdx]));
-
-    if(!r){
-      return mStringIdBufAddr[paIdx];
-    }
-
-    if(r > 0) {
-      low = paIdx + 1;
-    } else {
-      high = paIdx;
-    }
-  }
-
-  if(r > 0) {
-    paIdx++;
-  }
-
-  return scmInvalidStringId;
+  return nHash;
 }
 
-// Find an exact match or place to be the new index
-CStringDictionary::TStringId CStringDictionary::findEntry(const char *paStr, size_t paStrSize, unsigned int &paIdx) const{
-  paIdx = 0;
-  if(mNrOfStrings == 0) {
+CStringDictionary::TStringId CStringDictionary::findEntry(const char *paStr, size_t paStrSize, TForteUInt32 paHash) const{
+  const SHashTable *table = mHashTable.load(std::memory_order_acquire);
+  if(nullptr == table){
     return scmInvalidStringId;
   }
-
-  int r = 0;
-
-  unsigned int low = 0, high = mNrOfStrings;
-
-  while(low < high){
-    paIdx = (low + high) / 2;
-
-    r = strncmp(paStr, getStringAddress(mStringIdBufAddr[paIdx]), paStrSize);
-    if(!r) {
-      r = -static_cast<int>(getStringAddress(mStringIdBufAddr[paIdx])[paStrSize]);
+  for(size_t idx = paHash & table->mMask;; idx = (idx + 1) & table->mMask){
+    const SHashSlot &slot = table->mSlots[idx];
+    TStringId id = slot.mId.load(std::memory_order_acquire);
+    if(scmInvalidStringId == id){
+      return scmInvalidStringId;
     }
-
-    if(!r){
-      return mStringIdBufAddr[paIdx];
+    if(slot.mHash == paHash){
+      const char *str = getStringAddress(id);
+      if(0 == strncmp(str, paStr, paStrSize) && '\0' == str[paStrSize]){
+        return id;
+      }
     }
+  }
+}
 
-    if(r > 0) {
-      low = paIdx + 1;
-    } else {
-      high = paIdx;
+CStringDictionary::TStringId CStringDictionary::appendString(const char *paStr, size_t paStrSize){
+  unsigned int nrOfChunks = mNrOfChunks.load(std::memory_order_relaxed);
+  SStringChunk *chunk = &mChunks[nrOfChunks - 1];
+  size_t used = chunk->mUsed.load(std::memory_order_relaxed);
+  if(used + paStrSize + 1 > chunk->mSize){
+    //the rest of the current chunk stays unused, the strings are not moved
+    if(!addChunk(paStrSize + 1)){
+      return scmInvalidStringId;
     }
+    chunk = &mChunks[nrOfChunks];
+    used = 0;
   }
 
-  if(r > 0) {
-    paIdx++;
-  }
+  char *p = chunk->mAddr + used;
+  memcpy(p, paStr, paStrSize);
+  p[paStrSize] = '\0';
+  chunk->mUsed.store(used + paStrSize + 1, std::memory_order_release);
+  return chunk->mFirstId + used;
+}
 
-  return scmInvalidStringId;
+bool CStringDictionary::addChunk(size_t paMinSize){
+#ifdef FORTE_STRING_DICT_FIXED_MEMORY
+  (void) paMinSize;
+  return false;
+#else
+  unsigned int nrOfChunks = mNrOfChunks.load(std::memory_order_relaxed);
+  if(nrOfChunks >= scmMaxNrOfChunks){
+    DEVLOG_ERROR("[CStringDictionary] Maximum number of string buffer chunks reached\n");
+    return false;
+  }
+  //grow exponentially by 1.5 according to Herb Sutter best strategy
+  size_t size = std::max(std::max(static_cast<size_t>(cgStringDictInitialStringBufSize), mStringBufSize >> 1), paMinSize);
+  char *adr = static_cast<char *>(forte_malloc(size * sizeof(char)));
+  if(nullptr == adr){
+    return false;
+  }
+  SStringChunk &chunk = mChunks[nrOfChunks];
+  chunk.mAddr = adr;
+  chunk.mFirstId = mStringBufSize;
+  chunk.mSize = size;
+  chunk.mUsed.store(0, std::memory_order_relaxed);
+  mStringBufSize += size;
+  mNrOfChunks.store(nrOfChunks + 1, std::memory_order_release);
+  return true;
+#endif
 }
 
-// Reallocate the Id buffer
-bool CStringDictionary::reallocateStringIdBuf(unsigned int paNewMaxNrOfStrings){
-  bool bRetval = true;
-  if(paNewMaxNrOfStrings > mMaxNrOfStrings){
-    TStringId *adr = (TStringId *) forte_malloc(paNewMaxNrOfStrings * sizeof(TStringId));
-    if(nullptr != adr){
-      memcpy(adr, mStringIdBufAddr, mMaxNrOfStrings * sizeof(TStringId));
-      TStringId *oldData = mStringIdBufAddr;
-      mStringIdBufAddr = adr;
-      mMaxNrOfStrings = paNewMaxNrOfStrings;
-      forte_free(oldData);
-    }
-    else{
-      bRetval = false;
-    }
+void CStringDictionary::addToIndex(TStringId paId, TForteUInt32 paHash){
+  SHashTable *table = mHashTable.load(std::memory_order_relaxed);
+  size_t idx = paHash & table->mMask;
+  while(scmInvalidStringId != table->mSlots[idx].mId.load(std::memory_order_relaxed)){
+    idx = (idx + 1) & table->mMask;
   }
-  return bRetval;
+  table->mSlots[idx].mHash = paHash;
+  table->mSlots[idx].mId.store(paId, std::memory_order_release);
 }
 
-// Reallocate the string buffer
-bool CStringDictionary::reallocateStringBuf(size_t paNewBufSize){
-  bool bRetval = true;
-  if(paNewBufSize > mStringBufSize){
-    char *adr = (char *) forte_malloc(paNewBufSize * sizeof(char));
-    if(nullptr != adr){
-      memcpy(adr, mStringBufAddr, mStringBufSize * sizeof(char));
-      char *oldData = mStringBufAddr;
-      mStringBufAddr = adr;
-      mStringBufSize = paNewBufSize;
-      forte_free(oldData);
-    }
-    else{
-      bRetval = false;
+bool CStringDictionary::growIndex(){
+#ifdef FORTE_STRING_DICT_FIXED_MEMORY
+  //the fixed index is large enough for cgStringDictInitialMaxNrOfStrings
+  return true;
+#else
+  SHashTable *oldTable = mHashTable.load(std::memory_order_relaxed);
+  SHashTable *table = new SHashTable;
+  table->mMask = 2 * oldTable->mMask + 1;
+  table->mSlots = new SHashSlot[table->mMask + 1];
+  table->mRetired = oldTable;
+  for(size_t i = 0; i <= table->mMask; ++i){
+    table->mSlots[i].mId.store(scmInvalidStringId, std::memory_order_relaxed);
+  }
+  for(size_t i = 0; i <= oldTable->mMask; ++i){
+    const SHashSlot &slot = oldTable->mSlots[i];
+    TStringId id = slot.mId.load(std::memory_order_relaxed);
+    if(scmInvalidStringId != id){
+      size_t idx = slot.mHash & table->mMask;
+      while(scmInvalidStringId != table->mSlots[idx].mId.load(std::memory_order_relaxed)){
+        idx = (idx + 1) & table->mMask;
+      }
+      table->mSlots[idx].mHash = slot.mHash;
+      table->mSlots[idx].mId.store(id, std::memory_order_relaxed);
     }
   }
-  return bRetval;
+  //readers may still probe the old table, it is freed together with the dictionary
+  mHashTable.store(table, std::memory_order_release);
+  return true;
+#endif
 }
 
-// Insert the string at the specified position
-CStringDictionary::TStringId CStringDictionary::insertAt(const char *paStr, unsigned int paIdx, size_t paLen){
-  TStringId id = mNextString;
-  char *p = getStringAddress(mNextString);
-
-  memcpy(p, paStr, paLen);
-  p[paLen] = '\0';
-  mNextString += paLen + 1;
-
-  if(paIdx < mNrOfStrings) {
-    memmove(mStringIdBufAddr + paIdx + 1, mStringIdBufAddr + paIdx, (mNrOfStrings - paIdx) * sizeof(TStringId));
+const CStringDictionary::SStringChunk *CStringDictionary::findChunk(TStringId paId) const{
+  const unsigned int nrOfChunks = mNrOfChunks.load(std::memory_order_acquire);
+  if(0 == nrOfChunks || paId >= mChunks[nrOfChunks - 1].mFirstId + mChunks[nrOfChunks - 1].mSize){
+    return nullptr;
   }
+  //last chunk starting at or before paId
+  const SStringChunk *chunk = std::upper_bound(mChunks, mChunks + nrOfChunks, paId,
+      [](TStringId paValue, const SStringChunk &paChunk){
+        return paValue < paChunk.mFirstId;
+      });
+  return chunk - 1;
+}
 
-  mStringIdBufAddr[paIdx] = id;
-  mNrOfStrings++;
-
-  return id;
+const char *CStringDictionary::getStringAddress(TStringId paId) const{
+  const SStringChunk *chunk = findChunk(paId);
+  return chunk->mAddr + (paId - chunk->mFirstId);
 }
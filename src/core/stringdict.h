@@ -20,12 +20,21 @@
 #include "forte_config.h"
 #include "utils/singlet.h"
 #include "datatype.h"
+#include <forte_sync.h>
 
+#include <atomic>
 #include <limits>
+#include <string.h>
 
 /**\ingroup CORE\brief Manages a dictionary of strings that can be referenced by ids
  *
- * Manages a dictionary of strings that can be referenced by ids
+ * Manages a dictionary of strings that can be referenced by ids. The strings are kept in an append-only arena of
+ * chunks which are never moved, so pointers returned by get() stay valid for the lifetime of the dictionary. Ids are
+ * the offset of the string in the concatenation of all chunks. A hash index from the string to its id allows
+ * lookups without comparing against other strings.
+ *
+ * get() and getId() do not lock and may be called from any thread while another thread inserts. Concurrent
+ * inserts are serialized.
  */
 // cppcheck-suppress noConstructor
 class CStringDictionary{
@@ -65,8 +74,8 @@ public:
    * \return id of the string (or scmInvalidStringId if it is not in the dictionary)
    */
   TStringId getId(const char *paStr) const{
-    unsigned int nIdx;
-    return findEntry(paStr, nIdx);
+    const size_t strSize = strlen(paStr);
+    return findEntry(paStr, strSize, hash(paStr, strSize));
   }
 
   /*!\brief Retrieve the Id of a given string if it is already in the dictionary
@@ -76,51 +85,70 @@ public:
    * \return id of the string (or scmInvalidStringId if it is not in the dictionary)
    */
   TStringId getId(const char *paStr, size_t paStrSize) const{
-    unsigned int nIdx;
-    return findEntry(paStr, paStrSize, nIdx);
+    return findEntry(paStr, paStrSize, hash(paStr, paStrSize));
   }
 private:
+  //! Part of the arena, holding the strings with the ids mFirstId to mFirstId + mSize - 1
+  struct SStringChunk{
+    char *mAddr;
+    TStringId mFirstId;
+    size_t mSize;
+    std::atomic<size_t> mUsed; //!< bytes written so far, only strings below are valid
+  };
+
+  struct SHashSlot{
+    std::atomic<TStringId> mId; //!< written last, scmInvalidStringId for an empty slot
+    TForteUInt32 mHash;
+  };
+
+  //! Open addressing hash index with linear probing, the number of slots is a power of two
+  struct SHashTable{
+    SHashSlot *mSlots;
+    size_t mMask;
+    SHashTable *mRetired; //!< smaller table replaced by this one, kept for readers still probing it
+  };
+
+  //! Enough for a string buffer growing by 1.5 up to several GB
+  static const unsigned int scmMaxNrOfChunks = 48;
+
   //!\brief Remove all dictionary entries
   void clear();
 
-  // Find an exact match or place to be the new index
-  TStringId findEntry(const char *paStr, unsigned int &paIdx) const;
-  TStringId findEntry(const char *paStr, size_t paStrSize, unsigned int &paIdx) const;
+  static TForteUInt32 hash(const char *paStr, size_t paStrSize);
+
+  TStringId findEntry(const char *paStr, size_t paStrSize, TForteUInt32 paHash) const;
+
+  //! Copy the string to the arena, only to be called by the writer
+  TStringId appendString(const char *paStr, size_t paStrSize);
+  bool addChunk(size_t paMinSize);
 
-  // Reallocate the buffer
-  bool reallocateStringIdBuf(unsigned int paNewMaxNrOfStrings);
-  bool reallocateStringBuf(size_t paNewBufSize);
+  //! Make the string known to readers, only to be called by the writer
+  void addToIndex(TStringId paId, TForteUInt32 paHash);
+  bool growIndex();
 
-  // Insert the string at the specified position
-  TStringId insertAt(const char *paStr, unsigned int paIdx, size_t paLen);
+  const SStringChunk *findChunk(TStringId paId) const;
 
   // Get an address
-  const char *getStringAddress(TStringId paId) const {
-    return mStringBufAddr + paId;
-  };
+  const char *getStringAddress(TStringId paId) const;
 
-  char *getStringAddress(TStringId paId) {
-    return mStringBufAddr + paId;
-  };
+  //! Chunks of the arena, published to readers by incrementing mNrOfChunks
+  SStringChunk mChunks[scmMaxNrOfChunks];
+  std::atomic<unsigned int> mNrOfChunks;
 
-  //!Buffer for the String Ids. The Ids are sorted according to their values they are pointing at
-  TStringId *mStringIdBufAddr;
+  std::atomic<SHashTable *> mHashTable;
 
-  //! Buffer for the strings
-  char *mStringBufAddr;
+  //! Serializes the inserts
+  CSyncObject mWriteLock;
 
-  // Size of the allocated space
+  // Size of the allocated space over all chunks
   size_t mStringBufSize;
 
-  // Maximum number of strings we can hold (size of the StringIdBufer)
+  // Maximum number of strings we can hold
   unsigned int mMaxNrOfStrings;
 
   // Number of strings we are actually holding
   unsigned int mNrOfStrings;
 
-  // Next string gets written here
-  TStringId mNextString;
-
 #ifdef FORTE_STRING_DICT_FIXED_MEMORY
   static TStringId scmIdList[cgStringDictInitialMaxNrOfStrings];
   static char scmConstStringBuf[cgStringDictInitialStringBufSize];
@@ -23,7 +23,117 @@
 #include "resource.h"
 #include "if2indco.h"
 #include "adapter.h"
+#include "utils/criticalregion.h"
 #include <stddef.h>
+#include <atomic>
+
+namespace {
+  /*!\brief Hash index from type name ids to the entries of a type list
+   *
+   * Only plain data with static storage, so it is zero initialized before the type entries register themselves
+   * during static initialization.
+   *
+   * Lookups do not lock. Entries are published slot by slot and a grown table replaces the old one atomically. The old
+   * table is retired instead of deleted, as readers may still probe it; together the retired tables are smaller than
+   * the current one. Adding entries has to be serialized by the caller, as is adding to the type lists.
+   */
+  struct STypeIndex{
+    struct SSlot{
+      CStringDictionary::TStringId mTypeId;
+      std::atomic<CTypeLib::CTypeEntry *> mEntry; //!< written last, nullptr for an empty slot
+    };
+
+    struct STable{
+      SSlot *mSlots;
+      size_t mMask;
+      STable *mRetired; //!< smaller table replaced by this one, kept for readers still probing it
+    };
+
+    std::atomic<STable *> mTable;
+    size_t mNrOfEntries;
+  };
+
+  STypeIndex gFBTypeIndex;
+  STypeIndex gAdapterTypeIndex;
+  STypeIndex gDTTypeIndex;
+
+  //! configured generic FB types (e.g., PUBLISH_3) mapped to the entry of their GEN_ type
+  STypeIndex gGenericFBTypeIndex;
+
+  size_t getFirstSlot(CStringDictionary::TStringId paTypeId, const STypeIndex::STable &paTable) {
+    //Fibonacci hashing spreads the string dictionary offsets evenly
+    return static_cast<size_t>((static_cast<TForteUInt64>(paTypeId) * 11400714819323198485ULL) >> 32) & paTable.mMask;
+  }
+
+  CTypeLib::CTypeEntry *findInIndex(CStringDictionary::TStringId paTypeId, const STypeIndex &paIndex) {
+    const STypeIndex::STable *table = paIndex.mTable.load(std::memory_order_acquire);
+    if(nullptr != table) {
+      for(size_t idx = getFirstSlot(paTypeId, *table);; idx = (idx + 1) & table->mMask) {
+        CTypeLib::CTypeEntry *entry = table->mSlots[idx].mEntry.load(std::memory_order_acquire);
+        if(nullptr == entry) {
+          break;
+        }
+        if(paTypeId == table->mSlots[idx].mTypeId) {
+          return entry;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  void insertIntoSlots(CStringDictionary::TStringId paTypeId, CTypeLib::CTypeEntry *paEntry, STypeIndex::STable &paTable) {
+    size_t idx = getFirstSlot(paTypeId, paTable);
+    while(nullptr != paTable.mSlots[idx].mEntry.load(std::memory_order_relaxed)) {
+      idx = (idx + 1) & paTable.mMask;
+    }
+    paTable.mSlots[idx].mTypeId = paTypeId;
+    paTable.mSlots[idx].mEntry.store(paEntry, std::memory_order_release);
+  }
+
+  void addToIndex(CStringDictionary::TStringId paTypeId, CTypeLib::CTypeEntry *paEntry, STypeIndex &paIndex) {
+    STypeIndex::STable *table = paIndex.mTable.load(std::memory_order_relaxed);
+    //keep the index at most half full so that probe sequences stay short
+    if(nullptr == table || 2 * (paIndex.mNrOfEntries + 1) > table->mMask + 1) {
+      STypeIndex::STable *newTable = new STypeIndex::STable;
+      newTable->mMask = (nullptr != table) ? 2 * table->mMask + 1 : 63;
+      newTable->mSlots = new STypeIndex::SSlot[newTable->mMask + 1]();
+      newTable->mRetired = table;
+      if(nullptr != table) {
+        for(size_t i = 0; i <= table->mMask; ++i) {
+          CTypeLib::CTypeEntry *entry = table->mSlots[i].mEntry.load(std::memory_order_relaxed);
+          if(nullptr != entry) {
+            insertIntoSlots(table->mSlots[i].mTypeId, entry, *newTable);
+          }
+        }
+      }
+      paIndex.mTable.store(newTable, std::memory_order_release);
+      table = newTable;
+    }
+    insertIntoSlots(paTypeId, paEntry, *table);
+    ++paIndex.mNrOfEntries;
+  }
+
+  STypeIndex *getIndex(const CTypeLib::CTypeEntry *paListStart) {
+    if(nullptr != paListStart) {
+      if(paListStart == CTypeLib::getFBLibStart()) {
+        return &gFBTypeIndex;
+      }
+      if(paListStart == CTypeLib::getAdapterLibStart()) {
+        return &gAdapterTypeIndex;
+      }
+      if(paListStart == CTypeLib::getDTLibStart()) {
+        return &gDTTypeIndex;
+      }
+    }
+    return nullptr;
+  }
+
+  //! generic types are added at runtime by the management commands of all devices, the lock serializes the inserts
+  CSyncObject &getGenericFBTypeIndexLock() {
+    static CSyncObject sLock;
+    return sLock;
+  }
+}
 
 CTypeLib::CTypeEntry::CTypeEntry(CStringDictionary::TStringId paTypeNameId) :
   mTypeNameId(paTypeNameId),
@@ -78,6 +188,11 @@ CTypeLib::CDataTypeEntry *CTypeLib::mDTLibStart = nullptr;
 CTypeLib::CDataTypeEntry *CTypeLib::mDTLibEnd = nullptr;
 
 CTypeLib::CTypeEntry *CTypeLib::findType(CStringDictionary::TStringId paTypeId, CTypeLib::CTypeEntry *paListStart) {
+  const STypeIndex *index = getIndex(paListStart);
+  if(nullptr != index) {
+    return findInIndex(paTypeId, *index);
+  }
+
   CTypeEntry *retval = nullptr;
   for (CTypeEntry *poRunner = paListStart; poRunner != nullptr; poRunner
       = poRunner->mNext){
@@ -122,33 +237,19 @@ CFunctionBlock *CTypeLib::createFB(CStringDictionary::TStringId paInstanceNameId
       mLastErrorMSG = EMGMResponse::Overflow;
     }
   } else { //check for parameterizable FBs (e.g. SERVER)
-    TIdentifier acGenFBName = { "GEN_" };
     const char *acTypeBuf = CStringDictionary::getInstance().get(paFBTypeId);
-    const char *pcUnderScore = getFirstNonTypeNameUnderscorePos(acTypeBuf);
-
-    if (nullptr != pcUnderScore) { // We found no underscore in the type name therefore it can not be a generic type
-      ptrdiff_t nCopyLen = pcUnderScore - acTypeBuf;
-      if(nCopyLen > static_cast<ptrdiff_t>(cgIdentifierLength - 4)) {
-        nCopyLen = cgIdentifierLength - 4;
+    poToCreate = (nullptr != acTypeBuf) ? findGenericFBType(paFBTypeId, acTypeBuf) : nullptr;
+    if (nullptr != poToCreate) {
+      poNewFB = (static_cast<CFBTypeEntry *>(poToCreate))->createFBInstance(paInstanceNameId, paContainer);
+      if (nullptr == poNewFB){ // we could not create the requested object
+        mLastErrorMSG = EMGMResponse::Overflow;
       }
-      memcpy(&(acGenFBName[4]), acTypeBuf, nCopyLen);
-      acGenFBName[cgIdentifierLength] = '\0';
-      poToCreate = findType(CStringDictionary::getInstance().getId(acGenFBName), mFBLibStart);
-      if (nullptr != poToCreate) {
-        poNewFB = (static_cast<CFBTypeEntry *>(poToCreate))->createFBInstance(paInstanceNameId, paContainer);
-        if (nullptr == poNewFB){ // we could not create the requested object
-          mLastErrorMSG = EMGMResponse::Overflow;
-        }
-        else { // we got a configurable block
-          if (!poNewFB->configureFB(acTypeBuf)) {
-            deleteFB(poNewFB);
-            poNewFB = nullptr;
-          }
+      else { // we got a configurable block
+        if (!poNewFB->configureFB(acTypeBuf)) {
+          deleteFB(poNewFB);
+          poNewFB = nullptr;
         }
       }
-      else{
-        mLastErrorMSG = EMGMResponse::UnsupportedType;
-      }
     }
     else{
       mLastErrorMSG = EMGMResponse::UnsupportedType;
@@ -163,6 +264,34 @@ CFunctionBlock *CTypeLib::createFB(CStringDictionary::TStringId paInstanceNameId
   return poNewFB;
 }
 
+CTypeLib::CFBTypeEntry *CTypeLib::findGenericFBType(CStringDictionary::TStringId paFBTypeId, const char *paFBTypeName) {
+  //slots and tables are published with release, so configured types are found without taking the lock
+  CTypeEntry *cachedEntry = findInIndex(paFBTypeId, gGenericFBTypeIndex);
+  if(nullptr != cachedEntry) {
+    return static_cast<CFBTypeEntry *>(cachedEntry);
+  }
+
+  const char *pcUnderScore = getFirstNonTypeNameUnderscorePos(paFBTypeName);
+  if (nullptr == pcUnderScore) { // We found no underscore in the type name therefore it can not be a generic type
+    return nullptr;
+  }
+  TIdentifier acGenFBName = { "GEN_" };
+  ptrdiff_t nCopyLen = pcUnderScore - paFBTypeName;
+  if(nCopyLen > static_cast<ptrdiff_t>(cgIdentifierLength - 4)) {
+    nCopyLen = cgIdentifierLength - 4;
+  }
+  memcpy(&(acGenFBName[4]), paFBTypeName, nCopyLen);
+  acGenFBName[cgIdentifierLength] = '\0';
+  CTypeEntry *entry = findType(CStringDictionary::getInstance().getId(acGenFBName), mFBLibStart);
+  if(nullptr != entry) {
+    CCriticalRegion region(getGenericFBTypeIndexLock());
+    if(nullptr == findInIndex(paFBTypeId, gGenericFBTypeIndex)) {
+      addToIndex(paFBTypeId, entry, gGenericFBTypeIndex);
+    }
+  }
+  return static_cast<CFBTypeEntry *>(entry);
+}
+
 bool CTypeLib::deleteFB(CFunctionBlock *paFBToDelete) {
   delete paFBToDelete;
   return true;
@@ -191,6 +320,7 @@ void CTypeLib::addFBType(CFBTypeEntry *paFBTypeEntry) {
       mFBLibEnd->mNext = paFBTypeEntry;
     }
     mFBLibEnd = paFBTypeEntry;
+    addToIndex(paFBTypeEntry->getTypeNameId(), paFBTypeEntry, gFBTypeIndex);
   }
 }
 
@@ -202,6 +332,7 @@ void CTypeLib::addAdapterType(CAdapterTypeEntry *paAdapterTypeEntry) {
       mAdapterLibEnd->mNext = paAdapterTypeEntry;
     }
     mAdapterLibEnd = paAdapterTypeEntry;
+    addToIndex(paAdapterTypeEntry->getTypeNameId(), paAdapterTypeEntry, gAdapterTypeIndex);
   }
 }
 
@@ -214,6 +345,7 @@ void CTypeLib::addDataType(CDataTypeEntry *paDTEntry) {
       mDTLibEnd->mNext = paDTEntry;
     }
     mDTLibEnd = paDTEntry;
+    addToIndex(paDTEntry->getTypeNameId(), paDTEntry, gDTTypeIndex);
   }
 }
 
@@ -54,7 +54,7 @@ namespace forte {
     const static CTypeLib::CFBTypeEntry csmFirmwareFBEntry_##fbclass; \
   public:  \
     static CFunctionBlock *createFB(CStringDictionary::TStringId paInstanceNameId, forte::core::CFBContainer &paContainer){ \
-      return new fbclass( paInstanceNameId, paContainer);\
+      return new(paContainer) fbclass( paInstanceNameId, paContainer);\
     }; \
     FORTE_DUMMY_INIT_DEC \
   private:
@@ -88,7 +88,7 @@ namespace forte {
     const static CTypeLib::CAdapterTypeEntry csmAdapterTypeEntry_##adapterclass; \
   public:  \
     static CAdapter *createAdapter(CStringDictionary::TStringId paInstanceNameId, forte::core::CFBContainer &paContainer, bool paIsPlug){\
-      return new adapterclass(paInstanceNameId, paContainer, paIsPlug);\
+      return new(paContainer) adapterclass(paInstanceNameId, paContainer, paIsPlug);\
     }; \
     CStringDictionary::TStringId getFBTypeId() const override {return (csmAdapterTypeEntry_##adapterclass.getTypeNameId()); };\
     FORTE_DUMMY_INIT_DEC \
@@ -255,6 +255,10 @@ public:
  */
   static CTypeEntry *getDTLibStart() { return mDTLibStart; }
 
+/*!\brief Find the entry of a type in a type list
+ *
+ * The FB, adapter, and data type lists are looked up through a hash index, other lists are searched linearly.
+ */
   static CTypeEntry *findType(CStringDictionary::TStringId paTypeId, CTypeEntry *paListStart);
 
 protected:
@@ -273,6 +277,12 @@ private:
   static CDataTypeEntry *mDTLibStart, //!< pointer to the begin of the data type library
                  *mDTLibEnd; //!< pointer to the end of the data type library
 
+  /*!\brief Find the GEN_ entry for a configured generic FB type (e.g., GEN_PUBLISH for PUBLISH_3)
+   *
+   * The result is cached per configured type, so the type name is only parsed on its first instantiation.
+   */
+  static CFBTypeEntry *findGenericFBType(CStringDictionary::TStringId paFBTypeId, const char *paFBTypeName);
+
   //! find the position of the first underscore that marks the end of the type name and the beginning of the generic part
   static const char* getFirstNonTypeNameUnderscorePos(const char* paTypeName);
 };
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include "arena.h"
+#include <algorithm>
+#include <new>
+
+using namespace forte::core::util;
+
+CArena::CArena(std::size_t paChunkSize) :
+    mChunkSize(alignUp(paChunkSize)), mChunks(nullptr), mCurrent(nullptr), mEnd(nullptr),
+    mFreeLists(new SFreeBlock*[mChunkSize / 4 / scmAlignment]()), mNumAllocations(0), mAllocatedBytes(0),
+    mReservedBytes(0) {
+}
+
+CArena::~CArena() {
+  release();
+  delete[] mFreeLists;
+}
+
+void *CArena::allocate(std::size_t paSize) {
+  const std::size_t size = alignUp((0 != paSize) ? paSize : 1);
+  void *memory;
+  if(isLargeAllocation(size)) {
+    //large allocation: a chunk of its own, linked behind the current chunk so that bumping continues in the current one
+    SChunk *chunk = allocateChunk(size);
+    if(nullptr != mChunks) {
+      chunk->mNext = mChunks->mNext;
+      mChunks->mNext = chunk;
+    } else {
+      mChunks = chunk;
+    }
+    memory = chunk + 1;
+  } else if(SFreeBlock *&freeList = getFreeList(size); nullptr != freeList) {
+    memory = freeList;
+    freeList = freeList->mNext;
+  } else {
+    if(static_cast<std::size_t>(mEnd - mCurrent) < size) {
+      SChunk *chunk = allocateChunk(mChunkSize);
+      chunk->mNext = mChunks;
+      mChunks = chunk;
+      mCurrent = reinterpret_cast<char*>(chunk + 1);
+      mEnd = mCurrent + mChunkSize;
+    }
+    memory = mCurrent;
+    mCurrent += size;
+  }
+  ++mNumAllocations;
+  mAllocatedBytes += size;
+  return memory;
+}
+
+void CArena::deallocate(void *paMemory, std::size_t paSize) {
+  if(nullptr == paMemory) {
+    return;
+  }
+  if(0 == --mNumAllocations) {
+    //nothing allocated from this arena is alive anymore, start over with fresh chunks
+    release();
+    return;
+  }
+  const std::size_t size = alignUp((0 != paSize) ? paSize : 1);
+  mAllocatedBytes -= size;
+  if(isLargeAllocation(size)) {
+    freeLargeAllocation(paMemory);
+  } else {
+    SFreeBlock *&freeList = getFreeList(size);
+    freeList = new(paMemory) SFreeBlock{freeList};
+  }
+}
+
+void CArena::release() {
+  while(nullptr != mChunks) {
+    SChunk *next = mChunks->mNext;
+    ::operator delete(mChunks);
+    mChunks = next;
+  }
+  mCurrent = nullptr;
+  mEnd = nullptr;
+  std::fill_n(mFreeLists, mChunkSize / 4 / scmAlignment, nullptr);
+  mNumAllocations = 0;
+  mAllocatedBytes = 0;
+  mReservedBytes = 0;
+}
+
+CArena::SChunk *CArena::allocateChunk(std::size_t paSize) {
+  mReservedBytes += paSize;
+  return new(::operator new(sizeof(SChunk) + paSize)) SChunk{nullptr, paSize};
+}
+
+void CArena::freeLargeAllocation(void *paMemory) {
+  for(SChunk **chunk = &mChunks; nullptr != *chunk; chunk = &(*chunk)->mNext) {
+    if(paMemory == *chunk + 1) {
+      SChunk *freed = *chunk;
+      *chunk = freed->mNext;
+      mReservedBytes -= freed->mSize;
+      ::operator delete(freed);
+      return;
+    }
+  }
+}
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#pragma once
+
+#include <cstddef>
+
+namespace forte::core::util {
+
+  /*!\brief Bump allocator handing out memory from large chunks
+   *
+   * Allocating only moves a pointer inside the current chunk, so objects allocated one after the other are placed
+   * next to each other. Freed allocations are kept in a free list per size, from which allocations of the same size
+   * are served first, so creating and deleting FBs at runtime does not let the arena grow without bounds. All chunks
+   * are freed in one step, either with release or automatically when the last live allocation is freed.
+   *
+   * All allocations are aligned for any fundamental type. Allocations larger than a quarter of the chunk size get a
+   * chunk of their own, so that they don't waste the rest of the current chunk. This chunk is freed with the
+   * allocation.
+   *
+   * This class is not thread-safe.
+   */
+  class CArena {
+    public:
+      explicit CArena(std::size_t paChunkSize);
+      ~CArena();
+
+      CArena(const CArena&) = delete;
+      CArena& operator=(const CArena&) = delete;
+
+      //! @return memory for paSize bytes, new chunks are allocated with operator new
+      void *allocate(std::size_t paSize);
+
+      //! Make an allocation of paSize bytes available again, nullptr is ignored
+      void deallocate(void *paMemory, std::size_t paSize);
+
+      //! Free all chunks, all memory handed out by this arena becomes invalid
+      void release();
+
+      //! number of allocations not freed yet
+      std::size_t getNumAllocations() const {
+        return mNumAllocations;
+      }
+
+      //! bytes of the allocations not freed yet
+      std::size_t getAllocatedBytes() const {
+        return mAllocatedBytes;
+      }
+
+      //! bytes of all chunks held by this arena
+      std::size_t getReservedBytes() const {
+        return mReservedBytes;
+      }
+
+      static constexpr std::size_t scmAlignment = alignof(std::max_align_t);
+
+    private:
+      //! chunk header, the chunk's memory follows it
+      struct alignas(scmAlignment) SChunk {
+          SChunk *mNext;
+          std::size_t mSize;
+      };
+
+      //! a freed allocation while it is in a free list
+      struct SFreeBlock {
+          SFreeBlock *mNext;
+      };
+
+      SChunk *allocateChunk(std::size_t paSize);
+      void freeLargeAllocation(void *paMemory);
+
+      bool isLargeAllocation(std::size_t paAlignedSize) const {
+        return paAlignedSize > mChunkSize / 4;
+      }
+
+      SFreeBlock *&getFreeList(std::size_t paAlignedSize) {
+        return mFreeLists[paAlignedSize / scmAlignment - 1];
+      }
+
+      static constexpr std::size_t alignUp(std::size_t paSize) {
+        return (paSize + scmAlignment - 1) & ~(scmAlignment - 1);
+      }
+
+      const std::size_t mChunkSize;
+      SChunk *mChunks; //!< all chunks, the first one is the current chunk unless it is a dedicated chunk of a large allocation
+      char *mCurrent; //!< next free byte of the current chunk
+      char *mEnd; //!< end of the current chunk
+      SFreeBlock **mFreeLists; //!< one list for each size up to a quarter of the chunk size, in steps of scmAlignment
+      std::size_t mNumAllocations;
+      std::size_t mAllocatedBytes;
+      std::size_t mReservedBytes;
+  };
+
+}
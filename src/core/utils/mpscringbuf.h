@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace forte::core::util {
+
+  //! Smallest power of two not less than value, e.g., for sizing ring buffers from configuration values
+  constexpr std::size_t roundUpToPowerOfTwo(std::size_t value) {
+    std::size_t result = 1;
+    while(result < value) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  /*!\brief Bounded lock-free ring buffer for several producers and one consumer
+   *
+   * Uses the same power of two indexing as CRingBuffer. Each slot carries a sequence number which tells producers
+   * and the consumer if the slot is free or holds a published element. Producers claim a slot with a CAS on the push
+   * index, so no mutex is needed on either side.
+   *
+   * pop() is meant to be used by a single consumer. It also claims its slot with a CAS such that an occasional
+   * draining from another thread (e.g., clearing on KILL from the management thread) keeps the buffer consistent.
+   */
+  template<typename T, std::size_t size>
+  class CMPSCRingBuffer {
+  public:
+    CMPSCRingBuffer() {
+      clear();
+    }
+
+    CMPSCRingBuffer(const CMPSCRingBuffer&) = delete;
+    CMPSCRingBuffer& operator=(const CMPSCRingBuffer&) = delete;
+
+    /*!\brief Add an element, may be called concurrently from several threads
+     *
+     * @return false if the buffer is full
+     */
+    bool push(const T &elem) {
+      std::size_t pos = mPushIndex.load(std::memory_order_relaxed);
+      for(;;) {
+        SSlot &slot = mData[pos & cmIndexMask];
+        std::size_t seq = slot.mSequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+        if(0 == diff) {
+          if(mPushIndex.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+            slot.mElem = elem;
+            slot.mSequence.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        } else if(diff < 0) {
+          return false; // slot still occupied from the previous round: full
+        } else {
+          pos = mPushIndex.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /*!\brief Add all elements or none of them, may be called concurrently from several threads
+     *
+     * The slots for all elements are claimed with a single CAS, so the elements are stored consecutively.
+     *
+     * @return false if the buffer has not enough free slots
+     */
+    bool pushAll(const T *elems, std::size_t num) {
+      if(0 == num) {
+        return true;
+      }
+      if(num > size) {
+        return false;
+      }
+      std::size_t pos = mPushIndex.load(std::memory_order_relaxed);
+      for(;;) {
+        std::size_t last = pos + num - 1;
+        auto firstDiff = static_cast<std::ptrdiff_t>(mData[pos & cmIndexMask].mSequence.load(std::memory_order_acquire) - pos);
+        auto lastDiff = static_cast<std::ptrdiff_t>(mData[last & cmIndexMask].mSequence.load(std::memory_order_acquire) - last);
+        if(0 == firstDiff && 0 == lastDiff) {
+          if(mPushIndex.compare_exchange_weak(pos, pos + num, std::memory_order_relaxed)) {
+            for(std::size_t i = 0; i < num; ++i) {
+              SSlot &slot = mData[(pos + i) & cmIndexMask];
+              // slots in between may still be read by a consumer which has already claimed them
+              while(slot.mSequence.load(std::memory_order_acquire) != pos + i) {
+              }
+              slot.mElem = elems[i];
+              slot.mSequence.store(pos + i + 1, std::memory_order_release);
+            }
+            return true;
+          }
+        } else if(firstDiff < 0 || lastDiff < 0) {
+          return false; // not enough free slots
+        } else {
+          pos = mPushIndex.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /*!\brief Retrieve the oldest published element
+     *
+     * @return false if the buffer is empty
+     */
+    bool pop(T &elem) {
+      std::size_t pos = mPopIndex.load(std::memory_order_relaxed);
+      for(;;) {
+        SSlot &slot = mData[pos & cmIndexMask];
+        std::size_t seq = slot.mSequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+        if(0 == diff) {
+          if(mPopIndex.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+            elem = slot.mElem;
+            slot.mSequence.store(pos + size, std::memory_order_release);
+            return true;
+          }
+        } else if(diff < 0) {
+          return false;
+        } else {
+          pos = mPopIndex.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /*!\brief Reset the buffer
+     *
+     * Must only be used while no other thread is accessing the buffer.
+     */
+    void clear() {
+      for(std::size_t i = 0; i < size; ++i) {
+        mData[i].mSequence.store(i, std::memory_order_relaxed);
+      }
+      mPopIndex.store(0, std::memory_order_relaxed);
+      mPushIndex.store(0, std::memory_order_release);
+    }
+
+    /*!\brief Check if a published element is available
+     *
+     * The result is only a snapshot as producers may add elements at any time.
+     */
+    bool isEmpty() const {
+      std::size_t pos = mPopIndex.load(std::memory_order_relaxed);
+      return mData[pos & cmIndexMask].mSequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    /*!\brief Check if an element equal to elem is currently published
+     *
+     * Each slot is read seqlock-like: the element is only compared if the slot sequence did not change while reading
+     * it. Slots concurrently being written or consumed are skipped, so the result is a best effort snapshot.
+     */
+    bool contains(const T &elem) const {
+      // load the pop index first so that it can never be ahead of the loaded push index
+      std::size_t pos = mPopIndex.load(std::memory_order_acquire);
+      std::size_t end = mPushIndex.load(std::memory_order_acquire);
+      for(; pos != end; ++pos) {
+        const SSlot &slot = mData[pos & cmIndexMask];
+        if(slot.mSequence.load(std::memory_order_acquire) == pos + 1) {
+          T candidate = slot.mElem;
+          std::atomic_thread_fence(std::memory_order_acquire);
+          if(slot.mSequence.load(std::memory_order_relaxed) == pos + 1 && candidate == elem) {
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
+    constexpr static std::size_t getCapacity() {
+      return size;
+    }
+
+    static_assert((size & (size - 1)) == 0, "size must be a power of 2");
+  private:
+    constexpr static std::size_t cmIndexMask = size - 1;
+
+    struct SSlot {
+      std::atomic<std::size_t> mSequence;
+      T mElem;
+    };
+
+    constexpr static std::size_t cmCacheLineSize = 64;
+
+    std::atomic<std::size_t> mPushIndex;
+    // padding keeps producers and the consumer off each other's cache line without needing over-aligned new
+    char mPadding[cmCacheLineSize - sizeof(std::atomic<std::size_t>)];
+    std::atomic<std::size_t> mPopIndex;
+    std::array<SSlot, size> mData;
+  };
+}
@@ -12,7 +12,10 @@
  *******************************************************************************/
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <type_traits>
 
 namespace forte::core::util {
 
@@ -21,7 +24,7 @@ namespace forte::core::util {
   public:
     CRingBuffer() = default;
 
-    bool push(T &elem) {
+    bool push(const T &elem) {
       if(isFull()) {
         return false;
       }
@@ -29,6 +32,24 @@ namespace forte::core::util {
       return true;
     }
 
+    /*!\brief Add all elements or none of them
+     *
+     * The free space is checked once and the elements are copied as at most two contiguous blocks.
+     *
+     * @return false if there is not enough free space for all elements, the buffer is left unchanged then
+     */
+    bool pushAll(const T *elems, std::size_t count) {
+      if(count > getFreeSpace()) {
+        return false;
+      }
+      std::size_t start = mPushIndex & cmIndexMask;
+      std::size_t firstPart = std::min(count, size - start);
+      copyElements(&mData[start], elems, firstPart);
+      copyElements(&mData[0], elems + firstPart, count - firstPart);
+      mPushIndex += count;
+      return true;
+    }
+
     T *pop() {
       if(isEmpty()) {
         return nullptr;
@@ -49,10 +70,42 @@ namespace forte::core::util {
       return mPushIndex == mPopIndex + cmIndexMask;
     }
 
+    constexpr std::size_t getNumberOfElements() const {
+      return mPushIndex - mPopIndex;
+    }
+
+    constexpr static std::size_t getCapacity() {
+      return cmIndexMask;
+    }
+
+    constexpr std::size_t getFreeSpace() const {
+      return getCapacity() - getNumberOfElements();
+    }
+
+    //! Check if an element equal to elem is currently stored, linear in the number of stored elements
+    bool contains(const T &elem) const {
+      for(std::size_t i = mPopIndex; i != mPushIndex; ++i) {
+        if(mData[i & cmIndexMask] == elem) {
+          return true;
+        }
+      }
+      return false;
+    }
+
     static_assert((size & (size - 1)) == 0, "size must be a power of 2");
   private:
     constexpr static std::size_t cmIndexMask = size - 1;
 
+    static void copyElements(T *dst, const T *src, std::size_t count) {
+      if constexpr (std::is_trivially_copyable_v<T>) {
+        if(0 != count) {
+          std::memcpy(dst, src, count * sizeof(T));
+        }
+      } else {
+        std::copy_n(src, count, dst);
+      }
+    }
+
     std::size_t mPopIndex;
     std::size_t mPushIndex;
     std::array<T, size> mData;
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace forte::core::util {
+
+  /*!\brief FIFO buffer built from a chain of fixed size segments which grows and shrinks on demand
+   *
+   * New segments are only linked to the tail, so elements are never moved or copied on growth. Drained segments are
+   * kept in a small pool of spare segments for reuse. Segments exceeding the pool size are freed, so the memory
+   * footprint shrinks again after a burst.
+   *
+   * Like CRingBuffer this class is not thread-safe.
+   */
+  template<typename T, std::size_t segmentSize>
+  class CSegmentedRingBuffer {
+  public:
+    /*!\brief Create an empty buffer, no segments are allocated until the first push
+     *
+     * @param paMaxSegments limits the capacity to paMaxSegments * segmentSize elements, one further segment may be in use
+     *                      while the consumed part of the head segment is not yet freed
+     * @param paMaxSpareSegments number of drained segments to keep for reuse
+     */
+    explicit CSegmentedRingBuffer(std::size_t paMaxSegments, std::size_t paMaxSpareSegments = 1) :
+        mHead(nullptr), mHeadIndex(0), mTail(nullptr), mTailIndex(0), mSpareSegments(nullptr), mNumSpareSegments(0),
+        mNumSegments(0), mMaxSegments(paMaxSegments), mMaxSpareSegments(paMaxSpareSegments), mNumberOfElements(0) {
+    }
+
+    ~CSegmentedRingBuffer() {
+      clear();
+      while(nullptr != mSpareSegments) {
+        SSegment *next = mSpareSegments->mNext;
+        delete mSpareSegments;
+        mSpareSegments = next;
+      }
+    }
+
+    CSegmentedRingBuffer(const CSegmentedRingBuffer&) = delete;
+    CSegmentedRingBuffer& operator=(const CSegmentedRingBuffer&) = delete;
+
+    bool push(const T &elem) {
+      if(mNumberOfElements >= getMaxCapacity()) {
+        return false;
+      }
+      if(nullptr == mTail || segmentSize == mTailIndex) {
+        SSegment *segment = acquireSegment();
+        if(nullptr == mTail) {
+          mHead = segment;
+          mHeadIndex = 0;
+        } else {
+          mTail->mNext = segment;
+        }
+        mTail = segment;
+        mTailIndex = 0;
+      }
+      mTail->mData[mTailIndex++] = elem;
+      ++mNumberOfElements;
+      return true;
+    }
+
+    /*!\brief Add all elements or none of them
+     *
+     * @return false if there is not enough free space for all elements, the buffer is left unchanged then
+     */
+    bool pushAll(const T *elems, std::size_t count) {
+      if(count > getFreeSpace()) {
+        return false;
+      }
+      for(std::size_t i = 0; i < count; ++i) {
+        push(elems[i]);
+      }
+      return true;
+    }
+
+    /*!\brief Remove the oldest element
+     *
+     * @return pointer to a copy of the element which stays valid until the next call to pop(), nullptr if empty
+     */
+    T *pop() {
+      if(isEmpty()) {
+        return nullptr;
+      }
+      mPopped = mHead->mData[mHeadIndex++];
+      --mNumberOfElements;
+      if(isEmpty()) {
+        // only one segment can be in use here, keep it and restart at its beginning
+        mHeadIndex = 0;
+        mTailIndex = 0;
+      } else if(segmentSize == mHeadIndex) {
+        SSegment *next = mHead->mNext;
+        releaseSegment(mHead);
+        mHead = next;
+        mHeadIndex = 0;
+      }
+      return &mPopped;
+    }
+
+    //! Remove all elements and give back all segments
+    void clear() {
+      while(nullptr != mHead) {
+        SSegment *next = mHead->mNext;
+        releaseSegment(mHead);
+        mHead = next;
+      }
+      mTail = nullptr;
+      mHeadIndex = 0;
+      mTailIndex = 0;
+      mNumberOfElements = 0;
+    }
+
+    bool isEmpty() const {
+      return 0 == mNumberOfElements;
+    }
+
+    std::size_t getNumberOfElements() const {
+      return mNumberOfElements;
+    }
+
+    //! Number of elements which fit into the currently allocated segments
+    std::size_t getCapacity() const {
+      return mNumSegments * segmentSize;
+    }
+
+    std::size_t getMaxCapacity() const {
+      return mMaxSegments * segmentSize;
+    }
+
+    //! Number of elements which can still be added
+    std::size_t getFreeSpace() const {
+      return getMaxCapacity() - mNumberOfElements;
+    }
+
+    //! Check if an element equal to elem is currently stored, linear in the number of stored elements
+    bool contains(const T &elem) const {
+      std::size_t index = mHeadIndex;
+      for(const SSegment *segment = mHead; nullptr != segment; segment = segment->mNext) {
+        std::size_t end = (segment == mTail) ? mTailIndex : segmentSize;
+        for(; index < end; ++index) {
+          if(segment->mData[index] == elem) {
+            return true;
+          }
+        }
+        index = 0;
+      }
+      return false;
+    }
+
+  private:
+    struct SSegment {
+      std::array<T, segmentSize> mData;
+      SSegment *mNext;
+    };
+
+    SSegment *acquireSegment() {
+      SSegment *segment = mSpareSegments;
+      if(nullptr != segment) {
+        mSpareSegments = segment->mNext;
+        --mNumSpareSegments;
+      } else {
+        segment = new SSegment;
+        ++mNumSegments;
+      }
+      segment->mNext = nullptr;
+      return segment;
+    }
+
+    void releaseSegment(SSegment *paSegment) {
+      if(mNumSpareSegments < mMaxSpareSegments) {
+        paSegment->mNext = mSpareSegments;
+        mSpareSegments = paSegment;
+        ++mNumSpareSegments;
+      } else {
+        delete paSegment;
+        --mNumSegments;
+      }
+    }
+
+    SSegment *mHead; //!< segment to pop from
+    std::size_t mHeadIndex;
+    SSegment *mTail; //!< segment to push to
+    std::size_t mTailIndex;
+    SSegment *mSpareSegments; //!< pool of drained segments kept for reuse
+    std::size_t mNumSpareSegments;
+    std::size_t mNumSegments; //!< number of allocated segments including the spare ones
+    std::size_t mMaxSegments;
+    std::size_t mMaxSpareSegments;
+    std::size_t mNumberOfElements;
+    T mPopped;
+  };
+}
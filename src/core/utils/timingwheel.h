@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace forte::core::util {
+
+  /*!\brief Hierarchical timing wheel for tick based timers
+   *
+   * The wheel consists of scmNumLevels levels of scmSlotsPerLevel slots. Level 0 holds the timers expiring within the
+   * next scmSlotsPerLevel ticks with one slot per tick, each higher level covers scmSlotsPerLevel times the range of
+   * the level below. Whenever the slots of a level wrap around, the next slot of the level above is cascaded into
+   * the lower levels. Timers are intrusive nodes, so adding, removing, and advancing never allocate. Adding and
+   * removing a timer is O(1), a tick costs O(1) plus the number of expired and cascaded timers.
+   *
+   * Timeouts must be less than 2^(scmNumLevels * scmSlotBits) ticks in the future.
+   *
+   * Like CRingBuffer this class is not thread-safe.
+   */
+  class CTimingWheel {
+  public:
+    //! Base class for the timers managed by the wheel
+    struct STimer {
+      uint_fast64_t mTimeOut = 0; //!< absolute tick at which the timer expires
+      STimer *mPrev = nullptr;
+      STimer *mNext = nullptr;
+      STimer **mSlot = nullptr; //!< slot the timer is linked into, nullptr if the timer is not active
+
+      bool isActive() const {
+        return nullptr != mSlot;
+      }
+    };
+
+    static constexpr unsigned int scmSlotBits = 8;
+    static constexpr std::size_t scmSlotsPerLevel = 1U << scmSlotBits;
+    static constexpr unsigned int scmNumLevels = 4;
+
+    explicit CTimingWheel(uint_fast64_t paNow = 0) :
+        mNow(paNow), mNumTimers(0), mSlots{} {
+    }
+
+    CTimingWheel(const CTimingWheel&) = delete;
+    CTimingWheel& operator=(const CTimingWheel&) = delete;
+
+    uint_fast64_t getNow() const {
+      return mNow;
+    }
+
+    std::size_t getNumberOfTimers() const {
+      return mNumTimers;
+    }
+
+    /*!\brief Add a timer expiring at paTimer.mTimeOut
+     *
+     * Timeouts not in the future are expired with the next tick. An already active timer is moved.
+     */
+    void add(STimer &paTimer) {
+      if(paTimer.isActive()) {
+        remove(paTimer);
+      }
+      if(paTimer.mTimeOut <= mNow) {
+        paTimer.mTimeOut = mNow + 1;
+      }
+      link(paTimer);
+      ++mNumTimers;
+    }
+
+    //! Remove an active timer, inactive timers are ignored
+    void remove(STimer &paTimer) {
+      if(!paTimer.isActive()) {
+        return;
+      }
+      if(nullptr != paTimer.mPrev) {
+        paTimer.mPrev->mNext = paTimer.mNext;
+      } else {
+        *paTimer.mSlot = paTimer.mNext;
+      }
+      if(nullptr != paTimer.mNext) {
+        paTimer.mNext->mPrev = paTimer.mPrev;
+      }
+      paTimer.mPrev = nullptr;
+      paTimer.mNext = nullptr;
+      paTimer.mSlot = nullptr;
+      --mNumTimers;
+    }
+
+    /*!\brief Advance the wheel by one tick and hand all timers expiring at the new tick to paOnExpired
+     *
+     * Expired timers are removed before paOnExpired is called, so the callback may add them again.
+     */
+    template<typename TCallback>
+    void tick(TCallback &&paOnExpired) {
+      ++mNow;
+      cascade();
+      STimer **slot = &mSlots[0][mNow & scmSlotMask];
+      STimer *expired = *slot;
+      *slot = nullptr;
+      while(nullptr != expired) {
+        STimer *next = expired->mNext;
+        expired->mPrev = nullptr;
+        expired->mNext = nullptr;
+        expired->mSlot = nullptr;
+        --mNumTimers;
+        paOnExpired(*expired);
+        expired = next;
+      }
+    }
+
+    /*!\brief Number of upcoming ticks, at most paMaxTicks, with neither expiring nor cascaded timers
+     *
+     * These ticks can be passed over with skip(). The lookahead checks the level 0 slots of one revolution and
+     * after that only the ticks at which timers are cascaded, so it costs at most scmSlotsPerLevel plus
+     * paMaxTicks / scmSlotsPerLevel steps.
+     */
+    uint_fast64_t getIdleTicks(uint_fast64_t paMaxTicks) const {
+      if(0 == mNumTimers) {
+        return paMaxTicks;
+      }
+      uint_fast64_t ticks = 0;
+      for(; ticks < paMaxTicks && ticks < scmSlotsPerLevel; ++ticks) {
+        const uint_fast64_t tick = mNow + ticks + 1;
+        if(nullptr != mSlots[0][tick & scmSlotMask] || hasCascadeWork(tick)) {
+          return ticks;
+        }
+      }
+      //beyond one revolution level 0 only receives timers by cascading
+      ticks = (((mNow + scmSlotsPerLevel) & ~static_cast<uint_fast64_t>(scmSlotMask)) + scmSlotsPerLevel) - mNow - 1;
+      for(; ticks < paMaxTicks; ticks += scmSlotsPerLevel) {
+        if(hasCascadeWork(mNow + ticks + 1)) {
+          return ticks;
+        }
+      }
+      return paMaxTicks;
+    }
+
+    //! Advance the wheel by paTicks ticks without handling them, paTicks must not exceed getIdleTicks()
+    void skip(uint_fast64_t paTicks) {
+      mNow += paTicks;
+    }
+
+  private:
+    static constexpr std::size_t scmSlotMask = scmSlotsPerLevel - 1;
+
+    //! check if timers are cascaded when the wheel reaches paTick
+    bool hasCascadeWork(uint_fast64_t paTick) const {
+      for(unsigned int level = 1; level < scmNumLevels; ++level) {
+        if(0 != ((paTick >> (scmSlotBits * (level - 1))) & scmSlotMask)) {
+          break;
+        }
+        if(nullptr != mSlots[level][(paTick >> (scmSlotBits * level)) & scmSlotMask]) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void link(STimer &paTimer) {
+      uint_fast64_t delta = paTimer.mTimeOut - mNow;
+      unsigned int level = 0;
+      while(level < scmNumLevels - 1 && delta >= (static_cast<uint_fast64_t>(1) << (scmSlotBits * (level + 1)))) {
+        ++level;
+      }
+      STimer **slot = &mSlots[level][(paTimer.mTimeOut >> (scmSlotBits * level)) & scmSlotMask];
+      paTimer.mPrev = nullptr;
+      paTimer.mNext = *slot;
+      if(nullptr != *slot) {
+        (*slot)->mPrev = &paTimer;
+      }
+      *slot = &paTimer;
+      paTimer.mSlot = slot;
+    }
+
+    //! move the timers of the current slots of the upper levels down whenever the level below wrapped around
+    void cascade() {
+      for(unsigned int level = 1; level < scmNumLevels; ++level) {
+        if(0 != ((mNow >> (scmSlotBits * (level - 1))) & scmSlotMask)) {
+          break;
+        }
+        STimer **slot = &mSlots[level][(mNow >> (scmSlotBits * level)) & scmSlotMask];
+        STimer *timer = *slot;
+        *slot = nullptr;
+        while(nullptr != timer) {
+          STimer *next = timer->mNext;
+          link(*timer);
+          timer = next;
+        }
+      }
+    }
+
+    uint_fast64_t mNow;
+    std::size_t mNumTimers;
+    STimer *mSlots[scmNumLevels][scmSlotsPerLevel];
+  };
+}
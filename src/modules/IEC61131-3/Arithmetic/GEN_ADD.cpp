@@ -31,18 +31,22 @@
 DEFINE_GENERIC_FIRMWARE_FB(GEN_ADD, g_nStringIdGEN_ADD)
 
 GEN_ADD::GEN_ADD(const CStringDictionary::TStringId paInstanceNameId, forte::core::CFBContainer &paContainer) :
-    CGenFunctionBlock<CFunctionBlock>(paContainer, paInstanceNameId), mDInputs(0){
+    CGenFunctionBlock<CFunctionBlock>(paContainer, paInstanceNameId){
 }
 
 GEN_ADD::~GEN_ADD(){
 }
 
+void GEN_ADD::freeGenInterfaceSpec(){
+  mIfSpecStorage = forte::core::util::CMixedStorage();
+}
+
 void GEN_ADD::executeEvent(TEventID paEIID, CEventChainExecutionThread *const paECET) {
   switch (paEIID){
     case scmEventREQID:
-      if(mDInputs) {
+      if(mInterfaceSpec->mNumDIs) {
         var_OUT() = var_IN(0);
-        for (size_t i = 1; i < mDInputs; ++i) {
+        for (size_t i = 1; i < mInterfaceSpec->mNumDIs; ++i) {
           var_OUT() = std::visit([](auto &&paOUT, auto &&paIN) -> CIEC_ANY_MAGNITUDE_VARIANT {
               using T = std::decay_t<decltype(paOUT)>;
               using U = std::decay_t<decltype(paIN)>;
@@ -75,18 +79,19 @@ void GEN_ADD::writeOutputData(TEventID) {
 
 bool GEN_ADD::createInterfaceSpec(const char *paConfigString, SFBInterfaceSpec &paInterfaceSpec){
   const char *pcPos = strrchr(paConfigString, '_');
+  unsigned int numDIs;
 
   if(nullptr != pcPos){
     pcPos++;
     //we have an underscore and it is the first underscore after AND
-    mDInputs = static_cast<unsigned int>(forte::core::util::strtoul(pcPos, nullptr, 10));
-    DEVLOG_DEBUG("DIs: %d;\n", mDInputs);
+    numDIs = static_cast<unsigned int>(forte::core::util::strtoul(pcPos, nullptr, 10));
+    DEVLOG_DEBUG("DIs: %d;\n", numDIs);
   }
   else{
     return false;
   }
 
-  if(mDInputs < 2){
+  if(numDIs < 2){
     return false;
   }
 
@@ -101,7 +106,7 @@ bool GEN_ADD::createInterfaceSpec(const char *paConfigString, SFBInterfaceSpec &
   forte::core::util::CIfSpecBuilder isb;
   isb.mEI.setStaticEvents(anEventInputNames);
   isb.mEO.setStaticEvents(anEventOutputNames);
-  isb.mDI.addDataRange("IN", static_cast<int>(mDInputs), g_nStringIdANY_MAGNITUDE);
+  isb.mDI.addDataRange("IN", static_cast<int>(numDIs), g_nStringIdANY_MAGNITUDE);
   isb.mDO.setStaticData(anDataOutputNames, anDataOutputTypeIds);
 
   return isb.build(mIfSpecStorage, paInterfaceSpec);
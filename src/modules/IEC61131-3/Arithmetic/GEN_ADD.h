@@ -44,9 +44,6 @@ class GEN_ADD : public CGenFunctionBlock<CFunctionBlock> {
     static const TEventID scmEventCNFID = 0;
     static const CStringDictionary::TStringId scmEventOutputNames[];
 
-    //self-defined members
-    unsigned int mDInputs;
-
     void executeEvent(TEventID paEIID, CEventChainExecutionThread *const paECET) override;
 
     void readInputData(TEventID paEI) override;
@@ -54,6 +51,12 @@ class GEN_ADD : public CGenFunctionBlock<CFunctionBlock> {
 
     bool createInterfaceSpec(const char *paConfigString, SFBInterfaceSpec &paInterfaceSpec) override;
 
+    bool hasSharedInterfaceSpec() const override {
+      return true;
+    }
+
+    void freeGenInterfaceSpec() override;
+
     GEN_ADD(const CStringDictionary::TStringId paInstanceNameId, forte::core::CFBContainer &paContainer);
     ~GEN_ADD() override;
 };
@@ -42,6 +42,13 @@ CGenBitBase::~CGenBitBase(){
   delete[] mDataInputTypeIds;
 }
 
+void CGenBitBase::freeGenInterfaceSpec(){
+  delete[] mDataInputNames;
+  mDataInputNames = nullptr;
+  delete[] mDataInputTypeIds;
+  mDataInputTypeIds = nullptr;
+}
+
 void CGenBitBase::readInputData(TEventID) {
   for(TPortId i = 0; i < mInterfaceSpec->mNumDIs; ++i) {
     readData(i, *mDIs[i], mDIConns[i]);
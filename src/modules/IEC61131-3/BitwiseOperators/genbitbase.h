@@ -52,6 +52,12 @@ class CGenBitBase : public CGenFunctionBlock<CFunctionBlock> {
     void writeOutputData(TEventID paEO) override;
 
     bool createInterfaceSpec(const char *paConfigString, SFBInterfaceSpec &paInterfaceSpec) override;
+
+    bool hasSharedInterfaceSpec() const override {
+      return true;
+    }
+
+    void freeGenInterfaceSpec() override;
 };
 
 #endif /* _GENBITBASE_H_ */
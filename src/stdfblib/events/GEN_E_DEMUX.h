@@ -38,6 +38,12 @@ class GEN_E_DEMUX : public CGenFunctionBlock<CFunctionBlock>{
 
     bool createInterfaceSpec(const char *paConfigString, SFBInterfaceSpec &paInterfaceSpec) override;
 
+    bool hasSharedInterfaceSpec() const override {
+      return true;
+    }
+
+    void freeGenInterfaceSpec() override;
+
     CIEC_UINT& K(){
       return *static_cast<CIEC_UINT*>(getDI(0));
     }
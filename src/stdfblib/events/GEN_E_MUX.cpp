@@ -39,6 +39,11 @@ GEN_E_MUX::~GEN_E_MUX(){
   delete[] mEventInputNames;
 }
 
+void GEN_E_MUX::freeGenInterfaceSpec(){
+  delete[] mEventInputNames;
+  mEventInputNames = nullptr;
+}
+
 void GEN_E_MUX::executeEvent(TEventID paEIID, CEventChainExecutionThread *const paECET) {
   if(paEIID < mInterfaceSpec->mNumEIs){
     K() = CIEC_UINT(static_cast<TForteUInt16>(paEIID));
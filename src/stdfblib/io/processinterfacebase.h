@@ -23,6 +23,7 @@ class CProcessInterfaceBase : public CEventSourceFB{
         const CStringDictionary::TStringId paInstanceNameId) :
           CEventSourceFB(paContainer, paInterfaceSpec, paInstanceNameId){
       setEventChainExecutor(getResource()->getResourceEventExecution());
+      setEventChainPriority(getResource()->getProcessInterfacePriority());
     }
 
     ~CProcessInterfaceBase() override = default;
@@ -447,6 +447,11 @@ void DEV_MGR::parseQueryData(char *paRequestPartLeft, forte::core::SManagementCM
           }
         }
 
+        break;
+      case 'S': // query resource statistics
+        if(!strncmp(paRequestPartLeft, "Statistics", sizeof("Statistics") - 1)){
+          paCommand.mCMD = EMGMCommandType::QueryStatistics;
+        }
         break;
       default:
         break;
@@ -550,6 +555,11 @@ void DEV_MGR::generateLongResponse(EMGMResponse paResp, forte::core::SManagement
       RESP().append(paCMD.mAdditionalParams);
       RESP().append("\n  </NameList>");
     }
+    else if(paCMD.mCMD == EMGMCommandType::QueryStatistics){
+      RESP().append("<Statistics>\n    ");
+      RESP().append(paCMD.mAdditionalParams);
+      RESP().append("\n  </Statistics>");
+    }
     else if(paCMD.mCMD == EMGMCommandType::QueryDTTypes){
       RESP().append("<DTList>\n    ");
       RESP().append(paCMD.mAdditionalParams);
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "epollhand.h"
+#include "device.h"
+#include "forte_architecture_time.h"
+#include "../../src/core/cominfra/comCallback.h"
+#include "../core/fbtests/fbtesterglobalfixture.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+using namespace forte::com_infra;
+
+namespace {
+  //! UDP subscriber as registered by a CIPComLayer, counting the received messages
+  class CUDPSubscriberMock : public CComCallback {
+    public:
+      CUDPSubscriberMock() :
+          mSocket(socket(PF_INET, SOCK_DGRAM, IPPROTO_UDP)), mNumReceived(0) {
+        struct sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t addrLen = sizeof(addr);
+        BOOST_REQUIRE(-1 != mSocket);
+        BOOST_REQUIRE(0 == bind(mSocket, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)));
+        BOOST_REQUIRE(0 == getsockname(mSocket, reinterpret_cast<struct sockaddr*>(&mAddr), &addrLen));
+      }
+
+      ~CUDPSubscriberMock() override {
+        close(mSocket);
+      }
+
+      EComResponse recvData(const void *paData, unsigned int) override {
+        char buffer[64];
+        recv(*static_cast<const int*>(paData), buffer, sizeof(buffer), 0);
+        mNumReceived.fetch_add(1);
+        return e_Nothing;
+      }
+
+      int getSocket() const {
+        return mSocket;
+      }
+
+      const struct sockaddr_in &getAddress() const {
+        return mAddr;
+      }
+
+      unsigned int getNumReceived() const {
+        return mNumReceived.load();
+      }
+
+      bool waitForMessages(unsigned int paNumMessages) const {
+        uint_fast64_t deadline = getNanoSecondsMonotonic() + 2000000000ULL;
+        while(getNumReceived() < paNumMessages && getNanoSecondsMonotonic() < deadline) {
+          CThread::sleepThread(0);
+        }
+        return getNumReceived() >= paNumMessages;
+      }
+
+    private:
+      int mSocket;
+      struct sockaddr_in mAddr;
+      std::atomic<unsigned int> mNumReceived;
+  };
+
+  CEPollHandler &getEPollHandler() {
+    return CFBTestDataGlobalFixture::getResource().getDevice()->getDeviceExecution().getExtEvHandler<CEPollHandler>();
+  }
+
+  void sendMessage(int paSocket, const CUDPSubscriberMock &paSubscriber) {
+    const char message[] = "msg";
+    sendto(paSocket, message, sizeof(message), 0, reinterpret_cast<const struct sockaddr*>(&paSubscriber.getAddress()), sizeof(struct sockaddr_in));
+  }
+
+  //! socket used for sending to the subscribers
+  class CSenderSocket {
+    public:
+      CSenderSocket() :
+          mSocket(socket(PF_INET, SOCK_DGRAM, IPPROTO_UDP)) {
+      }
+
+      ~CSenderSocket() {
+        close(mSocket);
+      }
+
+      operator int() const {
+        return mSocket;
+      }
+
+    private:
+      int mSocket;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(EPollHandler)
+
+  BOOST_AUTO_TEST_CASE(EPollHandler_DispatchToReadyDescriptor) {
+    CSenderSocket sender;
+    CUDPSubscriberMock first;
+    CUDPSubscriberMock second;
+    getEPollHandler().addComCallback(first.getSocket(), &first);
+    getEPollHandler().addComCallback(second.getSocket(), &second);
+
+    sendMessage(sender, second);
+    sendMessage(sender, second);
+    BOOST_CHECK(second.waitForMessages(2));
+    BOOST_CHECK_EQUAL(0, first.getNumReceived());
+
+    getEPollHandler().removeComCallback(second.getSocket());
+    sendMessage(sender, second);
+    sendMessage(sender, first);
+    BOOST_CHECK(first.waitForMessages(1));
+    CThread::sleepThread(20);
+    BOOST_CHECK_EQUAL(2, second.getNumReceived());
+
+    getEPollHandler().removeComCallback(first.getSocket());
+  }
+
+  BOOST_AUTO_TEST_CASE(EPollHandler_DispatchAmongManyDescriptors) {
+    const unsigned int numMessages = 2000;
+    const size_t numSubscribers = 1024;
+    CSenderSocket sender;
+    std::vector<std::unique_ptr<CUDPSubscriberMock>> subscribers;
+    for(size_t i = 0; i < numSubscribers; ++i) {
+      subscribers.emplace_back(new CUDPSubscriberMock());
+      getEPollHandler().addComCallback(subscribers.back()->getSocket(), subscribers.back().get());
+    }
+
+    std::vector<unsigned int> expected(numSubscribers, 0);
+    for(unsigned int i = 0; i < numMessages; ++i) {
+      size_t index = (i * 7919U) % numSubscribers;
+      sendMessage(sender, *subscribers[index]);
+      BOOST_REQUIRE(subscribers[index]->waitForMessages(++expected[index]));
+    }
+
+    for(size_t i = 0; i < numSubscribers; ++i) {
+      getEPollHandler().removeComCallback(subscribers[i]->getSocket());
+      BOOST_CHECK_EQUAL(expected[i], subscribers[i]->getNumReceived());
+    }
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,258 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "shmcomlayer.h"
+#include "../../src/core/cominfra/basecommfb.h"
+#include "../../src/core/datatypes/forte_dint.h"
+#include "../../src/core/datatypes/forte_lreal.h"
+#include "../../src/core/datatypes/forte_string.h"
+#include "../../src/core/utils/criticalregion.h"
+#include "../core/fbtests/fbtesterglobalfixture.h"
+#include "typelib.h"
+#include "resource.h"
+#include "ecet.h"
+#include "forte_architecture_time.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace forte::com_infra;
+
+namespace {
+  /*!\brief Communication FB with a shared memory layer, both FB and layer are never started
+   *
+   * The FB ignores the external events of the layer, so the tests look at the RDs directly.
+   */
+  class CShmComFBFixture {
+    public:
+      CShmComFBFixture(const char *paFBType, const char *paGroup) :
+          mFB(CTypeLib::createFB(CStringDictionary::getInstance().insert("ShmComLayerTest"),
+              CStringDictionary::getInstance().insert(paFBType), CFBTestDataGlobalFixture::getResource())),
+          mGroup(paGroup) {
+        BOOST_REQUIRE(nullptr != mFB);
+        mLayer.reset(new CShmComLayer(nullptr, static_cast<CBaseCommFB*>(mFB)));
+      }
+
+      ~CShmComFBFixture() {
+        mLayer.reset();
+        //let the resource's ECET discard the external events sent to the FB before deleting it
+        CEventChainExecutionThread *ecet = CFBTestDataGlobalFixture::getResource().getResourceEventExecution();
+        do {
+          CThread::sleepThread(10);
+        } while(ecet->isProcessingEvents());
+        CTypeLib::deleteFB(mFB);
+      }
+
+      CBaseCommFB &getCommFB() {
+        return *static_cast<CBaseCommFB*>(mFB);
+      }
+
+      CIEC_ANY &getDataPin(TPortId paIndex) {
+        return (e_Publisher == getCommFB().getComServiceType()) ? *getCommFB().getSDs()[paIndex] : *getCommFB().getRDs()[paIndex];
+      }
+
+      EComResponse open() {
+        std::string params(mGroup);
+        return static_cast<CComLayer&>(*mLayer).openConnection(&params[0]);
+      }
+
+      EComResponse send() {
+        return mLayer->sendData(nullptr, 0);
+      }
+
+      //! wait until RD_1 of the subscriber holds the given DINT value
+      bool waitForValue(TForteInt32 paValue) {
+        uint_fast64_t deadline = getNanoSecondsMonotonic() + 2000000000ULL;
+        do {
+          {
+            CCriticalRegion criticalRegion(getCommFB().getFBLock());
+            if(static_cast<CIEC_DINT::TValueType>(static_cast<const CIEC_DINT &>(getDataPin(0).unwrap())) == paValue) {
+              return true;
+            }
+          }
+          CThread::sleepThread(0);
+        } while(getNanoSecondsMonotonic() < deadline);
+        return false;
+      }
+
+    private:
+      CFunctionBlock *mFB;
+      std::string mGroup;
+      std::unique_ptr<CShmComLayer> mLayer;
+  };
+
+  //! maps the header of an existing group to manipulate its seqlock
+  class CShmGroupHeaderAccess {
+    public:
+      explicit CShmGroupHeaderAccess(const char *paGroup) :
+          mHeader(nullptr) {
+        int fd = shm_open((std::string("/forte_shm_") + paGroup).c_str(), O_RDWR, 0);
+        BOOST_REQUIRE(-1 != fd);
+        void *segment = mmap(nullptr, sizeof(CShmComLayer::SShmGroupHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        BOOST_REQUIRE(MAP_FAILED != segment);
+        mHeader = static_cast<CShmComLayer::SShmGroupHeader *>(segment);
+      }
+
+      ~CShmGroupHeaderAccess() {
+        munmap(mHeader, sizeof(CShmComLayer::SShmGroupHeader));
+      }
+
+      CShmComLayer::SShmGroupHeader *operator->() {
+        return mHeader;
+      }
+
+    private:
+      CShmComLayer::SShmGroupHeader *mHeader;
+  };
+
+  //! number of threads of this process
+  size_t countThreads() {
+    size_t numThreads = 0;
+    DIR *tasks = opendir("/proc/self/task");
+    BOOST_REQUIRE(nullptr != tasks);
+    while(struct dirent *entry = readdir(tasks)) {
+      if('.' != entry->d_name[0]) {
+        ++numThreads;
+      }
+    }
+    closedir(tasks);
+    return numThreads;
+  }
+
+  //! remove a group left over by an aborted test run
+  void removeStaleGroup(const char *paGroup) {
+    shm_unlink((std::string("/forte_shm_") + paGroup).c_str());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(ShmComLayer)
+
+  BOOST_AUTO_TEST_CASE(PublishedValuesReachAllSubscribers) {
+    removeStaleGroup("forte_test_values");
+    CShmComFBFixture publisher("PUBLISH_2", "forte_test_values");
+    CShmComFBFixture firstSubscriber("SUBSCRIBE_2", "forte_test_values");
+    CShmComFBFixture secondSubscriber("SUBSCRIBE_2", "forte_test_values");
+    for(CShmComFBFixture *fixture : {&publisher, &firstSubscriber, &secondSubscriber}) {
+      fixture->getDataPin(0).setValue(CIEC_DINT(0));
+      fixture->getDataPin(1).setValue(""_STRING);
+      BOOST_REQUIRE_EQUAL(e_InitOk, fixture->open());
+    }
+
+    publisher.getDataPin(0).setValue(CIEC_DINT(42));
+    publisher.getDataPin(1).setValue("shared memory"_STRING);
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, publisher.send());
+
+    for(CShmComFBFixture *subscriber : {&firstSubscriber, &secondSubscriber}) {
+      BOOST_REQUIRE(subscriber->waitForValue(42));
+      CCriticalRegion criticalRegion(subscriber->getCommFB().getFBLock());
+      BOOST_CHECK_EQUAL(std::string("shared memory"), static_cast<const CIEC_STRING &>(subscriber->getDataPin(1).unwrap()).getStorage());
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(MismatchingDataTypesAreRejected) {
+    removeStaleGroup("forte_test_types");
+    CShmComFBFixture publisher("PUBLISH_1", "forte_test_types");
+    CShmComFBFixture subscriber("SUBSCRIBE_1", "forte_test_types");
+    publisher.getDataPin(0).setValue(CIEC_DINT(0));
+    subscriber.getDataPin(0).setValue(CIEC_LREAL(0.0));
+    BOOST_REQUIRE_EQUAL(e_InitOk, publisher.open());
+    BOOST_CHECK_EQUAL(e_InitInvalidId, subscriber.open());
+  }
+
+  BOOST_AUTO_TEST_CASE(TooLongStringsAreNotPublished) {
+    removeStaleGroup("forte_test_string");
+    CShmComFBFixture publisher("PUBLISH_1", "forte_test_string");
+    publisher.getDataPin(0).setValue(""_STRING);
+    BOOST_REQUIRE_EQUAL(e_InitOk, publisher.open());
+    publisher.getDataPin(0).setValue(CIEC_STRING(std::string(CShmComLayer::scmMaxStringLength + 1, 'x')));
+    BOOST_CHECK_EQUAL(e_ProcessDataDataTypeError, publisher.send());
+  }
+
+  BOOST_AUTO_TEST_CASE(PublisherTakesOverGroupOfDeadWriter) {
+    removeStaleGroup("forte_test_takeover");
+    CShmComFBFixture publisher("PUBLISH_1", "forte_test_takeover");
+    CShmComFBFixture subscriber("SUBSCRIBE_1", "forte_test_takeover");
+    publisher.getDataPin(0).setValue(CIEC_DINT(0));
+    subscriber.getDataPin(0).setValue(CIEC_DINT(0));
+    BOOST_REQUIRE_EQUAL(e_InitOk, publisher.open());
+    BOOST_REQUIRE_EQUAL(e_InitOk, subscriber.open());
+    CShmGroupHeaderAccess group("forte_test_takeover");
+
+    //another process starts a publication and stops in the middle of it
+    int lockedPipe[2];
+    BOOST_REQUIRE_EQUAL(0, pipe(lockedPipe));
+    pid_t writerPID = fork();
+    if(0 == writerPID) {
+      pthread_mutex_lock(&group->mWriteLock);
+      group->mSequence.fetch_add(1);
+      char locked = 1;
+      if(1 == write(lockedPipe[1], &locked, 1)) {
+        pause();
+      }
+      _exit(0);
+    }
+    BOOST_REQUIRE(0 < writerPID);
+    char locked = 0;
+    BOOST_REQUIRE_EQUAL(1, read(lockedPipe[0], &locked, 1));
+    close(lockedPipe[0]);
+    close(lockedPipe[1]);
+
+    //a live writer holding the group lets the publisher time out
+    publisher.getDataPin(0).setValue(CIEC_DINT(1));
+    BOOST_CHECK_EQUAL(e_ProcessDataSendFailed, publisher.send());
+
+    //the group of a writer which died while publishing is taken over
+    kill(writerPID, SIGKILL);
+    waitpid(writerPID, nullptr, 0);
+    publisher.getDataPin(0).setValue(CIEC_DINT(2));
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, publisher.send());
+    BOOST_CHECK(subscriber.waitForValue(2));
+    BOOST_CHECK_EQUAL(0, group->mSequence.load() & 1);
+
+    publisher.getDataPin(0).setValue(CIEC_DINT(3));
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, publisher.send());
+    BOOST_CHECK(subscriber.waitForValue(3));
+  }
+
+  BOOST_AUTO_TEST_CASE(SubscribersOfAGroupShareOneThread) {
+    removeStaleGroup("forte_test_threads");
+    CShmComFBFixture publisher("PUBLISH_1", "forte_test_threads");
+    publisher.getDataPin(0).setValue(CIEC_DINT(0));
+    BOOST_REQUIRE_EQUAL(e_InitOk, publisher.open());
+
+    std::vector<std::unique_ptr<CShmComFBFixture>> subscribers;
+    size_t numThreads = 0;
+    for(int i = 0; i < 10; ++i) {
+      subscribers.emplace_back(new CShmComFBFixture("SUBSCRIBE_1", "forte_test_threads"));
+      subscribers.back()->getDataPin(0).setValue(CIEC_DINT(0));
+      BOOST_REQUIRE_EQUAL(e_InitOk, subscribers.back()->open());
+      if(0 == i) {
+        numThreads = countThreads();
+      }
+    }
+    BOOST_CHECK_EQUAL(numThreads, countThreads());
+
+    publisher.getDataPin(0).setValue(CIEC_DINT(7));
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, publisher.send());
+    for(auto &subscriber : subscribers) {
+      BOOST_CHECK(subscriber->waitForValue(7));
+    }
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
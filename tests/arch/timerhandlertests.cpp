@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "esfb.h"
+#include "ecet.h"
+#include "device.h"
+#include "timerha.h"
+#include "forte_architecture_time.h"
+#include "../core/fbcontainermock.h"
+#include "../core/fbtests/fbtesterglobalfixture.h"
+
+#include <atomic>
+#include <vector>
+
+namespace {
+  const SFBInterfaceSpec gTimedFBInterfaceSpec = {
+    0, nullptr, nullptr, nullptr,
+    0, nullptr, nullptr, nullptr,
+    0, nullptr, nullptr,
+    0, nullptr, nullptr,
+    0, nullptr,
+    0, nullptr
+  };
+
+  //! Event source FB recording the monotonic time of its activations
+  class CTimedFBMock : public CEventSourceFB {
+    public:
+      CTimedFBMock(size_t paMaxActivations, CEventChainExecutionThread &paECET) :
+          CEventSourceFB(CFBContainerMock::smDefaultFBContMock, &gTimedFBInterfaceSpec, 0),
+          mActivationTimes(paMaxActivations), mNumActivations(0) {
+        setEventChainExecutor(&paECET);
+      }
+
+      bool initialize() override {
+        if(!CEventSourceFB::initialize()) {
+          return false;
+        }
+        changeFBExecutionState(EMGMCommandType::Reset);
+        changeFBExecutionState(EMGMCommandType::Start);
+        return true;
+      }
+
+      CStringDictionary::TStringId getFBTypeId() const override {
+        return CStringDictionary::scmInvalidStringId;
+      }
+
+      //! wait up to paTimeOut ns until the FB has been activated paNumActivations times
+      bool waitForActivations(size_t paNumActivations, uint_fast64_t paTimeOut) const {
+        uint_fast64_t deadline = getNanoSecondsMonotonic() + paTimeOut;
+        while(mNumActivations.load() < paNumActivations && getNanoSecondsMonotonic() < deadline) {
+          CThread::sleepThread(1);
+        }
+        return mNumActivations.load() >= paNumActivations;
+      }
+
+      uint_fast64_t getActivationTime(size_t paIndex) const {
+        return mActivationTimes[paIndex];
+      }
+
+    private:
+      void executeEvent(TEventID, CEventChainExecutionThread * const) override {
+        size_t numActivations = mNumActivations.load();
+        if(numActivations < mActivationTimes.size()) {
+          mActivationTimes[numActivations] = getNanoSecondsMonotonic();
+          mNumActivations.store(numActivations + 1);
+        }
+      }
+
+      void readInputData(TEventID) override {
+      }
+
+      void writeOutputData(TEventID) override {
+      }
+
+      std::vector<uint_fast64_t> mActivationTimes;
+      std::atomic<size_t> mNumActivations;
+  };
+
+  CTimerHandler &getTimerHandler() {
+    return CFBTestDataGlobalFixture::getResource().getDevice()->getTimer();
+  }
+
+  CIEC_TIME milliSeconds(unsigned int paMilliSeconds) {
+    return CIEC_TIME(static_cast<CIEC_TIME::TValueType>(paMilliSeconds * CIEC_ANY_DURATION::csmForteTimeBaseUnitsPerMilliSecond));
+  }
+
+  //! Event chain execution thread running for the lifetime of a test case
+  class CRunningECET : public CEventChainExecutionThread {
+    public:
+      CRunningECET() {
+        changeExecutionState(EMGMCommandType::Start);
+      }
+
+      ~CRunningECET() override {
+        changeExecutionState(EMGMCommandType::Stop);
+        joinEventChainExecutionThread();
+      }
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(TimerHandler)
+
+  BOOST_AUTO_TEST_CASE(TimerHandler_NearerTimerEndsSleep) {
+    CRunningECET ecet;
+    CTimedFBMock slowFB(1, ecet);
+    CTimedFBMock fastFB(1, ecet);
+    BOOST_REQUIRE(slowFB.initialize());
+    BOOST_REQUIRE(fastFB.initialize());
+
+    //let the timer handler go to sleep for the slow timer before registering the fast one
+    getTimerHandler().registerOneShotTimedFB(&slowFB, milliSeconds(10000));
+    CThread::sleepThread(20);
+    uint_fast64_t start = getNanoSecondsMonotonic();
+    getTimerHandler().registerOneShotTimedFB(&fastFB, milliSeconds(5));
+    BOOST_REQUIRE(fastFB.waitForActivations(1, 2000000000ULL));
+    uint_fast64_t delay = fastFB.getActivationTime(0) - start;
+    BOOST_TEST(delay >= 4000000U);
+    BOOST_TEST(delay < 500000000U);
+
+    getTimerHandler().unregisterTimedFB(&slowFB);
+    getTimerHandler().unregisterTimedFB(&fastFB);
+    CThread::sleepThread(10);
+  }
+
+  BOOST_AUTO_TEST_CASE(TimerHandler_PeriodicTimerDoesNotDrift) {
+    const unsigned int periodMs = 2;
+    const size_t numActivations = 500;
+    const uint_fast64_t period = periodMs * 1000000ULL;
+    CRunningECET ecet;
+    CTimedFBMock timedFB(numActivations, ecet);
+    BOOST_REQUIRE(timedFB.initialize());
+
+    getTimerHandler().registerPeriodicTimedFB(&timedFB, milliSeconds(periodMs));
+    bool completed = timedFB.waitForActivations(numActivations, 10000000000ULL);
+    getTimerHandler().unregisterTimedFB(&timedFB);
+    CThread::sleepThread(10);
+    BOOST_REQUIRE(completed);
+
+    uint_fast64_t meanPeriod = (timedFB.getActivationTime(numActivations - 1) - timedFB.getActivationTime(0)) / (numActivations - 1);
+    BOOST_TEST(meanPeriod > period * 9 / 10);
+    BOOST_TEST(meanPeriod < period * 11 / 10);
+  }
+
+  BOOST_AUTO_TEST_CASE(TimerHandler_ForteTimeAdvancesWhileIdle) {
+    //without registered timers a tickless timer handler sleeps, the FORTE time has to advance nevertheless
+    const uint_fast64_t start = getTimerHandler().getForteTime();
+    CThread::sleepThread(100);
+    const uint_fast64_t elapsed = getTimerHandler().getForteTime() - start;
+    BOOST_TEST(elapsed >= CTimerHandler::getTicksPerSecond() / 20);
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include <sockhand.h>
+
+#include <string.h>
+
+namespace {
+  const unsigned short scmTestPort = 51477;
+  const unsigned int scmDatagramSize = 64;
+
+  //! loopback publisher and subscriber socket pair
+  class CUDPLoopback {
+    public:
+      CUDPLoopback() {
+        char address[] = "127.0.0.1";
+        mReceiver = CIPComSocketHandler::openUDPReceivePort(address, scmTestPort, "127.0.0.1");
+        mSender = CIPComSocketHandler::openUDPSendPort(address, scmTestPort, &mDestAddr, "127.0.0.1");
+        BOOST_REQUIRE(CIPComSocketHandler::scmInvalidSocketDescriptor != mReceiver);
+        BOOST_REQUIRE(CIPComSocketHandler::scmInvalidSocketDescriptor != mSender);
+      }
+
+      ~CUDPLoopback() {
+        CIPComSocketHandler::closeSocket(mSender);
+        CIPComSocketHandler::closeSocket(mReceiver);
+      }
+
+      CIPComSocketHandler::TSocketDescriptor mReceiver;
+      CIPComSocketHandler::TSocketDescriptor mSender;
+      CIPComSocketHandler::TUDPDestAddr mDestAddr;
+  };
+
+  void fillDatagram(char *paDatagram, unsigned int paSize, char paValue) {
+    memset(paDatagram, paValue, paSize);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(UDPBatching)
+
+  BOOST_AUTO_TEST_CASE(UDPBatchKeepsDatagramBoundaries) {
+    CUDPLoopback loopback;
+    const unsigned int sizes[] = {1, 17, scmDatagramSize, 5, 32};
+    const unsigned int numDatagrams = sizeof(sizes) / sizeof(sizes[0]);
+    char buffers[numDatagrams][scmDatagramSize];
+    char *datagrams[numDatagrams];
+    for(unsigned int i = 0; i < numDatagrams; ++i) {
+      fillDatagram(buffers[i], sizes[i], static_cast<char>('a' + i));
+      datagrams[i] = buffers[i];
+    }
+    BOOST_REQUIRE_EQUAL(static_cast<int>(numDatagrams),
+        CIPComSocketHandler::sendDatagramsOnUDP(loopback.mSender, &loopback.mDestAddr, datagrams, sizes, numDatagrams));
+
+    char received[numDatagrams][scmDatagramSize];
+    unsigned int receivedSizes[numDatagrams];
+    unsigned int numReceived = 0;
+    while(numReceived < numDatagrams) {
+      int nRetVal = CIPComSocketHandler::receiveDatagramsFromUDP(loopback.mReceiver, received[numReceived], scmDatagramSize,
+          &receivedSizes[numReceived], numDatagrams - numReceived);
+      BOOST_REQUIRE(0 < nRetVal);
+      numReceived += static_cast<unsigned int>(nRetVal);
+    }
+
+    for(unsigned int i = 0; i < numDatagrams; ++i) {
+      BOOST_CHECK_EQUAL(sizes[i], receivedSizes[i]);
+      BOOST_CHECK_EQUAL(0, memcmp(buffers[i], received[i], sizes[i]));
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(UDPBatchInteroperatesWithSingleCalls) {
+    CUDPLoopback loopback;
+    const unsigned int batchSize = 16;
+    char buffer[batchSize][scmDatagramSize];
+    char *datagrams[batchSize];
+    unsigned int sizes[batchSize];
+    for(unsigned int i = 0; i < batchSize; ++i) {
+      fillDatagram(buffer[i], scmDatagramSize, static_cast<char>('A' + i));
+      datagrams[i] = buffer[i];
+      sizes[i] = scmDatagramSize;
+    }
+
+    //single sends are received in one batch
+    for(unsigned int i = 0; i < batchSize; ++i) {
+      BOOST_REQUIRE(0 < CIPComSocketHandler::sendDataOnUDP(loopback.mSender, &loopback.mDestAddr, datagrams[i], sizes[i]));
+    }
+    char received[batchSize][scmDatagramSize];
+    unsigned int receivedSizes[batchSize];
+    unsigned int numReceived = 0;
+    while(numReceived < batchSize) {
+      int nRetVal = CIPComSocketHandler::receiveDatagramsFromUDP(loopback.mReceiver, received[numReceived], scmDatagramSize,
+          &receivedSizes[numReceived], batchSize - numReceived);
+      BOOST_REQUIRE(0 < nRetVal);
+      numReceived += static_cast<unsigned int>(nRetVal);
+    }
+    for(unsigned int i = 0; i < batchSize; ++i) {
+      BOOST_CHECK_EQUAL(scmDatagramSize, receivedSizes[i]);
+      BOOST_CHECK_EQUAL(0, memcmp(buffer[i], received[i], scmDatagramSize));
+    }
+
+    //a batch send is received with single calls
+    BOOST_REQUIRE_EQUAL(static_cast<int>(batchSize),
+        CIPComSocketHandler::sendDatagramsOnUDP(loopback.mSender, &loopback.mDestAddr, datagrams, sizes, batchSize));
+    for(unsigned int i = 0; i < batchSize; ++i) {
+      BOOST_REQUIRE_EQUAL(static_cast<int>(scmDatagramSize),
+          CIPComSocketHandler::receiveDataFromUDP(loopback.mReceiver, received[i], scmDatagramSize));
+      BOOST_CHECK_EQUAL(0, memcmp(buffer[i], received[i], scmDatagramSize));
+    }
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
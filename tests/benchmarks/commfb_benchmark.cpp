@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/core/cominfra/basecommfb.h"
+#include "../../src/core/cominfra/comlayer.h"
+#include "fbtests/fbtesterglobalfixture.h"
+#include "typelib.h"
+#include "resource.h"
+#include "ecet.h"
+#include "forte_architecture_time.h"
+
+using namespace forte::com_infra;
+
+namespace {
+  //! layer doing no work, so that only the cost of the FB itself is measured
+  class CCountingLayerMock : public CComLayer {
+    public:
+      explicit CCountingLayerMock(CBaseCommFB *paFB) :
+          CComLayer(nullptr, paFB), mNumInterrupts(0) {
+      }
+
+      EComResponse sendData(void *, unsigned int) override {
+        return e_ProcessDataOk;
+      }
+
+      EComResponse recvData(const void *, unsigned int) override {
+        return e_ProcessDataOk;
+      }
+
+      EComResponse processInterrupt() override {
+        ++mNumInterrupts;
+        return e_ProcessDataOk;
+      }
+
+      EComResponse openConnection(char *) override {
+        return e_InitOk;
+      }
+
+      void closeConnection() override {
+      }
+
+      unsigned int mNumInterrupts;
+  };
+
+  //! event inputs of the communication FBs
+  const TEventID scmINIT = 0;
+  const TEventID scmREQ = 1;
+
+  const unsigned int scmNumMessages = 100000;
+
+  //! started communication FB whose events are only processed when the benchmark delivers them
+  class CCommFBFixture {
+    public:
+      explicit CCommFBFixture(const char *paFBType = "SUBSCRIBE_1") :
+          mFB(CTypeLib::createFB(CStringDictionary::getInstance().insert("CommFBBenchmark"),
+              CStringDictionary::getInstance().insert(paFBType), CFBTestDataGlobalFixture::getResource())),
+          mLayer(static_cast<CBaseCommFB*>(mFB)) {
+        BOOST_REQUIRE(nullptr != mFB);
+        BOOST_REQUIRE(EMGMResponse::Ready == mFB->changeFBExecutionState(EMGMCommandType::Start));
+      }
+
+      ~CCommFBFixture() {
+        mFB->changeFBExecutionState(EMGMCommandType::Stop);
+        CTypeLib::deleteFB(mFB);
+      }
+
+      CBaseCommFB &getCommFB() {
+        return *static_cast<CBaseCommFB*>(mFB);
+      }
+
+      void deliverEvent(TEventID paEIID) {
+        getCommFB().receiveInputEvent(paEIID, CFBTestDataGlobalFixture::getResource().getResourceEventExecution());
+      }
+
+      bool statusIs(const char *paText) {
+        return 0 == strcmp(paText, getCommFB().STATUS().getValue());
+      }
+
+      CFunctionBlock *mFB;
+      CCountingLayerMock mLayer;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(CommFBBenchmark)
+
+  BOOST_AUTO_TEST_CASE(Benchmark_Receive) {
+    CCommFBFixture fixture;
+    uint_fast64_t start = getNanoSecondsMonotonic();
+    for(unsigned int i = 0; i < scmNumMessages; ++i) {
+      fixture.getCommFB().interruptCommFB(&fixture.mLayer);
+      fixture.deliverEvent(cgExternalEventID);
+    }
+    uint_fast64_t duration = getNanoSecondsMonotonic() - start;
+    BOOST_CHECK_EQUAL(scmNumMessages, fixture.mLayer.mNumInterrupts);
+    BOOST_CHECK(fixture.statusIs("OK"));
+    BOOST_TEST_MESSAGE("SUBSCRIBE_1 receive: " << duration / scmNumMessages << " ns per message");
+  }
+
+  BOOST_AUTO_TEST_CASE(Benchmark_Send) {
+    CCommFBFixture fixture("PUBLISH_1");
+    fixture.getCommFB().QI() = CIEC_BOOL(true);
+    fixture.getCommFB().ID().fromString("loc[CommFBBenchmark]");
+    fixture.deliverEvent(scmINIT);
+    BOOST_REQUIRE(fixture.getCommFB().QO());
+
+    uint_fast64_t start = getNanoSecondsMonotonic();
+    for(unsigned int i = 0; i < scmNumMessages; ++i) {
+      fixture.deliverEvent(scmREQ);
+    }
+    uint_fast64_t duration = getNanoSecondsMonotonic() - start;
+    BOOST_CHECK(fixture.statusIs("OK"));
+    BOOST_TEST_MESSAGE("PUBLISH_1 send to a local group without subscribers: " << duration / scmNumMessages << " ns per message");
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
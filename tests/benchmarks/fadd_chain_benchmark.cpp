@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "funcbloc.h"
+#include "typelib.h"
+#include "ecet.h"
+#include "resource.h"
+#include "forte_dint.h"
+#include "fbtests/fbtesterglobalfixture.h"
+#include "forte_architecture_time.h"
+
+#include <vector>
+
+namespace {
+  //! Event chain execution thread processing its event list in the calling thread
+  class CSynchronousECET : public CEventChainExecutionThread {
+    public:
+      size_t processEvents() {
+        size_t numEvents = 0;
+        while(TEventEntry *event = popEventEntry()) {
+          //copy the entry as delivering the event adds the next one to the event list
+          CFunctionBlock *fb = event->mFB;
+          TPortId portId = event->mPortId;
+          fb->receiveInputEvent(portId, this);
+          ++numEvents;
+        }
+        return numEvents;
+      }
+  };
+
+  //! Chain of F_ADD FBs, each one adding its constant IN2 to the OUT of its predecessor
+  class CF_ADDChain {
+    public:
+      explicit CF_ADDChain(size_t paLength) {
+        CStringDictionary &dictionary = CStringDictionary::getInstance();
+        const CStringDictionary::TStringId typeId = dictionary.insert("F_ADD");
+        const CStringDictionary::TStringId in1Id = dictionary.insert("IN1");
+        const CStringDictionary::TStringId in2Id = dictionary.insert("IN2");
+        const CStringDictionary::TStringId outId = dictionary.insert("OUT");
+        const CStringDictionary::TStringId reqId = dictionary.insert("REQ");
+        const CStringDictionary::TStringId cnfId = dictionary.insert("CNF");
+        mIN1Id = in1Id;
+        mOUTId = outId;
+        for(size_t i = 0; i < paLength; ++i) {
+          CFunctionBlock *fb = CTypeLib::createFB(typeId, typeId, CFBTestDataGlobalFixture::getResource());
+          BOOST_REQUIRE(nullptr != fb);
+          fb->getDataInput(in2Id)->setValue(CIEC_DINT(1));
+          if(!mFBs.empty()) {
+            BOOST_REQUIRE(EMGMResponse::Ready == mFBs.back()->getEOConnection(cnfId)->connect(fb, reqId));
+            BOOST_REQUIRE(EMGMResponse::Ready == mFBs.back()->getDOConnection(outId)->connect(fb, in1Id));
+          }
+          BOOST_REQUIRE(EMGMResponse::Ready == fb->changeFBExecutionState(EMGMCommandType::Start));
+          mFBs.push_back(fb);
+        }
+      }
+
+      ~CF_ADDChain() {
+        for(CFunctionBlock *fb : mFBs) {
+          CTypeLib::deleteFB(fb);
+        }
+      }
+
+      //! feed paValue into the first FB and run the chain, returns the number of executed events
+      size_t run(TForteInt32 paValue) {
+        mFBs.front()->getDataInput(mIN1Id)->setValue(CIEC_DINT(paValue));
+        mFBs.front()->receiveInputEvent(0, &mECET);
+        return 1 + mECET.processEvents();
+      }
+
+      const CIEC_ANY &getResult() {
+        return mFBs.back()->getDataOutput(mOUTId)->unwrap();
+      }
+
+      CF_ADDChain(const CF_ADDChain&) = delete;
+      CF_ADDChain& operator=(const CF_ADDChain&) = delete;
+
+    private:
+      std::vector<CFunctionBlock*> mFBs;
+      CSynchronousECET mECET;
+      CStringDictionary::TStringId mIN1Id;
+      CStringDictionary::TStringId mOUTId;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(F_ADD_ChainBenchmark)
+
+  BOOST_AUTO_TEST_CASE(Benchmark_EventsThroughAChain) {
+    //per event cost of executing F_ADD and transferring its event and data to the next FB
+    const size_t chainLength = 1000;
+    const unsigned int rounds = 200;
+    CF_ADDChain chain(chainLength);
+    size_t numEvents = 0;
+    uint_fast64_t start = getNanoSecondsMonotonic();
+    for(unsigned int i = 0; i < rounds; ++i) {
+      numEvents += chain.run(static_cast<TForteInt32>(i));
+    }
+    uint_fast64_t duration = getNanoSecondsMonotonic() - start;
+    BOOST_CHECK_EQUAL(chainLength * rounds, numEvents);
+    BOOST_TEST(chain.getResult().equals(CIEC_DINT(static_cast<TForteInt32>(rounds - 1 + chainLength))));
+    BOOST_TEST_MESSAGE(rounds << " runs through a chain of " << chainLength << " F_ADD FBs: " << duration / 1000 << " us, "
+        << (duration > 0 ? numEvents * 1000000000ULL / duration : 0) << " events/s");
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
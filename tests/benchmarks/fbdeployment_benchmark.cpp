@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "../../src/core/fbcontainer.h"
+#include "../../src/core/funcbloc.h"
+#include "../../src/core/utils/arena.h"
+#include "fbtests/fbtesterglobalfixture.h"
+#include "resource.h"
+#include "forte_architecture_time.h"
+
+#include <string>
+
+using namespace forte::core;
+
+namespace {
+  //! container with its own arena, as a resource has it when cgResourceArenaChunkSize is set
+  class CDeploymentContainer : public CFBContainer {
+    public:
+      explicit CDeploymentContainer(bool paUseArena) :
+          CFBContainer(CStringDictionary::getInstance().insert("FBDeploymentBenchmark"), CFBTestDataGlobalFixture::getResource()),
+          mArena(paUseArena ? new util::CArena(64 * 1024) : nullptr) {
+      }
+
+      ~CDeploymentContainer() override {
+        deleteContainedFBs();
+        delete mArena;
+      }
+
+      util::CArena *getFBArena() override {
+        return mArena;
+      }
+
+      using CFBContainer::createFB;
+      using CFBContainer::getFB;
+      using CFBContainer::deleteContainedFBs;
+
+      util::CArena *mArena;
+  };
+
+  //! create a chain of counters connected by events and data, as an application deployment does
+  void deployCounterChain(CDeploymentContainer &paContainer, unsigned int paNumFBs) {
+    const CStringDictionary::TStringId typeId = CStringDictionary::getInstance().insert("E_CTU");
+    const CStringDictionary::TStringId cuoId = CStringDictionary::getInstance().insert("CUO");
+    const CStringDictionary::TStringId cuId = CStringDictionary::getInstance().insert("CU");
+    const CStringDictionary::TStringId cvId = CStringDictionary::getInstance().insert("CV");
+    const CStringDictionary::TStringId pvId = CStringDictionary::getInstance().insert("PV");
+    CFunctionBlock *previous = nullptr;
+    for(unsigned int i = 0; i < paNumFBs; ++i) {
+      const std::string instanceName = "Counter" + std::to_string(i);
+      CStringDictionary::TStringId instanceNameId = CStringDictionary::getInstance().insert(instanceName.c_str());
+      BOOST_REQUIRE(EMGMResponse::Ready == paContainer.createFB(instanceNameId, typeId));
+      CFunctionBlock *fb = paContainer.getFB(instanceNameId);
+      if(nullptr != previous) {
+        previous->getEOConnection(cuoId)->connect(fb, cuId);
+        previous->getDOConnection(cvId)->connect(fb, pvId);
+      }
+      previous = fb;
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(FBDeploymentBenchmark)
+
+  BOOST_AUTO_TEST_CASE(Benchmark_Deployment) {
+    const unsigned int nrOfFBs = 20000;
+    //FBs can only be placed in an arena when resource arenas are enabled
+    const int nrOfVariants = (0 != cgResourceArenaChunkSize) ? 2 : 1;
+    const char *const variantNames[] = { "heap", "arena" };
+    for(int useArena = 0; useArena < nrOfVariants; ++useArena) {
+      CDeploymentContainer container(0 != useArena);
+      uint_fast64_t start = getNanoSecondsMonotonic();
+      deployCounterChain(container, nrOfFBs);
+      const uint_fast64_t deployDuration = getNanoSecondsMonotonic() - start;
+      const size_t reservedBytes = (nullptr != container.mArena) ? container.mArena->getReservedBytes() : 0;
+
+      start = getNanoSecondsMonotonic();
+      container.deleteContainedFBs();
+      const uint_fast64_t deleteDuration = getNanoSecondsMonotonic() - start;
+      BOOST_TEST_MESSAGE("deployment of " << nrOfFBs << " connected E_CTUs on the " << variantNames[useArena] << ": "
+          << deployDuration / nrOfFBs << " ns per FB (" << reservedBytes / 1024 << " KiB in arena chunks), deletion "
+          << deleteDuration / nrOfFBs << " ns per FB");
+    }
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,21 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#define BOOST_TEST_MODULE FORTE_BENCHMARKS
+#include <boost/test/included/unit_test.hpp>
+#include "fbtests/fbtesterglobalfixture.h"
+
+#if defined(BOOST_NO_EXCEPTIONS) && BOOST_VERSION < 106500 // At least Boost v1.65 provides a simple NO_EXCEPTION version of throw_exception
+void boost::throw_exception(std::exception const&) {
+  //dummy
+}
+#endif
+
+//the benchmarks report their timings as messages, run them with --log_level=message
+static boost::unit_test::ut_detail::global_fixture_impl<CFBTestDataGlobalFixture> gfCFBTestDataGlobalFixture;
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "forte_boost_output_support.h"
+
+#include "../../src/core/datatypes/forte_string_fixed.h"
+#include "../../src/core/dataconn.h"
+#include "forte_architecture_time.h"
+
+#include <vector>
+
+namespace {
+  //! send state tags through data connections, as from the DOs of one FB to the DIs of the next ones
+  template<typename T>
+  void transferStateTags(std::vector<T> &paOutputs, std::vector<T> &paConnValues, std::vector<T> &paInputs,
+      const std::vector<CIEC_STRING> &paTags, unsigned int paCycle) {
+    for(size_t i = 0; i < paOutputs.size(); ++i) {
+      CDataConnection connection(nullptr, 0, &paConnValues[i]);
+      paOutputs[i] = paTags[(i + paCycle) % paTags.size()];
+      connection.writeData(paOutputs[i]);
+      connection.readData(paInputs[i]);
+    }
+  }
+
+  template<typename T>
+  void benchmarkStateTagConnections(const char *paTypeName, const std::vector<CIEC_STRING> &paTags) {
+    const size_t nrOfConnections = 1000;
+    const unsigned int nrOfCycles = 1000;
+    std::vector<T> outputs(nrOfConnections);
+    std::vector<T> connValues(nrOfConnections);
+    std::vector<T> inputs(nrOfConnections);
+
+    uint_fast64_t start = getNanoSecondsMonotonic();
+    transferStateTags(outputs, connValues, inputs, paTags, 0);
+    const uint_fast64_t firstCycle = getNanoSecondsMonotonic() - start;
+
+    start = getNanoSecondsMonotonic();
+    for(unsigned int cycle = 1; cycle <= nrOfCycles; ++cycle) {
+      transferStateTags(outputs, connValues, inputs, paTags, cycle);
+    }
+    const uint_fast64_t steadyState = getNanoSecondsMonotonic() - start;
+    BOOST_TEST(inputs[0] == paTags[nrOfCycles % paTags.size()]);
+    BOOST_TEST_MESSAGE(paTypeName << ": first transfer " << firstCycle / nrOfConnections << " ns, following transfers "
+        << steadyState / (nrOfCycles * nrOfConnections) << " ns per connection");
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(CIEC_STRING_FIXED_benchmark)
+
+BOOST_AUTO_TEST_CASE(Benchmark_StateTagConnectionThroughput) {
+  const std::vector<CIEC_STRING> tags = {
+    "Conveyor1.Running"_STRING, "Conveyor1.Stopped.Manual"_STRING, "Press2.Fault.Overtemperature"_STRING,
+    "Press2.WaitingForMaterial"_STRING, "Robot3.Homing"_STRING, "Robot3.Cycle.Pick.Approach"_STRING
+  };
+  benchmarkStateTagConnections<CIEC_STRING>("STRING", tags);
+  benchmarkStateTagConnections<CIEC_STRING_FIXED<32>>("STRING[32]", tags);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
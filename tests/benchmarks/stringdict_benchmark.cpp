@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "stringdict.h"
+#include "forte_architecture_time.h"
+
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(StringDictBenchmark)
+
+  BOOST_AUTO_TEST_CASE(Benchmark_BootFileInserts){
+    //replay the inserts of a boot file creating 50k FBs, each connected with an event and a data connection to its
+    //successor, as the management commands parse instance, type, and port names
+    const unsigned int nrOfFBs = 50000;
+    const char *const types[] = { "E_CYCLE", "E_SPLIT", "E_MERGE", "E_SR", "E_CTU", "F_ADD", "F_MOVE", "F_SEL",
+        "PUBLISH_1", "SUBSCRIBE_1" };
+    const char *const ports[] = { "EO", "EI", "OUT", "IN1", "REQ", "CNF", "QI", "QO" };
+    std::vector<std::string> fbNames;
+    for(unsigned int i = 0; i < nrOfFBs; i++){
+      fbNames.push_back("BootFileFB" + std::to_string(i));
+    }
+
+    size_t nrOfInserts = 0;
+    uint_fast64_t start = getNanoSecondsMonotonic();
+    for(unsigned int i = 0; i < nrOfFBs; i++){
+      //<FB Name="..." Type="..."/>
+      CStringDictionary::getInstance().insert(fbNames[i].c_str(), fbNames[i].size());
+      CStringDictionary::getInstance().insert(types[i % 10]);
+      nrOfInserts += 2;
+    }
+    for(unsigned int i = 0; i + 1 < nrOfFBs; i++){
+      //<Connection Source="FB.EO" Destination="Successor.EI"/> and the same for OUT and IN1
+      for(unsigned int j = 0; j < 4; j += 2){
+        CStringDictionary::getInstance().insert(fbNames[i].c_str(), fbNames[i].size());
+        CStringDictionary::getInstance().insert(ports[j]);
+        CStringDictionary::getInstance().insert(fbNames[i + 1].c_str(), fbNames[i + 1].size());
+        CStringDictionary::getInstance().insert(ports[j + 1]);
+        nrOfInserts += 4;
+      }
+    }
+    uint_fast64_t duration = getNanoSecondsMonotonic() - start;
+
+    BOOST_CHECK(CStringDictionary::scmInvalidStringId != CStringDictionary::getInstance().getId(fbNames.back().c_str()));
+    BOOST_TEST_MESSAGE("string dictionary: " << nrOfInserts << " inserts of a " << nrOfFBs << " FB boot file in "
+        << duration / 1000000 << " ms, " << duration / nrOfInserts << " ns per insert");
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "../../../src/core/cominfra/basecommfb.h"
+#include "../../../src/core/cominfra/comlayer.h"
+#include "../fbtests/fbtesterglobalfixture.h"
+#include "typelib.h"
+#include "resource.h"
+#include "ecet.h"
+
+using namespace forte::com_infra;
+
+namespace {
+  //! layer counting how often its FB let it process an interrupt
+  class CCountingLayerMock : public CComLayer {
+    public:
+      explicit CCountingLayerMock(CBaseCommFB *paFB) :
+          CComLayer(nullptr, paFB), mNumInterrupts(0) {
+      }
+
+      EComResponse sendData(void *, unsigned int) override {
+        return e_ProcessDataOk;
+      }
+
+      EComResponse recvData(const void *, unsigned int) override {
+        return e_ProcessDataOk;
+      }
+
+      EComResponse processInterrupt() override {
+        ++mNumInterrupts;
+        return e_ProcessDataOk;
+      }
+
+      EComResponse openConnection(char *) override {
+        return e_InitOk;
+      }
+
+      void closeConnection() override {
+      }
+
+      unsigned int mNumInterrupts;
+  };
+
+  //! event inputs of the communication FBs
+  const TEventID scmINIT = 0;
+  const TEventID scmREQ = 1;
+
+  /*!\brief Started communication FB whose events are only processed when the test delivers them
+   */
+  class CCommFBFixture {
+    public:
+      explicit CCommFBFixture(const char *paFBType = "SUBSCRIBE_1") :
+          mFB(CTypeLib::createFB(CStringDictionary::getInstance().insert("CommFBTest"),
+              CStringDictionary::getInstance().insert(paFBType), CFBTestDataGlobalFixture::getResource())),
+          mLayer(static_cast<CBaseCommFB*>(mFB)) {
+        BOOST_REQUIRE(nullptr != mFB);
+        BOOST_REQUIRE(EMGMResponse::Ready == mFB->changeFBExecutionState(EMGMCommandType::Start));
+      }
+
+      ~CCommFBFixture() {
+        mFB->changeFBExecutionState(EMGMCommandType::Stop);
+        CTypeLib::deleteFB(mFB);
+      }
+
+      CBaseCommFB &getCommFB() {
+        return *static_cast<CBaseCommFB*>(mFB);
+      }
+
+      //! deliver the external event of the layers as the FB's ECET would do
+      void processInterrupts() {
+        deliverEvent(cgExternalEventID);
+      }
+
+      void deliverEvent(TEventID paEIID) {
+        getCommFB().receiveInputEvent(paEIID, CFBTestDataGlobalFixture::getResource().getResourceEventExecution());
+      }
+
+      bool statusIs(const char *paText) {
+        return 0 == strcmp(paText, getCommFB().STATUS().getValue());
+      }
+
+      CFunctionBlock *mFB;
+      CCountingLayerMock mLayer;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(CommFBInterruptQueue)
+
+  BOOST_AUTO_TEST_CASE(BurstUpToTheQueueSizeIsKept) {
+    CCommFBFixture fixture;
+    const size_t queueSize = fixture.getCommFB().getInterruptStatistics().mQueueSize;
+    BOOST_CHECK(queueSize >= cgCommunicationInterruptQueueSize);
+
+    for(size_t i = 0; i < queueSize; ++i) {
+      BOOST_CHECK(fixture.getCommFB().interruptCommFB(&fixture.mLayer));
+    }
+    fixture.processInterrupts();
+    BOOST_CHECK_EQUAL(queueSize, fixture.mLayer.mNumInterrupts);
+
+    SComInterruptStatistics statistics = fixture.getCommFB().getInterruptStatistics();
+    BOOST_CHECK_EQUAL(queueSize, statistics.mHighWaterMark);
+    BOOST_CHECK_EQUAL(0, statistics.mDroppedInterrupts);
+  }
+
+  BOOST_AUTO_TEST_CASE(OverflowIsCounted) {
+    CCommFBFixture fixture;
+    const size_t queueSize = fixture.getCommFB().getInterruptStatistics().mQueueSize;
+
+    for(size_t i = 0; i < queueSize + 3; ++i) {
+      fixture.getCommFB().interruptCommFB(&fixture.mLayer);
+    }
+    BOOST_CHECK_EQUAL(3, fixture.getCommFB().getInterruptStatistics().mDroppedInterrupts);
+
+    //the queue takes new interrupts again once it has been processed
+    fixture.processInterrupts();
+    BOOST_CHECK_EQUAL(queueSize, fixture.mLayer.mNumInterrupts);
+    BOOST_CHECK(fixture.getCommFB().interruptCommFB(&fixture.mLayer));
+    fixture.processInterrupts();
+    BOOST_CHECK_EQUAL(queueSize + 1, fixture.mLayer.mNumInterrupts);
+
+    fixture.getCommFB().resetInterruptStatistics();
+    SComInterruptStatistics statistics = fixture.getCommFB().getInterruptStatistics();
+    BOOST_CHECK_EQUAL(0, statistics.mDroppedInterrupts);
+    BOOST_CHECK_EQUAL(0, statistics.mHighWaterMark);
+  }
+
+  BOOST_AUTO_TEST_CASE(CommFBsAreFoundWithoutRTTI) {
+    CCommFBFixture fixture;
+    BOOST_CHECK(&fixture.getCommFB() == fixture.mFB->asCommFB());
+
+    CFunctionBlock *counter = CTypeLib::createFB(CStringDictionary::getInstance().insert("CommFBTestCounter"),
+        CStringDictionary::getInstance().insert("E_CTU"), CFBTestDataGlobalFixture::getResource());
+    BOOST_REQUIRE(nullptr != counter);
+    BOOST_CHECK(nullptr == counter->asCommFB());
+    CTypeLib::deleteFB(counter);
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(CommFBResponseStatus)
+
+  BOOST_AUTO_TEST_CASE(StatusFollowsTheResponse) {
+    CCommFBFixture fixture("PUBLISH_1");
+    fixture.getCommFB().QI() = CIEC_BOOL(false);
+    fixture.deliverEvent(scmREQ);
+    BOOST_CHECK(fixture.statusIs("INHIBITED"));
+    BOOST_CHECK(!fixture.getCommFB().QO());
+
+    fixture.getCommFB().QI() = CIEC_BOOL(true);
+    fixture.getCommFB().ID().fromString("loc[CommFBResponseStatus]");
+    fixture.deliverEvent(scmINIT);
+    BOOST_CHECK(fixture.statusIs("OK"));
+    BOOST_CHECK(fixture.getCommFB().QO());
+
+    fixture.deliverEvent(scmREQ);
+    fixture.deliverEvent(scmREQ);
+    BOOST_CHECK(fixture.statusIs("OK"));
+    BOOST_CHECK(fixture.getCommFB().QO());
+
+    fixture.getCommFB().QI() = CIEC_BOOL(false);
+    fixture.deliverEvent(scmINIT);
+    BOOST_CHECK(fixture.statusIs("TERMINATED"));
+    BOOST_CHECK(!fixture.getCommFB().QO());
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -14,6 +14,7 @@
  *******************************************************************************/
 #include <boost/test/unit_test.hpp>
 #include <algorithm>
+#include <vector>
 
 #include "forte_boost_output_support.h"
 
@@ -50,6 +51,9 @@
 #include "../../../src/core/datatypes/forte_lint.h"
 #include "../../../src/core/datatypes/forte_ulint.h"
 #include "../../../src/core/datatypes/forte_lreal.h"
+#include "../../../src/core/datatypes/forte_struct.h"
+#include "../../../src/core/datatypes/forte_any_variant.h"
+#include "../../../src/core/typelib.h"
 
 #ifdef FORTE_ENABLE_GENERATED_SOURCE_CPP
 #include "fbdkasn1layerser_test_gen.cpp"
@@ -121,6 +125,127 @@ class CFBDKASN1ComLayerTestMock: public forte::com_infra::CFBDKASN1ComLayer{
 };
 
 
+//! ASN.1 layer handing the serialized data on without copying it, as a socket layer would
+class CFBDKASN1ComLayerSendMock : public forte::com_infra::CFBDKASN1ComLayer {
+  public:
+    CFBDKASN1ComLayerSendMock() : forte::com_infra::CFBDKASN1ComLayer(nullptr, nullptr){
+      mBottomLayer = &mTestLayer;
+    }
+
+    ~CFBDKASN1ComLayerSendMock() override {
+      mBottomLayer = nullptr;
+    }
+
+    const TForteByte *getSendDataPtr() const {
+      return mTestLayer.mData;
+    }
+    unsigned int getSendDataSize() const {
+      return mTestLayer.mSize;
+    }
+
+  private:
+    class CPassThroughBottomLayer : public forte::com_infra::CComLayer {
+      public:
+        CPassThroughBottomLayer() : forte::com_infra::CComLayer(nullptr, nullptr), mData(nullptr), mSize(0){
+        }
+
+        forte::com_infra::EComResponse sendData(void *paData, unsigned int paSize) override {
+          mData = static_cast<const TForteByte *>(paData);
+          mSize = paSize;
+          return forte::com_infra::e_ProcessDataOk;
+        }
+
+        void closeConnection() override {}
+        forte::com_infra::EComResponse recvData(const void *, unsigned int) override {
+          return forte::com_infra::e_ProcessDataOk;
+        }
+        forte::com_infra::EComResponse openConnection(char *) override {
+          return forte::com_infra::e_ProcessDataOk;
+        }
+
+        const TForteByte *mData;
+        unsigned int mSize;
+    };
+
+    CPassThroughBottomLayer mTestLayer;
+};
+
+class CIEC_ASN1TestStruct : public CIEC_STRUCT {
+  DECLARE_FIRMWARE_DATATYPE(ASN1TestStruct)
+
+  public:
+    CIEC_BOOL Var1;
+    CIEC_DINT Var2;
+    CIEC_LREAL Var3;
+    CIEC_STRING Var4;
+
+    CIEC_ASN1TestStruct() = default;
+
+    size_t getStructSize() const override {
+      return 4;
+    }
+
+    const CStringDictionary::TStringId* elementNames() const override {
+      return scmElementNames;
+    }
+
+    CStringDictionary::TStringId getStructTypeNameID() const override {
+      return g_nStringIdASN1TestStruct;
+    }
+
+    CIEC_ANY *getMember(size_t paMemberIndex) override {
+      switch(paMemberIndex) {
+        case 0: return &Var1;
+        case 1: return &Var2;
+        case 2: return &Var3;
+        case 3: return &Var4;
+      }
+      return nullptr;
+    }
+
+    const CIEC_ANY *getMember(size_t paMemberIndex) const override {
+      switch(paMemberIndex) {
+        case 0: return &Var1;
+        case 1: return &Var2;
+        case 2: return &Var3;
+        case 3: return &Var4;
+      }
+      return nullptr;
+    }
+
+  private:
+    static const CStringDictionary::TStringId scmElementNames[];
+};
+
+const CStringDictionary::TStringId CIEC_ASN1TestStruct::scmElementNames[] = { g_nStringIdVal1, g_nStringIdVal2, g_nStringIdVal3, g_nStringIdVal4 };
+
+DEFINE_FIRMWARE_DATATYPE(ASN1TestStruct, g_nStringIdASN1TestStruct)
+
+namespace {
+  void fillTestStructArray(CIEC_ARRAY &paArray){
+    for(size_t i = 0; i < paArray.size(); ++i){
+      CIEC_ASN1TestStruct &element = static_cast<CIEC_ASN1TestStruct &>(paArray[static_cast<TForteUInt16>(i)]);
+      element.Var1 = CIEC_BOOL(0 == (i % 2));
+      element.Var2 = CIEC_DINT(static_cast<TForteInt32>(i * 1000));
+      element.Var3 = CIEC_LREAL(static_cast<TForteDFloat>(i) / 3.0);
+      element.Var4 = CIEC_STRING("element", 7);
+    }
+  }
+
+  //! the compiled serialization of sendData has to produce the same bytes as the generic one
+  void checkCompiledSerialization(const CIEC_ANY **paData, unsigned int paDataNum){
+    CFBDKASN1ComLayerSendMock testee;
+    std::vector<TForteByte> expected(8192);
+    int expectedSize = testee.serializeDataPointArray(expected.data(), static_cast<unsigned int>(expected.size()), paData, paDataNum);
+    BOOST_REQUIRE(0 < expectedSize);
+    //the second call runs the cached serialization program
+    for(int i = 0; i < 2; ++i){
+      BOOST_REQUIRE_EQUAL(forte::com_infra::e_ProcessDataOk, testee.sendData(paData, paDataNum));
+      BOOST_REQUIRE_EQUAL(static_cast<unsigned int>(expectedSize), testee.getSendDataSize());
+      BOOST_CHECK(std::equal(expected.data(), expected.data() + expectedSize, testee.getSendDataPtr()));
+    }
+  }
+}
 
 BOOST_AUTO_TEST_SUITE(fbdkasn1layer_serialize_test)
 
@@ -1011,4 +1136,97 @@ BOOST_AUTO_TEST_CASE(Single_Serialize_Test_ARRAY){
   BOOST_CHECK(std::equal(cgArrayStringEmptyHalloWorld, cgArrayStringEmptyHalloWorld + cgString2SerSize, ((TForteByte *)nTestee.getSendDataPtr())));
 }
 
+BOOST_AUTO_TEST_CASE(Single_Serialize_Test_StructArray){
+  CFBDKASN1ComLayerSendMock nTestee;
+  CIEC_ARRAY_DYNAMIC nStructArray(16, g_nStringIdASN1TestStruct);
+  fillTestStructArray(nStructArray);
+  const CIEC_ANY *poArray[] = { &nStructArray };
+
+  TForteByte acExpected[1024];
+  int nExpectedSize = nTestee.serializeDataPoint(acExpected, sizeof(acExpected), nStructArray);
+  BOOST_REQUIRE(0 < nExpectedSize);
+
+  //the first send has to size the initially empty serialization buffer
+  BOOST_CHECK_EQUAL(forte::com_infra::e_ProcessDataOk, nTestee.sendData(poArray, 1));
+  BOOST_CHECK_EQUAL(nTestee.getSendDataSize(), nExpectedSize);
+  BOOST_CHECK(std::equal(acExpected, acExpected + nExpectedSize, nTestee.getSendDataPtr()));
+
+  //a larger message grows the buffer again
+  CIEC_ARRAY_DYNAMIC nLargeStructArray(48, g_nStringIdASN1TestStruct);
+  fillTestStructArray(nLargeStructArray);
+  poArray[0] = &nLargeStructArray;
+  BOOST_CHECK_EQUAL(forte::com_infra::e_ProcessDataOk, nTestee.sendData(poArray, 1));
+  BOOST_CHECK_EQUAL(nTestee.getSendDataSize(), 3 * (nExpectedSize - 4) + 4);
+
+  poArray[0] = &nStructArray;
+  BOOST_CHECK_EQUAL(forte::com_infra::e_ProcessDataOk, nTestee.sendData(poArray, 1));
+  BOOST_CHECK_EQUAL(nTestee.getSendDataSize(), nExpectedSize);
+  BOOST_CHECK(std::equal(acExpected, acExpected + nExpectedSize, nTestee.getSendDataPtr()));
+}
+
+BOOST_AUTO_TEST_CASE(Compiled_Serialize_Follows_SD_Changes){
+  CFBDKASN1ComLayerSendMock nTestee;
+  CIEC_ANY_VARIANT nVariant(CIEC_DINT(5));
+  CIEC_ARRAY_DYNAMIC nStructArray(4, g_nStringIdASN1TestStruct);
+  fillTestStructArray(nStructArray);
+  CIEC_ARRAY_DYNAMIC nBoolArray(5, g_nStringIdBOOL);
+  CIEC_TIME nTime(static_cast<CIEC_TIME::TValueType>(3000000));
+  CIEC_BOOL nBool(true);
+  const CIEC_ANY *poArray[] = { &nVariant, &nStructArray, &nBoolArray, &nTime, &nBool };
+
+  //the compiled serialization has to produce the same bytes as the generic one
+  auto checkSendData = [&nTestee, &poArray]() {
+    TForteByte acExpected[512];
+    int nExpectedSize = nTestee.serializeDataPointArray(acExpected, sizeof(acExpected), poArray, 5);
+    BOOST_REQUIRE(0 < nExpectedSize);
+    BOOST_CHECK_EQUAL(forte::com_infra::e_ProcessDataOk, nTestee.sendData(poArray, 5));
+    BOOST_CHECK_EQUAL(nTestee.getSendDataSize(), nExpectedSize);
+    BOOST_CHECK(std::equal(acExpected, acExpected + nExpectedSize, nTestee.getSendDataPtr()));
+  };
+
+  checkSendData();
+
+  //changed values are picked up by the compiled serialization
+  nVariant.setValue(CIEC_DINT(-7));
+  static_cast<CIEC_BOOL &>(nBoolArray[1]) = CIEC_BOOL(true);
+  static_cast<CIEC_BOOL &>(nBoolArray[4]) = CIEC_BOOL(true);
+  static_cast<CIEC_ASN1TestStruct &>(nStructArray[2]).Var4 = CIEC_STRING("a longer string", 15);
+  static_cast<CIEC_ASN1TestStruct &>(nStructArray[3]).Var1 = CIEC_BOOL(true);
+  nBool = CIEC_BOOL(false);
+  checkSendData();
+
+  //a new data type of an ANY SD requires a new serialization program
+  nVariant.setValue(CIEC_STRING("changed", 7));
+  checkSendData();
+  nVariant.setValue(CIEC_LREAL(1.5));
+  checkSendData();
+}
+
+BOOST_AUTO_TEST_CASE(Compiled_Serialize_DINTArray){
+  CIEC_ARRAY_DYNAMIC nDIntArray(256, g_nStringIdDINT);
+  for(TForteUInt16 i = 0; i < nDIntArray.size(); ++i){
+    static_cast<CIEC_DINT &>(nDIntArray[i]) = CIEC_DINT(i * 4099);
+  }
+  const CIEC_ANY *poArray[] = { &nDIntArray };
+  checkCompiledSerialization(poArray, 1);
+}
+
+BOOST_AUTO_TEST_CASE(Compiled_Serialize_StringArray){
+  CIEC_ARRAY_DYNAMIC nStringArray(32, g_nStringIdSTRING);
+  for(TForteUInt16 i = 0; i < nStringArray.size(); ++i){
+    static_cast<CIEC_STRING &>(nStringArray[i]) = "HalloWorldHallo!"_STRING;
+  }
+  const CIEC_ANY *poArray[] = { &nStringArray };
+  checkCompiledSerialization(poArray, 1);
+}
+
+BOOST_AUTO_TEST_CASE(Compiled_Serialize_StructArray){
+  CIEC_ARRAY_DYNAMIC nStructArray(64, g_nStringIdASN1TestStruct);
+  fillTestStructArray(nStructArray);
+  CIEC_DINT nDInt(42);
+  CIEC_STRING nString("status", 6);
+  const CIEC_ANY *poArray[] = { &nStructArray, &nDInt, &nString };
+  checkCompiledSerialization(poArray, 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
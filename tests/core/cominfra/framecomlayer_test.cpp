@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "../../../src/core/cominfra/framecomlayer.h"
+#include "../../../src/core/cominfra/fbdkasn1layer.h"
+#include "../../../src/core/cominfra/basecommfb.h"
+#include "../../../src/core/datatypes/forte_dint.h"
+#include "../fbtests/fbtesterglobalfixture.h"
+#include "typelib.h"
+#include "resource.h"
+#include "ecet.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace forte::com_infra;
+
+namespace {
+  //! layer recording what is handed on to it, used above and below the frame layer
+  class CRecordingLayerMock : public CComLayer {
+    public:
+      CRecordingLayerMock() :
+          CComLayer(nullptr, nullptr), mNumReceived(0) {
+      }
+
+      ~CRecordingLayerMock() override {
+        //the frame layer is a member of the test fixture and must not be deleted by its top layer
+        mBottomLayer = nullptr;
+      }
+
+      EComResponse sendData(void *paData, unsigned int paSize) override {
+        mSent.assign(static_cast<const char*>(paData), paSize);
+        return e_ProcessDataOk;
+      }
+
+      EComResponse recvData(const void *paData, unsigned int paSize) override {
+        ++mNumReceived;
+        mReceived.emplace_back(static_cast<const char*>(paData), paSize);
+        mReceivedAt.push_back(paData);
+        return e_ProcessDataOk;
+      }
+
+      EComResponse openConnection(char *) override {
+        return e_InitOk;
+      }
+
+      void closeConnection() override {
+      }
+
+      size_t mNumReceived;
+      std::string mSent;
+      std::vector<std::string> mReceived;
+      std::vector<const void *> mReceivedAt;
+  };
+
+  class CFrameLayerFixture {
+    public:
+      CFrameLayerFixture() :
+          mLayer(&mTopLayer, nullptr) {
+        mLayer.setBottomLayer(&mBottomLayer);
+        char params[] = "";
+        BOOST_REQUIRE_EQUAL(e_InitOk, static_cast<CComLayer&>(mLayer).openConnection(params));
+      }
+
+      ~CFrameLayerFixture() {
+        mLayer.setBottomLayer(nullptr);
+      }
+
+      EComResponse receive(const std::string &paData) {
+        return mLayer.recvData(paData.data(), static_cast<unsigned int>(paData.size()));
+      }
+
+      //! hand on the queued frames as the interrupts of the FB would do
+      void processInterrupts() {
+        while(e_Nothing != mLayer.processInterrupt()) {
+        }
+      }
+
+      CRecordingLayerMock mTopLayer;
+      CRecordingLayerMock mBottomLayer;
+      CFrameComLayer mLayer;
+  };
+
+  std::string frame(const std::string &paMessage) {
+    TForteByte prefix[CFrameComLayer::scmMaxLengthPrefixSize];
+    unsigned int prefixSize = CFrameComLayer::encodeLength(static_cast<TForteUInt32>(paMessage.size()), prefix);
+    return std::string(reinterpret_cast<const char*>(prefix), prefixSize) + paMessage;
+  }
+
+  std::string dintMessage(TForteByte paValue) {
+    return std::string("\x44\0\0\0", 4) + static_cast<char>(paValue);
+  }
+
+  /*!\brief SUBSCRIBE_1 receiving through the fbdk layer stacked on the frame layer
+   *
+   * The FB is not started and ignores the external events of the frame layer, so the test processes the interrupts.
+   */
+  class CFramedSubscriberFixture {
+    public:
+      CFramedSubscriberFixture() :
+          mFB(CTypeLib::createFB(CStringDictionary::getInstance().insert("FrameComLayerTest"),
+              CStringDictionary::getInstance().insert("SUBSCRIBE_1"), CFBTestDataGlobalFixture::getResource())) {
+        BOOST_REQUIRE(nullptr != mFB);
+        getCommFB().getRDs()[0]->setValue(CIEC_DINT(0));
+        mTopLayer.reset(new CFBDKASN1ComLayer(nullptr, &getCommFB()));
+        //owned by the fbdk layer as in a stack built from the ID
+        mFrameLayer = new CFrameComLayer(mTopLayer.get(), &getCommFB());
+        char params[] = "";
+        BOOST_REQUIRE_EQUAL(e_InitOk, static_cast<CComLayer&>(*mFrameLayer).openConnection(params));
+      }
+
+      ~CFramedSubscriberFixture() {
+        mTopLayer.reset();
+        //let the resource's ECET discard the external events sent to the FB before deleting it
+        CEventChainExecutionThread *ecet = CFBTestDataGlobalFixture::getResource().getResourceEventExecution();
+        do {
+          CThread::sleepThread(10);
+        } while(ecet->isProcessingEvents());
+        CTypeLib::deleteFB(mFB);
+      }
+
+      CBaseCommFB &getCommFB() {
+        return *static_cast<CBaseCommFB*>(mFB);
+      }
+
+      TForteInt32 getValue() {
+        return static_cast<CIEC_DINT::TValueType>(static_cast<const CIEC_DINT &>(getCommFB().getRDs()[0]->unwrap()));
+      }
+
+      CFunctionBlock *mFB;
+      std::unique_ptr<CFBDKASN1ComLayer> mTopLayer;
+      CFrameComLayer *mFrameLayer;
+  };
+
+  std::vector<std::string> testMessages() {
+    return { "first", "", std::string(300, 'x'), "last" };
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(FrameComLayer)
+
+  BOOST_AUTO_TEST_CASE(LengthPrefixSizes) {
+    TForteByte buffer[CFrameComLayer::scmMaxLengthPrefixSize];
+    BOOST_CHECK_EQUAL(1, CFrameComLayer::encodeLength(0, buffer));
+    BOOST_CHECK_EQUAL(1, CFrameComLayer::encodeLength(127, buffer));
+    BOOST_CHECK_EQUAL(2, CFrameComLayer::encodeLength(128, buffer));
+    BOOST_CHECK_EQUAL(0x80, buffer[0]);
+    BOOST_CHECK_EQUAL(0x01, buffer[1]);
+    BOOST_CHECK_EQUAL(3, CFrameComLayer::encodeLength(16384, buffer));
+    BOOST_CHECK_EQUAL(5, CFrameComLayer::encodeLength(0xFFFFFFFF, buffer));
+    BOOST_CHECK_EQUAL(0x0F, buffer[4]);
+  }
+
+  BOOST_AUTO_TEST_CASE(SendPrependsTheLength) {
+    CFrameLayerFixture fixture;
+    std::string message(200, 'a');
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, fixture.mLayer.sendData(&message[0], static_cast<unsigned int>(message.size())));
+    BOOST_CHECK_EQUAL(frame(message), fixture.mBottomLayer.mSent);
+  }
+
+  BOOST_AUTO_TEST_CASE(CompleteFramesAreHandedOnInPlace) {
+    CFrameLayerFixture fixture;
+    std::vector<std::string> messages = testMessages();
+    std::string stream;
+    for(const std::string &message : messages) {
+      stream += frame(message);
+    }
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, fixture.receive(stream));
+    //only the first frame is handed on with the received data, the others wait for their own interrupts
+    BOOST_REQUIRE_EQUAL(1, fixture.mTopLayer.mNumReceived);
+    BOOST_CHECK_EQUAL(static_cast<const void*>(stream.data() + 1), fixture.mTopLayer.mReceivedAt[0]);
+    for(size_t i = 1; i < messages.size(); ++i) {
+      BOOST_CHECK_EQUAL(e_ProcessDataOk, fixture.mLayer.processInterrupt());
+      BOOST_CHECK_EQUAL(i + 1, fixture.mTopLayer.mNumReceived);
+    }
+    BOOST_CHECK_EQUAL(e_Nothing, fixture.mLayer.processInterrupt());
+    BOOST_CHECK_EQUAL_COLLECTIONS(messages.begin(), messages.end(), fixture.mTopLayer.mReceived.begin(),
+        fixture.mTopLayer.mReceived.end());
+  }
+
+  BOOST_AUTO_TEST_CASE(FramesReceivedWhileOthersAreQueuedKeepTheirOrder) {
+    CFrameLayerFixture fixture;
+    fixture.receive(frame("first") + frame("second"));
+    fixture.receive(frame("third"));
+    fixture.processInterrupts();
+    std::vector<std::string> expected = { "first", "second", "third" };
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), fixture.mTopLayer.mReceived.begin(),
+        fixture.mTopLayer.mReceived.end());
+  }
+
+  BOOST_AUTO_TEST_CASE(FramesCutAtAnyPositionAreReassembled) {
+    std::vector<std::string> messages = testMessages();
+    std::string stream;
+    for(const std::string &message : messages) {
+      stream += frame(message);
+    }
+    for(size_t chunkSize = 1; chunkSize < 8; ++chunkSize) {
+      CFrameLayerFixture fixture;
+      for(size_t pos = 0; pos < stream.size(); pos += chunkSize) {
+        fixture.receive(stream.substr(pos, chunkSize));
+        fixture.processInterrupts();
+      }
+      BOOST_CHECK_EQUAL_COLLECTIONS(messages.begin(), messages.end(), fixture.mTopLayer.mReceived.begin(),
+          fixture.mTopLayer.mReceived.end());
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(OversizedFramesAreSkipped) {
+    CFrameLayerFixture fixture;
+    std::string oversized = frame(std::string(cgFrameLayerMaxFrameSize + 1, 'o'));
+    BOOST_CHECK_EQUAL(e_ProcessDataRecvFaild, fixture.receive(oversized.substr(0, 10)));
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, fixture.receive(oversized.substr(10) + frame("next")));
+    BOOST_REQUIRE_EQUAL(1, fixture.mTopLayer.mReceived.size());
+    BOOST_CHECK_EQUAL("next", fixture.mTopLayer.mReceived[0]);
+  }
+
+  BOOST_AUTO_TEST_CASE(InvalidLengthPrefixIsReported) {
+    CFrameLayerFixture fixture;
+    BOOST_CHECK_EQUAL(e_ProcessDataRecvFaild, fixture.receive(std::string(6, '\xFF')));
+    BOOST_CHECK(fixture.mTopLayer.mReceived.empty());
+  }
+
+  BOOST_AUTO_TEST_CASE(FbdkLayerGetsOneIndicationPerFrame) {
+    CFramedSubscriberFixture fixture;
+    const std::string stream = frame(dintMessage(1)) + frame(dintMessage(2)) + frame(dintMessage(3));
+    //an IND is sent for each processed data of the layers the FB gets e_ProcessDataOk for
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, fixture.mFrameLayer->recvData(stream.data(), static_cast<unsigned int>(stream.size())));
+    BOOST_CHECK_EQUAL(1, fixture.getValue());
+    //the frame layer has interrupted the FB for the queued frames
+    BOOST_CHECK_EQUAL(1, fixture.getCommFB().getInterruptStatistics().mHighWaterMark);
+
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, fixture.mFrameLayer->processInterrupt());
+    BOOST_CHECK_EQUAL(2, fixture.getValue());
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, fixture.mFrameLayer->processInterrupt());
+    BOOST_CHECK_EQUAL(3, fixture.getValue());
+    BOOST_CHECK_EQUAL(e_Nothing, fixture.mFrameLayer->processInterrupt());
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
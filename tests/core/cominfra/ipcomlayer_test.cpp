@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "../../../src/core/cominfra/ipcomlayer.h"
+#include "../../../src/core/cominfra/basecommfb.h"
+#include "../fbtests/fbtesterglobalfixture.h"
+#include "typelib.h"
+#include "resource.h"
+#include "ecet.h"
+#include "forte_architecture_time.h"
+
+#include <string>
+#include <vector>
+
+using namespace forte::com_infra;
+using namespace std::string_literals;
+
+namespace {
+  const unsigned short scmTestPort = 51480;
+
+  //! upper layer recording the messages handed on by the ip layer
+  class CRecordingLayerMock : public CComLayer {
+    public:
+      CRecordingLayerMock() :
+          CComLayer(nullptr, nullptr), mResponse(e_ProcessDataOk) {
+      }
+
+      ~CRecordingLayerMock() override {
+        //the ip layer is a member of the test fixture and must not be deleted by its top layer
+        mBottomLayer = nullptr;
+      }
+
+      EComResponse sendData(void *, unsigned int) override {
+        return e_ProcessDataOk;
+      }
+
+      EComResponse recvData(const void *paData, unsigned int paSize) override {
+        mReceived.emplace_back(static_cast<const char*>(paData), paSize);
+        return mResponse;
+      }
+
+      EComResponse openConnection(char *) override {
+        return e_InitOk;
+      }
+
+      void closeConnection() override {
+      }
+
+      std::vector<std::string> mReceived;
+      EComResponse mResponse; //!< response returned for each received message
+  };
+
+  /*!\brief Subscriber ip layer of a SUBSCRIBE_1 FB which is never started
+   *
+   * The FB ignores the external events of the layer, so the queued messages stay until the test calls processInterrupt.
+   */
+  class CIPSubscriberFixture {
+    public:
+      explicit CIPSubscriberFixture(const char *paPolicy) :
+          mFB(CTypeLib::createFB(CStringDictionary::getInstance().insert("IPRecvQueueTest"),
+              CStringDictionary::getInstance().insert("SUBSCRIBE_1"), CFBTestDataGlobalFixture::getResource())),
+          mLayer(&mTopLayer, static_cast<CBaseCommFB*>(mFB)) {
+        BOOST_REQUIRE(nullptr != mFB);
+        std::string params = "127.0.0.1:51480;"s + paPolicy;
+        BOOST_REQUIRE_EQUAL(e_InitOk, static_cast<CComLayer&>(mLayer).openConnection(&params[0]));
+        char address[] = "127.0.0.1";
+        mSender = CIPComSocketHandler::openUDPSendPort(address, scmTestPort, &mDestAddr);
+        BOOST_REQUIRE(CIPComSocketHandler::scmInvalidSocketDescriptor != mSender);
+      }
+
+      ~CIPSubscriberFixture() {
+        static_cast<CComLayer&>(mLayer).closeConnection();
+        CIPComSocketHandler::closeSocket(mSender);
+        //let the resource's ECET discard the external events sent to the FB before deleting it
+        CEventChainExecutionThread *ecet = CFBTestDataGlobalFixture::getResource().getResourceEventExecution();
+        do {
+          CThread::sleepThread(10);
+        } while(ecet->isProcessingEvents());
+        CTypeLib::deleteFB(mFB);
+      }
+
+      void sendMessages(unsigned int paFirst, unsigned int paNumMessages) {
+        for(unsigned int i = paFirst; i < paFirst + paNumMessages; ++i) {
+          std::string message = std::to_string(i);
+          BOOST_REQUIRE(0 < CIPComSocketHandler::sendDataOnUDP(mSender, &mDestAddr, &message[0],
+              static_cast<unsigned int>(message.size())));
+        }
+      }
+
+      //! wait until the network thread has handled paNumMessages messages
+      SIPRecvQueueStatistics waitForMessages(unsigned int paNumMessages) {
+        uint_fast64_t deadline = getNanoSecondsMonotonic() + 2000000000ULL;
+        SIPRecvQueueStatistics statistics = mLayer.getRecvQueueStatistics();
+        while((statistics.mQueuedMessages + statistics.mDroppedMessages + statistics.mClosedConnections < paNumMessages)
+            && (getNanoSecondsMonotonic() < deadline)) {
+          CThread::sleepThread(1);
+          statistics = mLayer.getRecvQueueStatistics();
+        }
+        return statistics;
+      }
+
+      /*!\brief Hand on the queued messages as the FB does, one with each interrupt
+       *
+       * \return the response of the last interrupt, which reports the state of the connection
+       */
+      EComResponse processQueue() {
+        EComResponse response;
+        do {
+          const size_t numReceived = mTopLayer.mReceived.size();
+          const bool messageQueued = (0 < mLayer.getRecvQueueStatistics().mQueuedMessages);
+          response = mLayer.processInterrupt();
+          BOOST_CHECK_EQUAL(numReceived + (messageQueued ? 1 : 0), mTopLayer.mReceived.size());
+        } while(0 < mLayer.getRecvQueueStatistics().mQueuedMessages);
+        return response;
+      }
+
+      std::vector<std::string> expectedMessages(unsigned int paFirst, unsigned int paNumMessages) const {
+        std::vector<std::string> messages;
+        for(unsigned int i = paFirst; i < paFirst + paNumMessages; ++i) {
+          messages.push_back(std::to_string(i));
+        }
+        return messages;
+      }
+
+      CFunctionBlock *mFB;
+      CRecordingLayerMock mTopLayer;
+      CIPComLayer mLayer;
+      CIPComSocketHandler::TSocketDescriptor mSender;
+      CIPComSocketHandler::TUDPDestAddr mDestAddr;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(IPComLayerRecvQueue)
+
+  BOOST_AUTO_TEST_CASE(DropOldestKeepsNewestMessages) {
+    CIPSubscriberFixture fixture("DropOldest");
+    fixture.sendMessages(0, cgIPLayerRecvQueueSize + 4);
+    SIPRecvQueueStatistics statistics = fixture.waitForMessages(cgIPLayerRecvQueueSize + 4);
+    BOOST_CHECK_EQUAL(cgIPLayerRecvQueueSize, statistics.mQueuedMessages);
+    BOOST_CHECK_EQUAL(cgIPLayerRecvQueueSize, statistics.mHighWaterMark);
+    BOOST_CHECK_EQUAL(4, statistics.mDroppedMessages);
+
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, fixture.processQueue());
+    std::vector<std::string> expected = fixture.expectedMessages(4, cgIPLayerRecvQueueSize);
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), fixture.mTopLayer.mReceived.begin(),
+        fixture.mTopLayer.mReceived.end());
+    BOOST_CHECK_EQUAL(0, fixture.mLayer.getRecvQueueStatistics().mQueuedMessages);
+  }
+
+  BOOST_AUTO_TEST_CASE(DropNewestKeepsOldestMessages) {
+    CIPSubscriberFixture fixture("DropNewest");
+    fixture.sendMessages(0, cgIPLayerRecvQueueSize + 4);
+    SIPRecvQueueStatistics statistics = fixture.waitForMessages(cgIPLayerRecvQueueSize + 4);
+    BOOST_CHECK_EQUAL(cgIPLayerRecvQueueSize, statistics.mQueuedMessages);
+    BOOST_CHECK_EQUAL(4, statistics.mDroppedMessages);
+
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, fixture.processQueue());
+    std::vector<std::string> expected = fixture.expectedMessages(0, cgIPLayerRecvQueueSize);
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), fixture.mTopLayer.mReceived.begin(),
+        fixture.mTopLayer.mReceived.end());
+
+    //the queue takes new messages again once it has been processed
+    fixture.sendMessages(100, 1);
+    BOOST_CHECK_EQUAL(1, fixture.waitForMessages(5).mQueuedMessages);
+  }
+
+  BOOST_AUTO_TEST_CASE(CloseConnectionReportsTermination) {
+    CIPSubscriberFixture fixture("CloseConnection");
+    fixture.sendMessages(0, cgIPLayerRecvQueueSize + 1);
+    SIPRecvQueueStatistics statistics = fixture.waitForMessages(cgIPLayerRecvQueueSize + 1);
+    BOOST_CHECK_EQUAL(1, statistics.mClosedConnections);
+    BOOST_CHECK_EQUAL(0, statistics.mDroppedMessages);
+
+    //the messages received before are still delivered
+    BOOST_CHECK_EQUAL(e_InitTerminated, fixture.processQueue());
+    BOOST_CHECK_EQUAL(cgIPLayerRecvQueueSize, fixture.mTopLayer.mReceived.size());
+  }
+
+  BOOST_AUTO_TEST_CASE(TerminationIsNotMaskedByDataErrors) {
+    CIPSubscriberFixture fixture("CloseConnection");
+    fixture.mTopLayer.mResponse = e_ProcessDataRecvFaild;
+    fixture.sendMessages(0, cgIPLayerRecvQueueSize + 1);
+    BOOST_CHECK_EQUAL(1, fixture.waitForMessages(cgIPLayerRecvQueueSize + 1).mClosedConnections);
+
+    BOOST_CHECK_EQUAL(e_InitTerminated, fixture.processQueue());
+  }
+
+  BOOST_AUTO_TEST_CASE(PolicyIsTakenFromTheID) {
+    CIPSubscriberFixture fixture("DropNewest");
+    BOOST_CHECK(EIPRecvQueuePolicy::DropNewest == fixture.mLayer.getRecvQueuePolicy());
+    fixture.sendMessages(0, 2);
+    fixture.waitForMessages(2);
+    CIEC_STRING statistics;
+    fixture.mLayer.queryStatistics(statistics, "Sub");
+    BOOST_CHECK(std::string::npos != statistics.getStorage().find("<IPRecvQueue FB=\"Sub\" Policy=\"DropNewest\""));
+    BOOST_CHECK(std::string::npos != statistics.getStorage().find("QueuedMessages=\"2\""));
+  }
+
+  BOOST_AUTO_TEST_CASE(UnknownPolicyIsRejected) {
+    CRecordingLayerMock topLayer;
+    CIPComLayer layer(&topLayer, nullptr);
+    char params[] = "127.0.0.1:51480;DropAll";
+    BOOST_CHECK_EQUAL(e_InitInvalidId, static_cast<CComLayer&>(layer).openConnection(params));
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
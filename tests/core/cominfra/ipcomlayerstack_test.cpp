@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "../../../src/core/cominfra/ipcomlayer.h"
+#include "../../../src/core/cominfra/framecomlayer.h"
+#include "../../../src/core/cominfra/basecommfb.h"
+#include "../fbtests/fbtesterglobalfixture.h"
+#include "typelib.h"
+#include "resource.h"
+#include "ecet.h"
+#include "forte_architecture_time.h"
+
+#include <string>
+#include <vector>
+
+using namespace forte::com_infra;
+
+namespace {
+  const unsigned short scmTestPort = 51481;
+
+  //! top layer recording the frames handed on by the frame layer
+  class CRecordingLayerMock : public CComLayer {
+    public:
+      CRecordingLayerMock() :
+          CComLayer(nullptr, nullptr) {
+      }
+
+      ~CRecordingLayerMock() override {
+        //the layers below are members of the test fixture and must not be deleted by their top layer
+        mBottomLayer = nullptr;
+      }
+
+      EComResponse sendData(void *, unsigned int) override {
+        return e_ProcessDataOk;
+      }
+
+      EComResponse recvData(const void *paData, unsigned int paSize) override {
+        mReceived.emplace_back(static_cast<const char*>(paData), paSize);
+        return e_ProcessDataOk;
+      }
+
+      EComResponse openConnection(char *) override {
+        return e_InitOk;
+      }
+
+      void closeConnection() override {
+      }
+
+      std::vector<std::string> mReceived;
+  };
+
+  /*!\brief Frame layer on the subscriber ip layer of a SUBSCRIBE_1 FB which is never started
+   *
+   * The FB ignores the external events of the layers, so the test processes the interrupts as the FB would do.
+   */
+  class CFramedIPSubscriberFixture {
+    public:
+      CFramedIPSubscriberFixture() :
+          mFB(CTypeLib::createFB(CStringDictionary::getInstance().insert("IPFrameStackTest"),
+              CStringDictionary::getInstance().insert("SUBSCRIBE_1"), CFBTestDataGlobalFixture::getResource())),
+          mFrameLayer(&mTopLayer, static_cast<CBaseCommFB*>(mFB)),
+          mIPLayer(&mFrameLayer, static_cast<CBaseCommFB*>(mFB)) {
+        BOOST_REQUIRE(nullptr != mFB);
+        char frameParams[] = "";
+        BOOST_REQUIRE_EQUAL(e_InitOk, static_cast<CComLayer&>(mFrameLayer).openConnection(frameParams));
+        char ipParams[] = "127.0.0.1:51481";
+        BOOST_REQUIRE_EQUAL(e_InitOk, static_cast<CComLayer&>(mIPLayer).openConnection(ipParams));
+        char address[] = "127.0.0.1";
+        mSender = CIPComSocketHandler::openUDPSendPort(address, scmTestPort, &mDestAddr);
+        BOOST_REQUIRE(CIPComSocketHandler::scmInvalidSocketDescriptor != mSender);
+      }
+
+      ~CFramedIPSubscriberFixture() {
+        static_cast<CComLayer&>(mIPLayer).closeConnection();
+        mFrameLayer.setBottomLayer(nullptr);
+        CIPComSocketHandler::closeSocket(mSender);
+        //let the resource's ECET discard the external events sent to the FB before deleting it
+        CEventChainExecutionThread *ecet = CFBTestDataGlobalFixture::getResource().getResourceEventExecution();
+        do {
+          CThread::sleepThread(10);
+        } while(ecet->isProcessingEvents());
+        CTypeLib::deleteFB(mFB);
+      }
+
+      //! send each frame with a one byte length prefix in a datagram of its own
+      void sendFrames(const std::vector<std::string> &paFrames) {
+        for(const std::string &frame : paFrames) {
+          std::string datagram = static_cast<char>(frame.size()) + frame;
+          BOOST_REQUIRE(0 < CIPComSocketHandler::sendDataOnUDP(mSender, &mDestAddr, &datagram[0],
+              static_cast<unsigned int>(datagram.size())));
+        }
+      }
+
+      void waitForMessages(unsigned int paNumMessages) {
+        uint_fast64_t deadline = getNanoSecondsMonotonic() + 2000000000ULL;
+        while((mIPLayer.getRecvQueueStatistics().mQueuedMessages < paNumMessages) && (getNanoSecondsMonotonic() < deadline)) {
+          CThread::sleepThread(1);
+        }
+        BOOST_REQUIRE_EQUAL(paNumMessages, mIPLayer.getRecvQueueStatistics().mQueuedMessages);
+      }
+
+      CFunctionBlock *mFB;
+      CRecordingLayerMock mTopLayer;
+      CFrameComLayer mFrameLayer;
+      CIPComLayer mIPLayer;
+      CIPComSocketHandler::TSocketDescriptor mSender;
+      CIPComSocketHandler::TUDPDestAddr mDestAddr;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(IPComLayerStack)
+
+  BOOST_AUTO_TEST_CASE(EachQueuedFrameGetsItsOwnInterrupt) {
+    CFramedIPSubscriberFixture fixture;
+    const std::vector<std::string> frames = {"a", "bb", "ccc"};
+    fixture.sendFrames(frames);
+    fixture.waitForMessages(3);
+
+    //handing on several messages in one interrupt would overwrite the RDs of the FB before the IND is sent
+    for(size_t i = 0; i < frames.size(); ++i) {
+      BOOST_CHECK_EQUAL(e_ProcessDataOk, fixture.mIPLayer.processInterrupt());
+      BOOST_CHECK_EQUAL(i + 1, fixture.mTopLayer.mReceived.size());
+    }
+    BOOST_CHECK_EQUAL_COLLECTIONS(frames.begin(), frames.end(), fixture.mTopLayer.mReceived.begin(),
+        fixture.mTopLayer.mReceived.end());
+    BOOST_CHECK_EQUAL(0, fixture.mIPLayer.getRecvQueueStatistics().mQueuedMessages);
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
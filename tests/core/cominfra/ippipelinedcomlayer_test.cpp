@@ -0,0 +1,231 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "../../../src/core/cominfra/ippipelinedcomlayer.h"
+#include "../../../src/core/cominfra/basecommfb.h"
+#include "../fbtests/fbtesterglobalfixture.h"
+#include "typelib.h"
+#include "resource.h"
+#include "ecet.h"
+#include "forte_architecture_time.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace forte::com_infra;
+
+namespace {
+  //! upper layer recording the messages handed on by the pipelined layer
+  class CRecordingLayerMock : public CComLayer {
+    public:
+      CRecordingLayerMock() :
+          CComLayer(nullptr, nullptr), mResponse(e_ProcessDataOk) {
+      }
+
+      ~CRecordingLayerMock() override {
+        //the pipelined layer is a member of the test fixture and must not be deleted by its top layer
+        mBottomLayer = nullptr;
+      }
+
+      EComResponse sendData(void *, unsigned int) override {
+        return e_ProcessDataOk;
+      }
+
+      EComResponse recvData(const void *paData, unsigned int paSize) override {
+        mReceived.emplace_back(static_cast<const char*>(paData), paSize);
+        return mResponse;
+      }
+
+      EComResponse openConnection(char *) override {
+        return e_InitOk;
+      }
+
+      void closeConnection() override {
+      }
+
+      std::vector<std::string> mReceived;
+      EComResponse mResponse; //!< response returned for each received message
+  };
+
+  /*!\brief Pipelined layer of a CLIENT_1_1 or SERVER_1_1 FB which is never started
+   *
+   * The FB ignores the external events of the layer, so the test hands the frames on by calling processInterrupt.
+   */
+  class CIPPipelinedFixture {
+    public:
+      explicit CIPPipelinedFixture(const char *paFBType) :
+          mFB(CTypeLib::createFB(CStringDictionary::getInstance().insert("IPPipelinedTest"),
+              CStringDictionary::getInstance().insert(paFBType), CFBTestDataGlobalFixture::getResource())),
+          mLayer(&mTopLayer, static_cast<CBaseCommFB*>(mFB)) {
+        BOOST_REQUIRE(nullptr != mFB);
+        //the select based socket handler releases the listening socket of the previous test only when its select returns
+        uint_fast64_t deadline = getNanoSecondsMonotonic() + 2000000000ULL;
+        EComResponse response;
+        for(;;) {
+          char params[] = "127.0.0.1:51481";
+          response = static_cast<CComLayer&>(mLayer).openConnection(params);
+          if((e_InitOk == response) || (getNanoSecondsMonotonic() > deadline)) {
+            break;
+          }
+          CThread::sleepThread(10);
+        }
+        BOOST_REQUIRE_EQUAL(e_InitOk, response);
+      }
+
+      ~CIPPipelinedFixture() {
+        static_cast<CComLayer&>(mLayer).closeConnection();
+        //let the resource's ECET discard the external events sent to the FB before deleting it
+        CEventChainExecutionThread *ecet = CFBTestDataGlobalFixture::getResource().getResourceEventExecution();
+        do {
+          CThread::sleepThread(10);
+        } while(ecet->isProcessingEvents());
+        CTypeLib::deleteFB(mFB);
+      }
+
+      EComResponse send(const std::string &paMessage) {
+        return mLayer.sendData(const_cast<char*>(paMessage.data()), static_cast<unsigned int>(paMessage.size()));
+      }
+
+      //! hand on the received frames until paNumMessages have reached the top layer
+      bool receive(size_t paNumMessages) {
+        uint_fast64_t deadline = getNanoSecondsMonotonic() + 2000000000ULL;
+        while(mTopLayer.mReceived.size() < paNumMessages) {
+          size_t numReceived = mTopLayer.mReceived.size();
+          mLayer.processInterrupt();
+          if(numReceived == mTopLayer.mReceived.size()) {
+            if(getNanoSecondsMonotonic() > deadline) {
+              return false;
+            }
+            CThread::sleepThread(1);
+          }
+        }
+        return true;
+      }
+
+      //! wait until the server has accepted paNumConnections clients
+      bool waitForConnections(unsigned int paNumConnections) {
+        uint_fast64_t deadline = getNanoSecondsMonotonic() + 2000000000ULL;
+        while(mLayer.getNumConnections() < paNumConnections) {
+          if(getNanoSecondsMonotonic() > deadline) {
+            return false;
+          }
+          CThread::sleepThread(1);
+        }
+        return true;
+      }
+
+      CFunctionBlock *mFB;
+      CRecordingLayerMock mTopLayer;
+      CIPPipelinedComLayer mLayer;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(IPPipelinedComLayer)
+
+  BOOST_AUTO_TEST_CASE(ClientKeepsAWindowOfRequestsInFlight) {
+    CIPPipelinedFixture server("SERVER_1_1");
+    CIPPipelinedFixture client("CLIENT_1_1");
+    BOOST_REQUIRE(server.waitForConnections(1));
+
+    std::vector<std::string> requests;
+    for(unsigned int i = 0; i < cgIPPipelineWindowSize; ++i) {
+      requests.push_back("request " + std::to_string(i));
+      BOOST_CHECK_EQUAL(e_ProcessDataOk, client.send(requests.back()));
+    }
+    BOOST_CHECK_EQUAL(cgIPPipelineWindowSize, client.mLayer.getNumOutstandingRequests());
+    BOOST_CHECK_EQUAL(e_ProcessDataSendFailed, client.send("beyond the window"));
+
+    BOOST_REQUIRE(server.receive(requests.size()));
+    BOOST_CHECK_EQUAL_COLLECTIONS(requests.begin(), requests.end(), server.mTopLayer.mReceived.begin(),
+        server.mTopLayer.mReceived.end());
+
+    std::vector<std::string> responses;
+    for(const std::string &request : requests) {
+      responses.push_back("response to " + request);
+      BOOST_CHECK_EQUAL(e_ProcessDataOk, server.send(responses.back()));
+    }
+    //an RSP without a pending IND has no connection to go to
+    BOOST_CHECK_EQUAL(e_ProcessDataSendFailed, server.send("unrequested"));
+
+    BOOST_REQUIRE(client.receive(responses.size()));
+    BOOST_CHECK_EQUAL_COLLECTIONS(responses.begin(), responses.end(), client.mTopLayer.mReceived.begin(),
+        client.mTopLayer.mReceived.end());
+    BOOST_CHECK_EQUAL(0, client.mLayer.getNumOutstandingRequests());
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, client.send("after the window"));
+  }
+
+  BOOST_AUTO_TEST_CASE(ServerRoutesResponsesToTheirClients) {
+    CIPPipelinedFixture server("SERVER_1_1");
+    CIPPipelinedFixture firstClient("CLIENT_1_1");
+    CIPPipelinedFixture secondClient("CLIENT_1_1");
+    BOOST_REQUIRE(server.waitForConnections(2));
+
+    //together more requests than the server's receive queue holds
+    for(unsigned int i = 0; i < cgIPPipelineWindowSize; ++i) {
+      BOOST_CHECK_EQUAL(e_ProcessDataOk, firstClient.send("first " + std::to_string(i)));
+      BOOST_CHECK_EQUAL(e_ProcessDataOk, secondClient.send("second " + std::to_string(i)));
+    }
+
+    BOOST_REQUIRE(server.receive(2 * cgIPPipelineWindowSize));
+    for(const std::string &request : server.mTopLayer.mReceived) {
+      BOOST_CHECK_EQUAL(e_ProcessDataOk, server.send("response to " + request));
+    }
+
+    BOOST_REQUIRE(firstClient.receive(cgIPPipelineWindowSize));
+    BOOST_REQUIRE(secondClient.receive(cgIPPipelineWindowSize));
+    for(unsigned int i = 0; i < cgIPPipelineWindowSize; ++i) {
+      BOOST_CHECK_EQUAL("response to first " + std::to_string(i), firstClient.mTopLayer.mReceived[i]);
+      BOOST_CHECK_EQUAL("response to second " + std::to_string(i), secondClient.mTopLayer.mReceived[i]);
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(ServerKeepsNoRouteForRejectedRequests) {
+    CIPPipelinedFixture server("SERVER_1_1");
+    CIPPipelinedFixture client("CLIENT_1_1");
+    BOOST_REQUIRE(server.waitForConnections(1));
+
+    //a request which can not be deserialized results in an IND- and is never answered
+    server.mTopLayer.mResponse = e_ProcessDataDataTypeError;
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, client.send("rejected"));
+    BOOST_REQUIRE(server.receive(1));
+    server.mTopLayer.mResponse = e_ProcessDataOk;
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, client.send("accepted"));
+    BOOST_REQUIRE(server.receive(2));
+
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, server.send("response to accepted"));
+    BOOST_CHECK_EQUAL(e_ProcessDataSendFailed, server.send("response to rejected"));
+    BOOST_REQUIRE(client.receive(1));
+    BOOST_CHECK_EQUAL("response to accepted", client.mTopLayer.mReceived[0]);
+    BOOST_CHECK_EQUAL(1, client.mLayer.getNumOutstandingRequests());
+  }
+
+  BOOST_AUTO_TEST_CASE(ServerRejectsClientsBeyondItsConnections) {
+    CIPPipelinedFixture server("SERVER_1_1");
+    std::vector<std::unique_ptr<CIPPipelinedFixture>> clients;
+    for(unsigned int i = 0; i <= cgIPPipelineMaxConnections; ++i) {
+      clients.emplace_back(new CIPPipelinedFixture("CLIENT_1_1"));
+    }
+    BOOST_REQUIRE(server.waitForConnections(cgIPPipelineMaxConnections));
+
+    //the rejected client learns about the closed connection
+    CIPPipelinedFixture &rejected = *clients.back();
+    uint_fast64_t deadline = getNanoSecondsMonotonic() + 2000000000ULL;
+    EComResponse resp = e_Nothing;
+    while((e_InitTerminated != resp) && (getNanoSecondsMonotonic() < deadline)) {
+      CThread::sleepThread(1);
+      resp = rejected.mLayer.processInterrupt();
+    }
+    BOOST_CHECK_EQUAL(e_InitTerminated, resp);
+    BOOST_CHECK_EQUAL(cgIPPipelineMaxConnections, server.mLayer.getNumConnections());
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
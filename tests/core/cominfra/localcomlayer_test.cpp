@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "../../../src/core/cominfra/localcomlayer.h"
+#include "../../../src/core/cominfra/basecommfb.h"
+#include "../../../src/core/datatypes/forte_dint.h"
+#include "../../../src/core/utils/criticalregion.h"
+#include "../fbtests/fbtesterglobalfixture.h"
+#include "typelib.h"
+#include "resource.h"
+#include "ecet.h"
+#include "forte_architecture_time.h"
+
+#include <memory>
+#include <string>
+
+using namespace forte::com_infra;
+
+namespace {
+  /*!\brief Communication FB with a local layer as only layer
+   *
+   * FBs which are not started ignore the external events of the layer, so tests can call processInterrupt themselves.
+   */
+  class CLocalComFBFixture {
+    public:
+      CLocalComFBFixture(const char *paFBType, const char *paGroup, bool paStart = false) :
+          mFB(CTypeLib::createFB(CStringDictionary::getInstance().insert("LocalComLayerTest"),
+              CStringDictionary::getInstance().insert(paFBType), CFBTestDataGlobalFixture::getResource())),
+          mGroup(paGroup), mStarted(paStart) {
+        BOOST_REQUIRE(nullptr != mFB);
+        mLayer.reset(new CLocalComLayer(nullptr, static_cast<CBaseCommFB*>(mFB)));
+        getDataPin().setValue(CIEC_DINT(0));
+        std::string params(mGroup);
+        BOOST_REQUIRE_EQUAL(e_InitOk, static_cast<CComLayer&>(*mLayer).openConnection(&params[0]));
+        if(mStarted) {
+          BOOST_REQUIRE(EMGMResponse::Ready == mFB->changeFBExecutionState(EMGMCommandType::Start));
+        }
+      }
+
+      ~CLocalComFBFixture() {
+        if(mStarted) {
+          mFB->changeFBExecutionState(EMGMCommandType::Stop);
+        }
+        mLayer.reset();
+        //let the resource's ECET discard the external events sent to the FB before deleting it
+        CEventChainExecutionThread *ecet = CFBTestDataGlobalFixture::getResource().getResourceEventExecution();
+        do {
+          CThread::sleepThread(10);
+        } while(ecet->isProcessingEvents());
+        CTypeLib::deleteFB(mFB);
+      }
+
+      CBaseCommFB &getCommFB() {
+        return *static_cast<CBaseCommFB*>(mFB);
+      }
+
+      CIEC_ANY &getDataPin() {
+        return (e_Publisher == getCommFB().getComServiceType()) ? *getCommFB().getSDs()[0] : *getCommFB().getRDs()[0];
+      }
+
+      TForteInt32 getValue() {
+        CCriticalRegion criticalRegion(getCommFB().getFBLock());
+        return static_cast<CIEC_DINT::TValueType>(static_cast<const CIEC_DINT &>(getDataPin().unwrap()));
+      }
+
+      EComResponse publish(TForteInt32 paValue) {
+        getDataPin().setValue(CIEC_DINT(paValue));
+        return mLayer->sendData(nullptr, 0);
+      }
+
+      EComResponse processInterrupt() {
+        return mLayer->processInterrupt();
+      }
+
+      //! wait until the RD of the subscriber holds the given value
+      bool waitForValue(TForteInt32 paValue) {
+        uint_fast64_t deadline = getNanoSecondsMonotonic() + 2000000000ULL;
+        while(getValue() != paValue) {
+          if(getNanoSecondsMonotonic() > deadline) {
+            return false;
+          }
+          CThread::sleepThread(0);
+        }
+        return true;
+      }
+
+    private:
+      CFunctionBlock *mFB;
+      std::string mGroup;
+      bool mStarted;
+      std::unique_ptr<CLocalComLayer> mLayer;
+  };
+
+  //! layer whose interrupts deliver nothing
+  class CIdleLayerMock : public CComLayer {
+    public:
+      CIdleLayerMock() :
+          CComLayer(nullptr, nullptr) {
+      }
+
+      EComResponse sendData(void *, unsigned int) override {
+        return e_ProcessDataOk;
+      }
+
+      EComResponse recvData(const void *, unsigned int) override {
+        return e_Nothing;
+      }
+
+      EComResponse processInterrupt() override {
+        return e_Nothing;
+      }
+
+      EComResponse openConnection(char *) override {
+        return e_InitOk;
+      }
+
+      void closeConnection() override {
+      }
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(LocalComLayer)
+
+  BOOST_AUTO_TEST_CASE(PublishedValueReachesAllSubscribers) {
+    CLocalComFBFixture publisher("PUBLISH_1", "local_test_values");
+    CLocalComFBFixture firstSubscriber("SUBSCRIBE_1", "local_test_values");
+    CLocalComFBFixture secondSubscriber("SUBSCRIBE_1", "local_test_values");
+
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, publisher.publish(42));
+    for(CLocalComFBFixture *subscriber : {&firstSubscriber, &secondSubscriber}) {
+      BOOST_CHECK_EQUAL(e_ProcessDataOk, subscriber->processInterrupt());
+      BOOST_CHECK_EQUAL(42, subscriber->getValue());
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(SubscribersReadTheLatestPublication) {
+    CLocalComFBFixture publisher("PUBLISH_1", "local_test_latest");
+    CLocalComFBFixture subscriber("SUBSCRIBE_1", "local_test_latest");
+
+    for(TForteInt32 i = 1; i <= 3; ++i) {
+      BOOST_CHECK_EQUAL(e_ProcessDataOk, publisher.publish(i));
+    }
+    //the RDs are only written when the subscriber processes its interrupt
+    BOOST_CHECK_EQUAL(0, subscriber.getValue());
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, subscriber.processInterrupt());
+    BOOST_CHECK_EQUAL(3, subscriber.getValue());
+
+    //once processed the subscriber is interrupted again by the next publication
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, publisher.publish(4));
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, subscriber.processInterrupt());
+    BOOST_CHECK_EQUAL(4, subscriber.getValue());
+  }
+
+  BOOST_AUTO_TEST_CASE(DroppedInterruptIsQueuedAgain) {
+    CLocalComFBFixture publisher("PUBLISH_1", "local_test_dropped");
+    CLocalComFBFixture subscriber("SUBSCRIBE_1", "local_test_dropped", true);
+
+    //fill the subscriber's interrupt queue with a layer having nothing to deliver
+    CIdleLayerMock idleLayer;
+    while(subscriber.getCommFB().interruptCommFB(&idleLayer)) {
+    }
+    subscriber.getCommFB().resetInterruptStatistics();
+
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, publisher.publish(7));
+    BOOST_CHECK_EQUAL(1, subscriber.getCommFB().getInterruptStatistics().mDroppedInterrupts);
+
+    //once the subscriber has drained its queue the next publication queues the pending interrupt again
+    CEventChainExecutionThread *ecet = CFBTestDataGlobalFixture::getResource().getResourceEventExecution();
+    do {
+      CThread::sleepThread(10);
+    } while(ecet->isProcessingEvents());
+    BOOST_CHECK_EQUAL(0, subscriber.getValue());
+    BOOST_CHECK_EQUAL(e_ProcessDataOk, publisher.publish(8));
+    BOOST_CHECK(subscriber.waitForValue(8));
+    BOOST_CHECK_EQUAL(1, subscriber.getCommFB().getInterruptStatistics().mDroppedInterrupts);
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
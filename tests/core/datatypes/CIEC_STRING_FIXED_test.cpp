@@ -14,6 +14,7 @@
 #include "forte_boost_output_support.h"
 
 #include "../../../src/core/datatypes/forte_string_fixed.h"
+#include "../../../src/core/dataconn.h"
 
 using namespace std::string_literals;
 
@@ -185,4 +186,96 @@ BOOST_AUTO_TEST_CASE(assign_operator_fixed9_to_fixed5) {
 }
 
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_CASE(buffer_is_kept_on_assignments) {
+  CIEC_STRING_FIXED<32> fixed32;
+  //the first value longer than the inline buffer reserves the buffer
+  fixed32 = "state tag of 27 characters!"_STRING;
+  const char *buffer = fixed32.c_str();
+  fixed32 = CIEC_STRING("a much longer state tag exceeding 32 characters"s);
+  BOOST_TEST(buffer == fixed32.c_str());
+  BOOST_TEST(fixed32 == "a much longer state tag exceedin"_STRING);
+  CIEC_STRING_FIXED<32> other("another state tag value"_STRING);
+  fixed32 = std::move(other);
+  BOOST_TEST(buffer == fixed32.c_str());
+  BOOST_TEST(fixed32 == "another state tag value"_STRING);
+}
+
+BOOST_AUTO_TEST_CASE(setValue_truncates) {
+  CIEC_STRING_FIXED<5> fixed5;
+  const CIEC_STRING longString("123456789"_STRING);
+  static_cast<CIEC_ANY &>(fixed5).setValue(longString);
+  BOOST_TEST(fixed5 == "12345"_STRING);
+  static_cast<CIEC_ANY &>(fixed5).setValue('a'_CHAR);
+  BOOST_TEST(fixed5 == "a"_STRING);
+}
+
+BOOST_AUTO_TEST_CASE(clone_keeps_maximum_length) {
+  CIEC_STRING_FIXED<5> fixed5("123"_STRING);
+  CIEC_ANY *clone = fixed5.clone(nullptr);
+  BOOST_TEST(5 == static_cast<CIEC_STRING *>(clone)->getMaximumLength());
+  clone->setValue("123456789"_STRING);
+  BOOST_TEST(*static_cast<CIEC_STRING *>(clone) == "12345"_STRING);
+  delete clone;
+}
+
+BOOST_AUTO_TEST_CASE(short_values_do_not_allocate) {
+  const size_t inlineCapacity = std::string().capacity();
+  CIEC_STRING_FIXED<255> fixed255;
+  BOOST_TEST(fixed255.getStorage().capacity() == inlineCapacity);
+  fixed255 = "short"_STRING;
+  BOOST_TEST(fixed255.getStorage().capacity() == inlineCapacity);
+  CIEC_STRING_FIXED<255> copy(fixed255);
+  BOOST_TEST(copy.getStorage().capacity() == inlineCapacity);
+}
+
+BOOST_AUTO_TEST_CASE(first_long_value_reserves_the_initial_capacity) {
+  CIEC_STRING_FIXED<255> fixed255;
+  fixed255 = "a state tag of 26 chars..."_STRING;
+  BOOST_TEST(fixed255.getStorage().capacity() >= CIEC_STRING_FIXED<255>::scmInitialCapacity);
+  const char *buffer = fixed255.c_str();
+  fixed255 = "another state tag of 40 characters......"_STRING;
+  BOOST_TEST(buffer == fixed255.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(moved_from_value_gets_a_new_buffer_when_assigned) {
+  CIEC_STRING_FIXED<32> source("a state tag of 26 chars..."_STRING);
+  CIEC_STRING_FIXED<32> target(std::move(source));
+  BOOST_TEST(target == "a state tag of 26 chars..."_STRING);
+  source = "another state tag of 30 chars."_STRING;
+  const char *buffer = source.c_str();
+  source = "a state tag of 26 chars..."_STRING;
+  BOOST_TEST(buffer == source.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(long_values_grow_the_buffer_which_is_kept) {
+  CIEC_STRING_FIXED<200> fixed200;
+  BOOST_TEST(fixed200.getStorage().capacity() < 200);
+  fixed200 = CIEC_STRING(std::string(180, 'x'));
+  const char *buffer = fixed200.c_str();
+  fixed200 = "short"_STRING;
+  BOOST_TEST(buffer == fixed200.c_str());
+  fixed200 = CIEC_STRING(std::string(150, 'y'));
+  BOOST_TEST(buffer == fixed200.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(connection_transfers_keep_the_buffers) {
+  CIEC_STRING_FIXED<32> output;
+  CIEC_STRING_FIXED<32> connectionValue;
+  CIEC_STRING_FIXED<32> input;
+  CDataConnection connection(nullptr, 0, &connectionValue);
+  output = "state tag of 27 characters!"_STRING;
+  connection.writeData(output);
+  connection.readData(input);
+  BOOST_TEST(input == "state tag of 27 characters!"_STRING);
+  //the first transfer of a long value reserves the buffers, later ones copy into them
+  const char *connectionBuffer = connectionValue.c_str();
+  const char *inputBuffer = input.c_str();
+  output = "next state tag, 24 chars"_STRING;
+  connection.writeData(output);
+  connection.readData(input);
+  BOOST_TEST(input == "next state tag, 24 chars"_STRING);
+  BOOST_TEST(connectionBuffer == connectionValue.c_str());
+  BOOST_TEST(inputBuffer == input.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+
+#include <boost/test/unit_test.hpp>
+
+#include "ecetpool.h"
+#include "funcbloc.h"
+#include "fbcontainermock.h"
+#include "forte_architecture_time.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace {
+  const SFBInterfaceSpec gChainLinkInterfaceSpec = {
+    1, nullptr, nullptr, nullptr,
+    0, nullptr, nullptr, nullptr,
+    0, nullptr, nullptr,
+    0, nullptr, nullptr,
+    0, nullptr,
+    0, nullptr
+  };
+
+  //! FB re-triggering itself a given number of times, simulating an event chain doing some work in every step
+  class CChainLinkFBMock : public CFunctionBlock {
+    public:
+      CChainLinkFBMock(unsigned int paChainLength, std::atomic<unsigned int> &paTotalExecutions) :
+          CFunctionBlock(CFBContainerMock::smDefaultFBContMock, &gChainLinkInterfaceSpec, 0),
+          mChainLength(paChainLength), mExecutions(0), mActive(0), mConcurrentExecution(false),
+          mTotalExecutions(paTotalExecutions), mWork(0) {
+      }
+
+      bool initialize() override {
+        if(!CFunctionBlock::initialize()) {
+          return false;
+        }
+        changeFBExecutionState(EMGMCommandType::Reset);
+        changeFBExecutionState(EMGMCommandType::Start);
+        return true;
+      }
+
+      CStringDictionary::TStringId getFBTypeId() const override {
+        return CStringDictionary::scmInvalidStringId;
+      }
+
+      unsigned int getExecutions() const {
+        return mExecutions;
+      }
+
+      bool hadConcurrentExecution() const {
+        return mConcurrentExecution;
+      }
+
+    private:
+      void executeEvent(TEventID, CEventChainExecutionThread * const paECET) override {
+        if(0 != mActive.fetch_add(1)) {
+          mConcurrentExecution = true;
+        }
+        for(unsigned int i = 0; i < 2000; ++i) {
+          mWork = mWork * 31 + i;
+        }
+        ++mExecutions;
+        if(0 != mChainLength && 0 != (mExecutions % mChainLength)) {
+          paECET->addEventEntry(TEventEntry(this, 0));
+        }
+        mActive.fetch_sub(1);
+        mTotalExecutions.fetch_add(1);
+      }
+
+      void readInputData(TEventID) override {
+      }
+
+      void writeOutputData(TEventID) override {
+      }
+
+      unsigned int mChainLength;
+      unsigned int mExecutions; //!< intentionally not atomic, the pool guarantees exclusive execution
+      std::atomic<int> mActive;
+      std::atomic<bool> mConcurrentExecution;
+      std::atomic<unsigned int> &mTotalExecutions;
+      volatile unsigned int mWork;
+  };
+
+  bool waitForExecutions(const std::atomic<unsigned int> &paExecutions, unsigned int paExpected) {
+    uint_fast64_t deadline = getNanoSecondsMonotonic() + 20000000000ULL;
+    while(paExecutions.load() < paExpected) {
+      if(getNanoSecondsMonotonic() > deadline) {
+        return false;
+      }
+      CThread::sleepThread(1);
+    }
+    return true;
+  }
+
+  //! run paNumChains independent chains of paChainLength steps and check that every step is executed exclusively
+  void runIndependentChains(size_t paNumWorkers, unsigned int paNumChains, unsigned int paChainLength) {
+    std::atomic<unsigned int> totalExecutions(0);
+    std::vector<std::unique_ptr<CChainLinkFBMock>> fbs;
+    for(unsigned int i = 0; i < paNumChains; ++i) {
+      fbs.emplace_back(new CChainLinkFBMock(paChainLength, totalExecutions));
+      BOOST_REQUIRE(fbs.back()->initialize());
+    }
+
+    CEventChainExecutionThreadPool pool(paNumWorkers);
+    pool.changeExecutionState(EMGMCommandType::Start);
+    for(auto &fb : fbs) {
+      pool.getWorker(0)->startEventChain(TEventEntry(fb.get(), 0));
+    }
+    BOOST_CHECK(waitForExecutions(totalExecutions, paNumChains * paChainLength));
+    pool.changeExecutionState(EMGMCommandType::Stop);
+
+    for(auto &fb : fbs) {
+      BOOST_CHECK_EQUAL(paChainLength, fb->getExecutions());
+      BOOST_CHECK(!fb->hadConcurrentExecution());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(ECETPool)
+
+  BOOST_AUTO_TEST_CASE(ECETPool_AtLeastOneWorker) {
+    CEventChainExecutionThreadPool pool(0);
+    BOOST_CHECK_EQUAL(1, pool.getNumberOfWorkers());
+    BOOST_CHECK(nullptr != pool.getWorker(0));
+    BOOST_CHECK(nullptr == pool.getWorker(1));
+    BOOST_CHECK(!pool.isProcessingEvents());
+  }
+
+  BOOST_AUTO_TEST_CASE(ECETPool_SharedFBIsExecutedExclusively) {
+    const unsigned int numChains = 64;
+    std::atomic<unsigned int> totalExecutions(0);
+    CChainLinkFBMock sharedFB(0, totalExecutions);
+    BOOST_REQUIRE(sharedFB.initialize());
+
+    CEventChainExecutionThreadPool pool(4);
+    pool.changeExecutionState(EMGMCommandType::Start);
+    for(unsigned int i = 0; i < numChains; ++i) {
+      pool.getWorker(i % pool.getNumberOfWorkers())->startEventChain(TEventEntry(&sharedFB, 0));
+    }
+    BOOST_CHECK(waitForExecutions(totalExecutions, numChains));
+    pool.changeExecutionState(EMGMCommandType::Stop);
+
+    BOOST_CHECK_EQUAL(numChains, sharedFB.getExecutions());
+    BOOST_CHECK(!sharedFB.hadConcurrentExecution());
+  }
+
+  BOOST_AUTO_TEST_CASE(ECETPool_IndependentChainsRunToCompletion) {
+    for(size_t numWorkers = 1; numWorkers <= 4; numWorkers *= 2) {
+      runIndependentChains(numWorkers, 8, 100);
+    }
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
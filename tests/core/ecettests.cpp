@@ -0,0 +1,446 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+
+#include <boost/test/unit_test.hpp>
+
+#include "ecet.h"
+#include "funcbloc.h"
+#include "fbcontainermock.h"
+#include "forte_architecture_time.h"
+
+#include <atomic>
+#include <vector>
+
+namespace {
+  //! gives the tests access to the event lists of an ECET which is not started
+  class CECETTestAccess : public CEventChainExecutionThread {
+    public:
+      using CEventChainExecutionThread::popEventEntry;
+      using CEventChainExecutionThread::transferExternalEvents;
+      using CEventChainExecutionThread::flushDeferred;
+  };
+
+  //! records the order of the flushes, optionally registering a further flush from within its own flush
+  class CDeferredFlushMock : public CDeferredFlush {
+    public:
+      CDeferredFlushMock(int paId, std::vector<int> &paFlushes) :
+          mId(paId), mFlushes(paFlushes), mECET(nullptr), mFollowUp(nullptr) {
+      }
+
+      void flush() override {
+        mFlushes.push_back(mId);
+        if(nullptr != mFollowUp) {
+          mECET->deferFlush(*mFollowUp);
+        }
+      }
+
+      int mId;
+      std::vector<int> &mFlushes;
+      CEventChainExecutionThread *mECET;
+      CDeferredFlush *mFollowUp;
+  };
+
+  const SFBInterfaceSpec gLatencyTestInterfaceSpec = {
+    1, nullptr, nullptr, nullptr,
+    0, nullptr, nullptr, nullptr,
+    0, nullptr, nullptr,
+    0, nullptr, nullptr,
+    0, nullptr,
+    0, nullptr
+  };
+
+  //! FB sending a chain of events to itself and deferring a flush on the first one
+  class CFlushingFBMock : public CFunctionBlock, public CDeferredFlush {
+    public:
+      explicit CFlushingFBMock(unsigned int paNumEvents) :
+          CFunctionBlock(CFBContainerMock::smDefaultFBContMock, &gLatencyTestInterfaceSpec, 0),
+          mNumEvents(paNumEvents), mNumExecuted(0), mNumFlushes(0), mExecutedAtFlush(0) {
+      }
+
+      bool initialize() override {
+        if(!CFunctionBlock::initialize()) {
+          return false;
+        }
+        changeFBExecutionState(EMGMCommandType::Reset);
+        changeFBExecutionState(EMGMCommandType::Start);
+        return true;
+      }
+
+      CStringDictionary::TStringId getFBTypeId() const override {
+        return CStringDictionary::scmInvalidStringId;
+      }
+
+      void flush() override {
+        mExecutedAtFlush = mNumExecuted;
+        mNumFlushes.fetch_add(1);
+      }
+
+      unsigned int getNumFlushes() const {
+        return mNumFlushes.load();
+      }
+
+      unsigned int mNumEvents;
+      unsigned int mNumExecuted;
+      std::atomic<unsigned int> mNumFlushes;
+      unsigned int mExecutedAtFlush;
+
+    private:
+      void executeEvent(TEventID, CEventChainExecutionThread * const paECET) override {
+        if(0 == mNumExecuted) {
+          paECET->deferFlush(*this);
+        }
+        if(++mNumExecuted < mNumEvents) {
+          paECET->addEventEntry(TEventEntry(this, 0));
+        }
+      }
+
+      void readInputData(TEventID) override {
+      }
+
+      void writeOutputData(TEventID) override {
+      }
+  };
+
+  //! FB starting more event chains on its own ECET than its external event list can take on its first event
+  class CSelfStartingFBMock : public CFunctionBlock {
+    public:
+      explicit CSelfStartingFBMock(size_t paNumChains) :
+          CFunctionBlock(CFBContainerMock::smDefaultFBContMock, &gLatencyTestInterfaceSpec, 0),
+          mNumChains(paNumChains), mDone(false) {
+      }
+
+      bool initialize() override {
+        if(!CFunctionBlock::initialize()) {
+          return false;
+        }
+        changeFBExecutionState(EMGMCommandType::Reset);
+        changeFBExecutionState(EMGMCommandType::Start);
+        return true;
+      }
+
+      CStringDictionary::TStringId getFBTypeId() const override {
+        return CStringDictionary::scmInvalidStringId;
+      }
+
+      size_t mNumChains;
+      std::atomic<bool> mDone;
+
+    private:
+      void executeEvent(TEventID, CEventChainExecutionThread * const paECET) override {
+        if(!mDone.load()) {
+          for(size_t i = 0; i < mNumChains; ++i) {
+            paECET->startEventChain(TEventEntry(this, 0));
+          }
+          mDone.store(true);
+        }
+      }
+
+      void readInputData(TEventID) override {
+      }
+
+      void writeOutputData(TEventID) override {
+      }
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(ECET)
+
+  // the ECET threads are not started in these tests, so all events stay queued
+
+  void fillEventList(CEventChainExecutionThread &paECET, size_t paNumEvents) {
+    for(size_t i = 0; i < paNumEvents; ++i) {
+      paECET.addEventEntry(TEventEntry(nullptr, static_cast<TPortId>(i)));
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_HighWaterMarkAndDropNewest) {
+    CEventChainExecutionThread ecet;
+    SEventQueueStatistics statistics = ecet.getEventQueueStatistics();
+    BOOST_CHECK_EQUAL(0, statistics.mEventListHighWaterMark);
+
+    fillEventList(ecet, 10);
+    statistics = ecet.getEventQueueStatistics();
+    BOOST_CHECK_EQUAL(10, statistics.mEventListHighWaterMark);
+    BOOST_CHECK_EQUAL(0, statistics.mDroppedEvents);
+
+    fillEventList(ecet, statistics.mEventListSize);
+    statistics = ecet.getEventQueueStatistics();
+    BOOST_CHECK_EQUAL(statistics.mEventListSize, statistics.mEventListHighWaterMark);
+    BOOST_CHECK_EQUAL(10, statistics.mDroppedEvents);
+
+    ecet.resetEventQueueStatistics();
+    statistics = ecet.getEventQueueStatistics();
+    BOOST_CHECK_EQUAL(0, statistics.mEventListHighWaterMark);
+    BOOST_CHECK_EQUAL(0, statistics.mDroppedEvents);
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_DropOldest) {
+    CEventChainExecutionThread ecet;
+    ecet.setOverflowPolicy(EEventQueueOverflowPolicy::DropOldest);
+    size_t size = ecet.getEventQueueStatistics().mEventListSize;
+    fillEventList(ecet, size + 5);
+    SEventQueueStatistics statistics = ecet.getEventQueueStatistics();
+    BOOST_CHECK_EQUAL(5, statistics.mDroppedEvents);
+    BOOST_CHECK_EQUAL(size, statistics.mEventListHighWaterMark);
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_Coalesce) {
+    CEventChainExecutionThread ecet;
+    ecet.setOverflowPolicy(EEventQueueOverflowPolicy::Coalesce);
+    size_t size = ecet.getEventQueueStatistics().mEventListSize;
+    fillEventList(ecet, size);
+    //already queued events are merged, new ones are dropped
+    ecet.addEventEntry(TEventEntry(nullptr, 3));
+    ecet.addEventEntry(TEventEntry(nullptr, static_cast<TPortId>(size + 1)));
+    SEventQueueStatistics statistics = ecet.getEventQueueStatistics();
+    BOOST_CHECK_EQUAL(1, statistics.mCoalescedEvents);
+    BOOST_CHECK_EQUAL(1, statistics.mDroppedEvents);
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_GrowableEventList) {
+    CEventChainExecutionThread ecet;
+    size_t fixedSize = ecet.getEventQueueStatistics().mEventListSize;
+    ecet.enableEventListGrowth(2);
+    SEventQueueStatistics statistics = ecet.getEventQueueStatistics();
+    BOOST_CHECK_EQUAL(fixedSize + 2 * cgEventChainEventListSegmentSize, statistics.mEventListSize);
+
+    fillEventList(ecet, statistics.mEventListSize + 1);
+    statistics = ecet.getEventQueueStatistics();
+    BOOST_CHECK_EQUAL(statistics.mEventListSize, statistics.mEventListHighWaterMark);
+    BOOST_CHECK_EQUAL(1, statistics.mDroppedEvents);
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_ExternalEventListOverflow) {
+    CEventChainExecutionThread ecet;
+    size_t size = ecet.getEventQueueStatistics().mExternalEventListSize;
+    for(size_t i = 0; i < size + 2; ++i) {
+      ecet.startEventChain(TEventEntry(nullptr, static_cast<TPortId>(i)));
+    }
+    BOOST_CHECK_EQUAL(2, ecet.getEventQueueStatistics().mDroppedExternalEvents);
+
+    ecet.setOverflowPolicy(EEventQueueOverflowPolicy::Coalesce);
+    ecet.startEventChain(TEventEntry(nullptr, 0));
+    BOOST_CHECK_EQUAL(1, ecet.getEventQueueStatistics().mCoalescedEvents);
+
+    ecet.setOverflowPolicy(EEventQueueOverflowPolicy::BlockWithTimeout, 2000000);
+    ecet.startEventChain(TEventEntry(nullptr, 0));
+    BOOST_CHECK_EQUAL(3, ecet.getEventQueueStatistics().mDroppedExternalEvents);
+
+    ecet.setOverflowPolicy(EEventQueueOverflowPolicy::DropOldest);
+    ecet.startEventChain(TEventEntry(nullptr, 0));
+    BOOST_CHECK_EQUAL(4, ecet.getEventQueueStatistics().mDroppedExternalEvents);
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_BlockWithTimeoutDoesNotWaitForItself) {
+    CEventChainExecutionThread ecet;
+    size_t size = ecet.getEventQueueStatistics().mExternalEventListSize;
+    ecet.setOverflowPolicy(EEventQueueOverflowPolicy::BlockWithTimeout, 60000000000ULL);
+    CSelfStartingFBMock fb(size + 2);
+    BOOST_REQUIRE(fb.initialize());
+
+    ecet.changeExecutionState(EMGMCommandType::Start);
+    ecet.startEventChain(TEventEntry(&fb, 0));
+    uint_fast64_t deadline = getNanoSecondsMonotonic() + 5000000000ULL;
+    while(!fb.mDone.load() && getNanoSecondsMonotonic() < deadline) {
+      CThread::sleepThread(1);
+    }
+    //the events the ECET adds to its own full external event list are dropped right away
+    BOOST_CHECK(fb.mDone.load());
+    BOOST_CHECK_EQUAL(2, ecet.getEventQueueStatistics().mDroppedExternalEvents);
+    BOOST_CHECK(!ecet.isCurrentThread());
+
+    ecet.changeExecutionState(EMGMCommandType::Stop);
+    ecet.joinEventChainExecutionThread();
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_FanOutIsAllOrNothing) {
+    CECETTestAccess ecet;
+    size_t size = ecet.getEventQueueStatistics().mEventListSize;
+    std::vector<TEventEntry> fanOut;
+    for(size_t i = 0; i < 4; ++i) {
+      fanOut.emplace_back(nullptr, static_cast<TPortId>(1000 + i));
+    }
+    fillEventList(ecet, size - 1);
+    ecet.addEventEntries(fanOut.data(), fanOut.size());
+    SEventQueueStatistics statistics = ecet.getEventQueueStatistics();
+    BOOST_CHECK_EQUAL(4, statistics.mDroppedEvents);
+    BOOST_CHECK_EQUAL(size - 1, statistics.mEventListHighWaterMark);
+
+    //coalescing needs all destinations to be queued
+    ecet.setOverflowPolicy(EEventQueueOverflowPolicy::Coalesce);
+    const TEventEntry queuedFanOut[] = {TEventEntry(nullptr, 0), TEventEntry(nullptr, 1), TEventEntry(nullptr, 2)};
+    ecet.addEventEntries(queuedFanOut, 3);
+    BOOST_CHECK_EQUAL(3, ecet.getEventQueueStatistics().mCoalescedEvents);
+    const TEventEntry mixedFanOut[] = {TEventEntry(nullptr, 0), TEventEntry(nullptr, 1000)};
+    ecet.addEventEntries(mixedFanOut, 2);
+    BOOST_CHECK_EQUAL(3, ecet.getEventQueueStatistics().mCoalescedEvents);
+    BOOST_CHECK_EQUAL(6, ecet.getEventQueueStatistics().mDroppedEvents);
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_FanOutDropOldest) {
+    CECETTestAccess ecet;
+    ecet.setOverflowPolicy(EEventQueueOverflowPolicy::DropOldest);
+    size_t size = ecet.getEventQueueStatistics().mEventListSize;
+    std::vector<TEventEntry> fanOut;
+    for(size_t i = 0; i < 4; ++i) {
+      fanOut.emplace_back(nullptr, static_cast<TPortId>(1000 + i));
+    }
+    fillEventList(ecet, size - 1);
+    ecet.addEventEntries(fanOut.data(), fanOut.size());
+    BOOST_CHECK_EQUAL(3, ecet.getEventQueueStatistics().mDroppedEvents);
+
+    TEventEntry *event = ecet.popEventEntry();
+    BOOST_REQUIRE(nullptr != event);
+    BOOST_CHECK_EQUAL(3, event->mPortId);
+    size_t remaining = 1;
+    while(nullptr != (event = ecet.popEventEntry())) {
+      ++remaining;
+    }
+    BOOST_CHECK_EQUAL(size, remaining);
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_FanOutDropOldestWhileGrowing) {
+    CECETTestAccess ecet;
+    ecet.setOverflowPolicy(EEventQueueOverflowPolicy::DropOldest);
+    ecet.enableEventListGrowth(2);
+    size_t size = ecet.getEventQueueStatistics().mEventListSize;
+    std::vector<TEventEntry> fanOut;
+    for(size_t i = 0; i < 4; ++i) {
+      fanOut.emplace_back(nullptr, static_cast<TPortId>(size - 1 + i));
+    }
+    fillEventList(ecet, size - 1);
+    //popping frees space in the fixed list while the grown segments still hold events
+    BOOST_REQUIRE(nullptr != ecet.popEventEntry());
+    ecet.addEventEntries(fanOut.data(), fanOut.size());
+    BOOST_CHECK_EQUAL(2, ecet.getEventQueueStatistics().mDroppedEvents);
+
+    size_t expected = 3;
+    while(TEventEntry *event = ecet.popEventEntry()) {
+      BOOST_CHECK_EQUAL(expected, event->mPortId);
+      ++expected;
+    }
+    BOOST_CHECK_EQUAL(size + 3, expected);
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_DropOldestWhileGrowing) {
+    CECETTestAccess ecet;
+    ecet.setOverflowPolicy(EEventQueueOverflowPolicy::DropOldest);
+    ecet.enableEventListGrowth(1);
+    size_t size = ecet.getEventQueueStatistics().mEventListSize;
+    fillEventList(ecet, size + 3);
+    BOOST_CHECK_EQUAL(3, ecet.getEventQueueStatistics().mDroppedEvents);
+    size_t expected = 3;
+    while(TEventEntry *event = ecet.popEventEntry()) {
+      BOOST_CHECK_EQUAL(expected, event->mPortId);
+      ++expected;
+    }
+    BOOST_CHECK_EQUAL(size + 3, expected);
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_FanOutKeepsOrderWhileGrowing) {
+    const size_t fanOutWidth = 64;
+    std::vector<TEventEntry> fanOut;
+    for(size_t i = 0; i < fanOutWidth; ++i) {
+      fanOut.emplace_back(nullptr, static_cast<TPortId>(i));
+    }
+    CECETTestAccess ecet;
+    ecet.enableEventListGrowth(4);
+    //fill the fixed list and the grown segments with complete fan-outs
+    const size_t nrOfFanOuts = ecet.getEventQueueStatistics().mEventListSize / fanOutWidth;
+    for(size_t i = 0; i < nrOfFanOuts; ++i) {
+      ecet.addEventEntries(fanOut.data(), fanOut.size());
+    }
+    BOOST_CHECK_EQUAL(0, ecet.getEventQueueStatistics().mDroppedEvents);
+
+    size_t delivered = 0;
+    while(TEventEntry *event = ecet.popEventEntry()) {
+      BOOST_CHECK_EQUAL(delivered % fanOutWidth, event->mPortId);
+      ++delivered;
+    }
+    BOOST_CHECK_EQUAL(nrOfFanOuts * fanOutWidth, delivered);
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_PriorityOrder) {
+    CECETTestAccess ecet;
+    ecet.startEventChain(TEventEntry(nullptr, 1), EEventChainPriority::Low);
+    ecet.startEventChain(TEventEntry(nullptr, 2));
+    ecet.startEventChain(TEventEntry(nullptr, 3), EEventChainPriority::High);
+    ecet.transferExternalEvents();
+
+    TEventEntry *event = ecet.popEventEntry();
+    BOOST_REQUIRE(nullptr != event);
+    BOOST_CHECK_EQUAL(3, event->mPortId);
+
+    //events added while a high priority event is delivered inherit its priority
+    ecet.addEventEntry(TEventEntry(nullptr, 4));
+    event = ecet.popEventEntry();
+    BOOST_REQUIRE(nullptr != event);
+    BOOST_CHECK_EQUAL(4, event->mPortId);
+
+    event = ecet.popEventEntry();
+    BOOST_REQUIRE(nullptr != event);
+    BOOST_CHECK_EQUAL(2, event->mPortId);
+    ecet.addEventEntry(TEventEntry(nullptr, 5));
+
+    //a new high priority chain overtakes the queued normal and low priority events
+    ecet.startEventChain(TEventEntry(nullptr, 6), EEventChainPriority::High);
+    ecet.transferExternalEvents();
+    const TPortId expectedOrder[] = {6, 5, 1};
+    for(TPortId expected : expectedOrder) {
+      event = ecet.popEventEntry();
+      BOOST_REQUIRE(nullptr != event);
+      BOOST_CHECK_EQUAL(expected, event->mPortId);
+    }
+    BOOST_CHECK(nullptr == ecet.popEventEntry());
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_DeferredFlushOrder) {
+    CECETTestAccess ecet;
+    std::vector<int> flushes;
+    CDeferredFlushMock first(1, flushes);
+    CDeferredFlushMock second(2, flushes);
+    CDeferredFlushMock cancelled(3, flushes);
+    CDeferredFlushMock followUp(4, flushes);
+    first.mECET = &ecet;
+    first.mFollowUp = &followUp;
+
+    ecet.deferFlush(first);
+    ecet.deferFlush(cancelled);
+    ecet.deferFlush(second);
+    ecet.cancelFlush(cancelled);
+    ecet.flushDeferred();
+
+    const std::vector<int> expectedOrder = {1, 2, 4};
+    BOOST_CHECK_EQUAL_COLLECTIONS(expectedOrder.begin(), expectedOrder.end(), flushes.begin(), flushes.end());
+
+    //each registration results in one flush only
+    ecet.flushDeferred();
+    BOOST_CHECK_EQUAL(3, flushes.size());
+  }
+
+  BOOST_AUTO_TEST_CASE(ECET_DeferredFlushAfterLastEvent) {
+    CFlushingFBMock fb(10);
+    BOOST_REQUIRE(fb.initialize());
+
+    CEventChainExecutionThread ecet;
+    ecet.changeExecutionState(EMGMCommandType::Start);
+    ecet.startEventChain(TEventEntry(&fb, 0));
+    uint_fast64_t deadline = getNanoSecondsMonotonic() + 5000000000ULL;
+    while(0 == fb.getNumFlushes() && getNanoSecondsMonotonic() < deadline) {
+      CThread::sleepThread(0);
+    }
+    ecet.changeExecutionState(EMGMCommandType::Stop);
+    ecet.joinEventChainExecutionThread();
+
+    BOOST_CHECK_EQUAL(1, fb.getNumFlushes());
+    BOOST_CHECK_EQUAL(10, fb.mExecutedAtFlush);
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
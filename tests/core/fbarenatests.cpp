@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "../../src/core/fbcontainer.h"
+#include "../../src/core/funcbloc.h"
+#include "../../src/core/utils/arena.h"
+#include "fbtests/fbtesterglobalfixture.h"
+#include "resource.h"
+
+#include <string>
+
+using namespace forte::core;
+
+namespace {
+  //! container with its own arena, as a resource has it when cgResourceArenaChunkSize is set
+  class CArenaTestContainer : public CFBContainer {
+    public:
+      explicit CArenaTestContainer(bool paUseArena) :
+          CFBContainer(CStringDictionary::getInstance().insert("FBArenaTestContainer"), CFBTestDataGlobalFixture::getResource()),
+          mArena(paUseArena ? new util::CArena(64 * 1024) : nullptr) {
+      }
+
+      ~CArenaTestContainer() override {
+        deleteContainedFBs();
+        delete mArena;
+      }
+
+      util::CArena *getFBArena() override {
+        return mArena;
+      }
+
+      CFunctionBlock *create(const std::string &paInstanceName, const char *paTypeName) {
+        CStringDictionary::TStringId instanceNameId = CStringDictionary::getInstance().insert(paInstanceName.c_str());
+        if(EMGMResponse::Ready != createFB(instanceNameId, CStringDictionary::getInstance().insert(paTypeName))) {
+          return nullptr;
+        }
+        return getFB(instanceNameId);
+      }
+
+      bool remove(const std::string &paInstanceName) {
+        TNameIdentifier name;
+        name.pushBack(CStringDictionary::getInstance().insert(paInstanceName.c_str()));
+        TNameIdentifier::CIterator it(name.begin());
+        return EMGMResponse::Ready == deleteFB(it);
+      }
+
+      using CFBContainer::deleteContainedFBs;
+
+      util::CArena *mArena;
+  };
+
+  //! create a chain of counters connected by events and data, as an application deployment does
+  void deployCounterChain(CArenaTestContainer &paContainer, unsigned int paNumFBs) {
+    const CStringDictionary::TStringId cuoId = CStringDictionary::getInstance().insert("CUO");
+    const CStringDictionary::TStringId cuId = CStringDictionary::getInstance().insert("CU");
+    const CStringDictionary::TStringId cvId = CStringDictionary::getInstance().insert("CV");
+    const CStringDictionary::TStringId pvId = CStringDictionary::getInstance().insert("PV");
+    CFunctionBlock *previous = nullptr;
+    for(unsigned int i = 0; i < paNumFBs; ++i) {
+      CFunctionBlock *fb = paContainer.create("Counter" + std::to_string(i), "E_CTU");
+      BOOST_REQUIRE(nullptr != fb);
+      if(nullptr != previous) {
+        previous->getEOConnection(cuoId)->connect(fb, cuId);
+        previous->getDOConnection(cvId)->connect(fb, pvId);
+      }
+      previous = fb;
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(FBArena)
+
+  BOOST_AUTO_TEST_CASE(fbsAndTheirDataAreAllocatedFromTheArena) {
+    CArenaTestContainer container(true);
+    deployCounterChain(container, 3);
+    //each FB object and its connection and variable data
+    BOOST_CHECK_EQUAL(9, container.mArena->getNumAllocations());
+
+    container.deleteContainedFBs();
+    //with the last FB gone the arena has freed its chunks
+    BOOST_CHECK_EQUAL(0, container.mArena->getNumAllocations());
+    BOOST_CHECK_EQUAL(0, container.mArena->getReservedBytes());
+  }
+
+  BOOST_AUTO_TEST_CASE(recreatedFBsReuseTheFreedMemory) {
+    CArenaTestContainer container(true);
+    deployCounterChain(container, 3);
+    BOOST_REQUIRE(nullptr != container.create("Spare", "E_CTU"));
+    const size_t reservedBytes = container.mArena->getReservedBytes();
+    for(int i = 0; i < 100; ++i) {
+      BOOST_REQUIRE(container.remove("Spare"));
+      BOOST_REQUIRE(nullptr != container.create("Spare", "E_CTU"));
+    }
+    BOOST_CHECK_EQUAL(12, container.mArena->getNumAllocations());
+    BOOST_CHECK_EQUAL(reservedBytes, container.mArena->getReservedBytes());
+  }
+
+  BOOST_AUTO_TEST_CASE(genericAndAdapterFBsWorkInTheArena) {
+    CArenaTestContainer container(true);
+    BOOST_REQUIRE(nullptr != container.create("Demux", "E_DEMUX_4"));
+    BOOST_REQUIRE(nullptr != container.create("Publisher", "PUBLISH_2"));
+    BOOST_CHECK(container.mArena->getNumAllocations() >= 2);
+  }
+
+  BOOST_AUTO_TEST_CASE(genericFBsFreeTheirDataAfterTheirInterfaceIsGone) {
+    //communication FBs delete the type names of their interface before the data buffers are freed
+    CArenaTestContainer container(true);
+    BOOST_REQUIRE(nullptr != container.create("Publisher", "PUBLISH_2"));
+    const size_t reservedBytes = container.mArena->getReservedBytes();
+    for(int i = 0; i < 100; ++i) {
+      BOOST_REQUIRE(container.remove("Publisher"));
+      BOOST_REQUIRE(nullptr != container.create("Publisher", "PUBLISH_2"));
+    }
+    BOOST_CHECK_EQUAL(reservedBytes, container.mArena->getReservedBytes());
+    container.deleteContainedFBs();
+    BOOST_CHECK_EQUAL(0, container.mArena->getNumAllocations());
+  }
+
+  BOOST_AUTO_TEST_CASE(fbsWithoutArenaAreAllocatedOnTheHeap) {
+    CArenaTestContainer container(false);
+    deployCounterChain(container, 3);
+    BOOST_CHECK_EQUAL(3, container.getFBList().size());
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
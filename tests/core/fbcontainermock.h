@@ -37,6 +37,10 @@ class CFBContainerMock : public forte::core::CFBContainer{
       throw new std::bad_function_call();
     }
 
+    forte::core::util::CArena* getFBArena() override {
+      return nullptr;
+    }
+
   private:
     CFBContainerMock() : forte::core::CFBContainer(CStringDictionary::scmInvalidStringId, *this){
     };
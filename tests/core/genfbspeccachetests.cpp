@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "../../src/core/genfbspeccache.h"
+#include "../../src/core/typelib.h"
+#include "fbtests/fbtesterglobalfixture.h"
+#include "resource.h"
+
+namespace {
+  CFunctionBlock *createFB(const char *paTypeName) {
+    CFunctionBlock *fb = CTypeLib::createFB(CStringDictionary::getInstance().insert("GenFBSpecCacheTestFB"),
+        CStringDictionary::getInstance().insert(paTypeName), CFBTestDataGlobalFixture::getResource());
+    BOOST_REQUIRE(nullptr != fb);
+    return fb;
+  }
+
+  void checkName(const char *paExpected, CStringDictionary::TStringId paNameId) {
+    BOOST_CHECK_EQUAL(paExpected, CStringDictionary::getInstance().get(paNameId));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(GenFBInterfaceSpecCache)
+
+  BOOST_AUTO_TEST_CASE(instancesOfAConfiguredTypeShareTheSpec) {
+    SGenFBInterfaceSpecStatistics before = CGenFBInterfaceSpecCache::getInstance().getStatistics();
+
+    CFunctionBlock *first = createFB("E_DEMUX_3");
+    CFunctionBlock *second = createFB("E_DEMUX_3");
+    CFunctionBlock *other = createFB("E_DEMUX_4");
+    BOOST_CHECK(first->getFBInterfaceSpec() == second->getFBInterfaceSpec());
+    BOOST_CHECK(first->getFBInterfaceSpec() != other->getFBInterfaceSpec());
+    BOOST_CHECK_EQUAL(3, second->getFBInterfaceSpec()->mNumEOs);
+    BOOST_CHECK_EQUAL(4, other->getFBInterfaceSpec()->mNumEOs);
+
+    SGenFBInterfaceSpecStatistics statistics = CGenFBInterfaceSpecCache::getInstance().getStatistics();
+    BOOST_CHECK_EQUAL(before.mNumSpecs + 2, statistics.mNumSpecs);
+    BOOST_CHECK_EQUAL(before.mNumInstances + 3, statistics.mNumInstances);
+    BOOST_CHECK(statistics.mSavedBytes > before.mSavedBytes);
+
+    CTypeLib::deleteFB(first);
+    CTypeLib::deleteFB(other);
+    //the spec stays as long as an instance uses it
+    BOOST_CHECK_EQUAL(before.mNumSpecs + 1, CGenFBInterfaceSpecCache::getInstance().getStatistics().mNumSpecs);
+    BOOST_CHECK_EQUAL(2, second->getEOID(CStringDictionary::getInstance().insert("EO3")));
+    CTypeLib::deleteFB(second);
+
+    statistics = CGenFBInterfaceSpecCache::getInstance().getStatistics();
+    BOOST_CHECK_EQUAL(before.mNumSpecs, statistics.mNumSpecs);
+    BOOST_CHECK_EQUAL(before.mNumInstances, statistics.mNumInstances);
+    BOOST_CHECK_EQUAL(before.mSpecBytes, statistics.mSpecBytes);
+  }
+
+  BOOST_AUTO_TEST_CASE(cachedSpecIsACompleteCopy) {
+    CFunctionBlock *first = createFB("PUBLISH_2");
+    CFunctionBlock *second = createFB("PUBLISH_2");
+    const SFBInterfaceSpec *spec = second->getFBInterfaceSpec();
+    BOOST_REQUIRE_EQUAL(4, spec->mNumDIs);
+    checkName("QI", spec->mDINames[0]);
+    checkName("ID", spec->mDINames[1]);
+    checkName("SD_1", spec->mDINames[2]);
+    checkName("SD_2", spec->mDINames[3]);
+    checkName("BOOL", spec->mDIDataTypeNames[0]);
+    checkName("ANY", spec->mDIDataTypeNames[3]);
+    BOOST_REQUIRE_EQUAL(2, spec->mNumEIs);
+    checkName("INIT", spec->mEINames[0]);
+    checkName("REQ", spec->mEINames[1]);
+    BOOST_REQUIRE_EQUAL(2, spec->mNumEOs);
+    checkName("CNF", spec->mEONames[1]);
+    BOOST_CHECK_EQUAL(2, spec->mNumDOs);
+    checkName("STATUS", spec->mDONames[1]);
+    checkName("BOOL", spec->mDODataTypeNames[0]);
+    CTypeLib::deleteFB(first);
+    CTypeLib::deleteFB(second);
+  }
+
+  BOOST_AUTO_TEST_CASE(typesDerivingStateKeepTheirOwnSpec) {
+    CFunctionBlock *first = createFB("F_MUX_2_2");
+    CFunctionBlock *second = createFB("F_MUX_2_2");
+    BOOST_CHECK(first->getFBInterfaceSpec() != second->getFBInterfaceSpec());
+    CTypeLib::deleteFB(first);
+    CTypeLib::deleteFB(second);
+  }
+
+  BOOST_AUTO_TEST_CASE(firstInstanceOnlyUsesTheCachedSpec) {
+    SGenFBInterfaceSpecStatistics before = CGenFBInterfaceSpecCache::getInstance().getStatistics();
+
+    //the lists the first instance created for the spec are freed once the spec is cached
+    CFunctionBlock *first = createFB("E_MUX_3");
+    BOOST_CHECK_EQUAL(2, first->getEIID(CStringDictionary::getInstance().insert("EI3")));
+    SGenFBInterfaceSpecStatistics statistics = CGenFBInterfaceSpecCache::getInstance().getStatistics();
+    const size_t specBytes = statistics.mSpecBytes - before.mSpecBytes;
+    BOOST_CHECK(0 < specBytes);
+    BOOST_CHECK_EQUAL(before.mSavedBytes, statistics.mSavedBytes);
+
+    CFunctionBlock *second = createFB("E_MUX_3");
+    BOOST_CHECK(first->getFBInterfaceSpec() == second->getFBInterfaceSpec());
+    statistics = CGenFBInterfaceSpecCache::getInstance().getStatistics();
+    BOOST_CHECK_EQUAL(before.mSavedBytes + specBytes, statistics.mSavedBytes);
+
+    CTypeLib::deleteFB(second);
+    BOOST_CHECK_EQUAL(2, first->getEIID(CStringDictionary::getInstance().insert("EI3")));
+    CTypeLib::deleteFB(first);
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
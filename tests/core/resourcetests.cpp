@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "../../src/core/typelib.h"
+#include "../../src/core/ecet.h"
+#include "../../src/core/mgmcmdstruct.h"
+#include "fbtests/fbtesterglobalfixture.h"
+#include "resource.h"
+
+namespace {
+  //! a resource of its own, so that the execution parameters of the shared test resource stay untouched
+  class CTestResource {
+    public:
+      CTestResource() :
+          mResource(static_cast<CResource *>(CTypeLib::createFB(CStringDictionary::getInstance().insert("ParameterTestRes"),
+              CStringDictionary::getInstance().insert("EMB_RES"), *CFBTestDataGlobalFixture::getResource().getDevice()))) {
+        BOOST_REQUIRE(nullptr != mResource);
+      }
+
+      ~CTestResource() {
+        CTypeLib::deleteFB(mResource);
+      }
+
+      EMGMResponse write(const char *paName, const char *paValue) {
+        forte::core::SManagementCMD command;
+        command.mCMD = EMGMCommandType::Write;
+        command.mDestination = CStringDictionary::scmInvalidStringId;
+        command.mFirstParam.pushBack(CStringDictionary::getInstance().insert(paName));
+        command.mAdditionalParams = CIEC_STRING(paValue, strlen(paValue));
+        return mResource->executeMGMCommand(command);
+      }
+
+      CEventChainExecutionThread &getECET() {
+        return *mResource->getResourceEventExecution();
+      }
+
+      CResource *mResource;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(ResourceExecutionParameters)
+
+  BOOST_AUTO_TEST_CASE(overflowPolicyIsSetPerResource) {
+    CTestResource resource;
+    BOOST_CHECK(EMGMResponse::Ready == resource.write("EventQueueOverflowPolicy", "DropOldest"));
+    BOOST_CHECK(EEventQueueOverflowPolicy::DropOldest == resource.getECET().getOverflowPolicy());
+    BOOST_CHECK(EMGMResponse::Ready == resource.write("EventQueueOverflowPolicy", "BlockWithTimeout"));
+    BOOST_CHECK(EEventQueueOverflowPolicy::BlockWithTimeout == resource.getECET().getOverflowPolicy());
+  }
+
+  BOOST_AUTO_TEST_CASE(blockTimeoutIsATimeLiteral) {
+    CTestResource resource;
+    BOOST_CHECK(EMGMResponse::Ready == resource.write("EventQueueOverflowPolicy", "BlockWithTimeout"));
+    BOOST_CHECK(EMGMResponse::Ready == resource.write("EventQueueBlockTimeout", "T#5ms"));
+    BOOST_CHECK_EQUAL(5000000, resource.getECET().getBlockTimeout());
+    //changing the timeout keeps the policy and vice versa
+    BOOST_CHECK(EEventQueueOverflowPolicy::BlockWithTimeout == resource.getECET().getOverflowPolicy());
+    BOOST_CHECK(EMGMResponse::Ready == resource.write("EventQueueOverflowPolicy", "Coalesce"));
+    BOOST_CHECK_EQUAL(5000000, resource.getECET().getBlockTimeout());
+  }
+
+  BOOST_AUTO_TEST_CASE(invalidValuesAreRejected) {
+    CTestResource resource;
+    const EEventQueueOverflowPolicy policy = resource.getECET().getOverflowPolicy();
+    BOOST_CHECK(EMGMResponse::BadParams == resource.write("EventQueueOverflowPolicy", "DropAll"));
+    BOOST_CHECK(EMGMResponse::BadParams == resource.write("EventQueueBlockTimeout", "5ms"));
+    BOOST_CHECK(EMGMResponse::BadParams == resource.write("EventQueueBlockTimeout", "-T#5ms"));
+    BOOST_CHECK(policy == resource.getECET().getOverflowPolicy());
+    BOOST_CHECK(EMGMResponse::NoSuchObject == resource.write("NoExecutionParameter", "DropOldest"));
+  }
+
+  BOOST_AUTO_TEST_CASE(eventListGrowthIsSetPerResource) {
+    CTestResource resource;
+    const size_t fixedSize = resource.getECET().getEventQueueStatistics().mEventListSize;
+    BOOST_CHECK(EMGMResponse::Ready == resource.write("EventListGrowthSegments", "2"));
+    BOOST_CHECK_EQUAL(fixedSize + 2 * cgEventChainEventListSegmentSize, resource.getECET().getEventQueueStatistics().mEventListSize);
+    BOOST_CHECK(EMGMResponse::Ready == resource.write("EventListGrowthSegments", "1"));
+    BOOST_CHECK_EQUAL(fixedSize + cgEventChainEventListSegmentSize, resource.getECET().getEventQueueStatistics().mEventListSize);
+    BOOST_CHECK(EMGMResponse::BadParams == resource.write("EventListGrowthSegments", "0"));
+    BOOST_CHECK(EMGMResponse::BadParams == resource.write("EventListGrowthSegments", "many"));
+    BOOST_CHECK_EQUAL(fixedSize + cgEventChainEventListSegmentSize, resource.getECET().getEventQueueStatistics().mEventListSize);
+  }
+
+  BOOST_AUTO_TEST_CASE(processInterfacePriorityIsOptIn) {
+    CTestResource resource;
+    BOOST_CHECK(EEventChainPriority::Normal == resource.mResource->getProcessInterfacePriority());
+    BOOST_CHECK(EMGMResponse::Ready == resource.write("ProcessInterfacePriority", "High"));
+    BOOST_CHECK(EEventChainPriority::High == resource.mResource->getProcessInterfacePriority());
+    BOOST_CHECK(EMGMResponse::BadParams == resource.write("ProcessInterfacePriority", "Urgent"));
+    BOOST_CHECK(EEventChainPriority::High == resource.mResource->getProcessInterfacePriority());
+  }
+
+#ifdef FORTE_SUPPORT_QUERY_CMD
+  BOOST_AUTO_TEST_CASE(statisticsReportThePolicy) {
+    CTestResource resource;
+    BOOST_CHECK(EMGMResponse::Ready == resource.write("EventQueueOverflowPolicy", "DropOldest"));
+    forte::core::SManagementCMD command;
+    command.mCMD = EMGMCommandType::QueryStatistics;
+    command.mDestination = CStringDictionary::scmInvalidStringId;
+    BOOST_CHECK(EMGMResponse::Ready == resource.mResource->executeMGMCommand(command));
+    BOOST_CHECK(std::string::npos != command.mAdditionalParams.getStorage().find("OverflowPolicy=\"DropOldest\""));
+    BOOST_CHECK(std::string::npos != command.mAdditionalParams.getStorage().find(
+        "ECETs=\"" + std::to_string(cgResourceExecutionWorkers > 1 ? cgResourceExecutionWorkers : 1) + "\""));
+  }
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
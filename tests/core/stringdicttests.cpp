@@ -18,7 +18,11 @@
 #include "stringlist.h"
 #endif
 
+#include <atomic>
 #include <list>
+#include <string>
+#include <thread>
+#include <vector>
 #include <stdio.h>
 
 #ifndef _MSC_VER //somehow required here, because visual studio gives a linker error
@@ -114,4 +118,70 @@ BOOST_AUTO_TEST_SUITE(StringDictTests)
 
   }
 
+  BOOST_AUTO_TEST_CASE(concurrentReadersDuringInsert){
+    //readers must neither miss published strings nor see moved ones while the dictionary grows
+    const unsigned int nrOfStrings = 20000;
+    std::vector<std::string> strings;
+    for(unsigned int i = 0; i < nrOfStrings; i++){
+      strings.push_back("ConcurrentTestString" + std::to_string(i));
+    }
+    std::vector<CStringDictionary::TStringId> ids(nrOfStrings, CStringDictionary::scmInvalidStringId);
+    std::atomic<unsigned int> nrOfPublished(0);
+    std::atomic<bool> failed(false);
+    const char *boolStr = CStringDictionary::getInstance().get(g_nStringIdBOOL);
+
+    std::vector<std::thread> readers;
+    for(unsigned int i = 0; i < 3; i++){
+      readers.emplace_back([&, i](){
+        unsigned int published;
+        do{
+          published = nrOfPublished.load(std::memory_order_acquire);
+          if(0 < published){
+            unsigned int idx = (published * 7919 + i) % published;
+            const char *str = CStringDictionary::getInstance().get(ids[idx]);
+            if(nullptr == str || strings[idx] != str ||
+                ids[idx] != CStringDictionary::getInstance().getId(strings[idx].c_str())){
+              failed = true;
+            }
+          }
+          if(boolStr != CStringDictionary::getInstance().get(g_nStringIdBOOL)){
+            failed = true;
+          }
+        } while(published < nrOfStrings);
+      });
+    }
+
+    for(unsigned int i = 0; i < nrOfStrings; i++){
+      ids[i] = CStringDictionary::getInstance().insert(strings[i].c_str());
+      nrOfPublished.store(i + 1, std::memory_order_release);
+    }
+    for(std::thread &reader : readers){
+      reader.join();
+    }
+
+    BOOST_CHECK(!failed);
+    BOOST_CHECK_EQUAL(std::string("BOOL"), boolStr);
+    for(unsigned int i = 0; i < nrOfStrings; i++){
+      BOOST_CHECK_EQUAL(strings[i], CStringDictionary::getInstance().get(ids[i]));
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(repeatedInsertsReturnTheFirstId){
+    //a boot file inserts the same instance and port names once per connection
+    const unsigned int nrOfStrings = 5000;
+    std::vector<std::string> strings;
+    std::vector<CStringDictionary::TStringId> ids;
+    for(unsigned int i = 0; i < nrOfStrings; i++){
+      strings.push_back("RepeatedInsertFB" + std::to_string(i));
+      ids.push_back(CStringDictionary::getInstance().insert(strings[i].c_str(), strings[i].size()));
+      BOOST_REQUIRE(CStringDictionary::scmInvalidStringId != ids[i]);
+    }
+    for(unsigned int i = 0; i < nrOfStrings; i++){
+      BOOST_CHECK_EQUAL(ids[i], CStringDictionary::getInstance().insert(strings[i].c_str()));
+      BOOST_CHECK_EQUAL(ids[i], CStringDictionary::getInstance().insert(strings[i].c_str(), strings[i].size()));
+      BOOST_CHECK_EQUAL(strings[i], CStringDictionary::getInstance().get(ids[i]));
+    }
+    BOOST_CHECK_EQUAL(g_nStringIdBOOL, CStringDictionary::getInstance().insert("BOOL"));
+  }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "../../src/core/typelib.h"
+#include "../../src/core/funcbloc.h"
+#include "fbtests/fbtesterglobalfixture.h"
+#include "resource.h"
+
+namespace {
+  void checkIndexMatchesList(CTypeLib::CTypeEntry *paListStart) {
+    for(CTypeLib::CTypeEntry *runner = paListStart; nullptr != runner; runner = runner->mNext) {
+      BOOST_CHECK(runner == CTypeLib::findType(runner->getTypeNameId(), paListStart));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(TypeLibTests)
+
+  BOOST_AUTO_TEST_CASE(indexedLookupMatchesTheTypeLists) {
+    checkIndexMatchesList(CTypeLib::getFBLibStart());
+    checkIndexMatchesList(CTypeLib::getAdapterLibStart());
+    checkIndexMatchesList(CTypeLib::getDTLibStart());
+  }
+
+  BOOST_AUTO_TEST_CASE(unknownTypesAreNotFound) {
+    CStringDictionary::TStringId unknownId = CStringDictionary::getInstance().insert("TypeLibTestUnknownType");
+    BOOST_CHECK(nullptr == CTypeLib::findType(unknownId, CTypeLib::getFBLibStart()));
+    BOOST_CHECK(nullptr == CTypeLib::findType(unknownId, CTypeLib::getAdapterLibStart()));
+    BOOST_CHECK(nullptr == CTypeLib::findType(unknownId, CTypeLib::getDTLibStart()));
+  }
+
+  BOOST_AUTO_TEST_CASE(genericFBsAreCreatedFromTheirGENType) {
+    CStringDictionary::TStringId instanceId = CStringDictionary::getInstance().insert("TypeLibTestFB");
+    CStringDictionary::TStringId typeId = CStringDictionary::getInstance().insert("E_DEMUX_3");
+    //the second creation takes the GEN_E_DEMUX entry from the cache
+    for(unsigned int i = 0; i < 2; i++) {
+      CFunctionBlock *fb = CTypeLib::createFB(instanceId, typeId, CFBTestDataGlobalFixture::getResource());
+      BOOST_REQUIRE(nullptr != fb);
+      BOOST_CHECK_EQUAL(typeId, fb->getFBTypeId());
+      BOOST_CHECK_EQUAL(2, fb->getEOID(CStringDictionary::getInstance().insert("EO3")));
+      CTypeLib::deleteFB(fb);
+    }
+
+    CStringDictionary::TStringId unknownGenericId = CStringDictionary::getInstance().insert("TYPELIBTESTUNKNOWN_3");
+    for(unsigned int i = 0; i < 2; i++) {
+      BOOST_CHECK(nullptr == CTypeLib::createFB(instanceId, unknownGenericId, CFBTestDataGlobalFixture::getResource()));
+      BOOST_CHECK(EMGMResponse::UnsupportedType == CTypeLib::getLastError());
+    }
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
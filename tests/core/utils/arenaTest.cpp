@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "../../../src/core/utils/arena.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace forte::core::util;
+
+namespace {
+  bool isAligned(const void *paMemory) {
+    return 0 == reinterpret_cast<std::uintptr_t>(paMemory) % CArena::scmAlignment;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(Arena_Test)
+
+  BOOST_AUTO_TEST_CASE(Arena_InitiallyEmpty) {
+    CArena uut(1024);
+    BOOST_CHECK_EQUAL(0, uut.getNumAllocations());
+    BOOST_CHECK_EQUAL(0, uut.getReservedBytes());
+  }
+
+  BOOST_AUTO_TEST_CASE(Arena_AllocationsAreAlignedAndConsecutive) {
+    CArena uut(1024);
+    char *first = static_cast<char*>(uut.allocate(3));
+    char *second = static_cast<char*>(uut.allocate(40));
+    char *third = static_cast<char*>(uut.allocate(1));
+    BOOST_CHECK(isAligned(first));
+    BOOST_CHECK(isAligned(second));
+    BOOST_CHECK(isAligned(third));
+    BOOST_CHECK_EQUAL(static_cast<std::ptrdiff_t>(CArena::scmAlignment), second - first);
+    BOOST_CHECK(third > second && third - second < 64);
+    BOOST_CHECK_EQUAL(3, uut.getNumAllocations());
+    BOOST_CHECK_EQUAL(1024, uut.getReservedBytes());
+  }
+
+  BOOST_AUTO_TEST_CASE(Arena_FullChunkStartsANewOne) {
+    CArena uut(256);
+    std::vector<char*> blocks;
+    for(int i = 0; i < 20; ++i) {
+      char *block = static_cast<char*>(uut.allocate(48));
+      memset(block, i, 48);
+      blocks.push_back(block);
+    }
+    for(int i = 0; i < 20; ++i) {
+      BOOST_CHECK_EQUAL(i, blocks[i][0]);
+      BOOST_CHECK_EQUAL(i, blocks[i][47]);
+    }
+    BOOST_CHECK_EQUAL(20 * 48, uut.getAllocatedBytes());
+    BOOST_CHECK_EQUAL(4 * 256, uut.getReservedBytes());
+  }
+
+  BOOST_AUTO_TEST_CASE(Arena_LargeAllocationsGetOwnChunk) {
+    CArena uut(256);
+    char *small = static_cast<char*>(uut.allocate(16));
+    char *large = static_cast<char*>(uut.allocate(1000));
+    char *next = static_cast<char*>(uut.allocate(16));
+    memset(large, 0x55, 1000);
+    BOOST_CHECK(isAligned(large));
+    //the current chunk is used on after the large allocation
+    BOOST_CHECK_EQUAL(small + 16, next);
+    BOOST_CHECK_EQUAL(256 + 1008, uut.getReservedBytes());
+  }
+
+  BOOST_AUTO_TEST_CASE(Arena_FreeingTheLastAllocationReleasesAllChunks) {
+    CArena uut(256);
+    void *first = uut.allocate(16);
+    void *second = uut.allocate(1000);
+    uut.deallocate(nullptr, 16);
+    uut.deallocate(first, 16);
+    BOOST_CHECK_EQUAL(1, uut.getNumAllocations());
+    BOOST_CHECK(0 != uut.getReservedBytes());
+    uut.deallocate(second, 1000);
+    BOOST_CHECK_EQUAL(0, uut.getNumAllocations());
+    BOOST_CHECK_EQUAL(0, uut.getReservedBytes());
+    BOOST_CHECK(nullptr != uut.allocate(16));
+    BOOST_CHECK_EQUAL(256, uut.getReservedBytes());
+  }
+
+  BOOST_AUTO_TEST_CASE(Arena_FreedMemoryIsReusedForTheSameSize) {
+    CArena uut(256);
+    void *keep = uut.allocate(16);
+    void *first = uut.allocate(40);
+    void *second = uut.allocate(40);
+    uut.deallocate(first, 40);
+    uut.deallocate(second, 40);
+    BOOST_CHECK_EQUAL(16, uut.getAllocatedBytes());
+    //a different size does not take the freed memory
+    BOOST_CHECK(first != uut.allocate(16));
+    BOOST_CHECK_EQUAL(second, uut.allocate(40));
+    BOOST_CHECK_EQUAL(first, uut.allocate(33));
+    BOOST_CHECK_EQUAL(256, uut.getReservedBytes());
+    uut.deallocate(keep, 16);
+  }
+
+  BOOST_AUTO_TEST_CASE(Arena_FreeingALargeAllocationFreesItsChunk) {
+    CArena uut(256);
+    uut.allocate(16);
+    void *large = uut.allocate(1000);
+    void *secondLarge = uut.allocate(2000);
+    uut.deallocate(large, 1000);
+    BOOST_CHECK_EQUAL(256 + 2000, uut.getReservedBytes());
+    uut.deallocate(secondLarge, 2000);
+    BOOST_CHECK_EQUAL(256, uut.getReservedBytes());
+    BOOST_CHECK_EQUAL(16, uut.getAllocatedBytes());
+  }
+
+  BOOST_AUTO_TEST_CASE(Arena_Release) {
+    CArena uut(256);
+    for(int i = 0; i < 100; ++i) {
+      uut.allocate(32);
+    }
+    uut.release();
+    BOOST_CHECK_EQUAL(0, uut.getNumAllocations());
+    BOOST_CHECK_EQUAL(0, uut.getAllocatedBytes());
+    BOOST_CHECK_EQUAL(0, uut.getReservedBytes());
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
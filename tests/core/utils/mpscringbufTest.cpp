@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "../../../src/core/utils/mpscringbuf.h"
+
+#include <thread>
+#include <vector>
+
+using namespace forte::core::util;
+
+BOOST_AUTO_TEST_SUITE(MPSCRingBuffer_Test)
+
+  BOOST_AUTO_TEST_CASE(MPSCRingBuffer_InitiallyEmpty) {
+    CMPSCRingBuffer<int, 8> uut;
+    int val = 0;
+    BOOST_CHECK(uut.isEmpty());
+    BOOST_CHECK(!uut.pop(val));
+  }
+
+  BOOST_AUTO_TEST_CASE(MPSCRingBuffer_FifoOrderWithWrapAround) {
+    CMPSCRingBuffer<int, 4> uut;
+    int val = 0;
+    for(int round = 0; round < 5; ++round) {
+      for(int i = 0; i < 3; ++i) {
+        BOOST_CHECK(uut.push(round * 10 + i));
+      }
+      BOOST_CHECK(!uut.isEmpty());
+      for(int i = 0; i < 3; ++i) {
+        BOOST_CHECK(uut.pop(val));
+        BOOST_CHECK_EQUAL(round * 10 + i, val);
+      }
+      BOOST_CHECK(uut.isEmpty());
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(MPSCRingBuffer_FullBufferRejectsPush) {
+    CMPSCRingBuffer<int, 4> uut;
+    int val = 0;
+    for(int i = 0; i < 4; ++i) {
+      BOOST_CHECK(uut.push(i));
+    }
+    BOOST_CHECK(!uut.push(4));
+    BOOST_CHECK(uut.pop(val));
+    BOOST_CHECK_EQUAL(0, val);
+    BOOST_CHECK(uut.push(4));
+  }
+
+  BOOST_AUTO_TEST_CASE(MPSCRingBuffer_Clear) {
+    CMPSCRingBuffer<int, 4> uut;
+    int val = 0;
+    uut.push(1);
+    uut.push(2);
+    uut.clear();
+    BOOST_CHECK(uut.isEmpty());
+    BOOST_CHECK(!uut.pop(val));
+  }
+
+  BOOST_AUTO_TEST_CASE(MPSCRingBuffer_ConcurrentProducersDeliverEveryElementOnce) {
+    constexpr unsigned int numProducers = 4;
+    constexpr unsigned int elementsPerProducer = 20000;
+    CMPSCRingBuffer<unsigned int, 16> uut;
+    std::vector<unsigned int> received(numProducers * elementsPerProducer, 0);
+    std::vector<unsigned int> lastOfProducer(numProducers, 0);
+
+    std::vector<std::thread> producers;
+    for(unsigned int p = 0; p < numProducers; ++p) {
+      producers.emplace_back([p, &uut] {
+        for(unsigned int i = 0; i < elementsPerProducer; ++i) {
+          while(!uut.push(p * elementsPerProducer + i)) {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+    unsigned int val;
+    bool inProducerOrder = true;
+    for(unsigned int count = 0; count < numProducers * elementsPerProducer;) {
+      if(uut.pop(val)) {
+        received[val]++;
+        //the elements of one producer have to arrive in the order they were pushed
+        unsigned int producer = val / elementsPerProducer;
+        unsigned int index = val % elementsPerProducer;
+        inProducerOrder = inProducerOrder && (0 == index || lastOfProducer[producer] + 1 == index);
+        lastOfProducer[producer] = index;
+        ++count;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    for(auto &producer : producers) {
+      producer.join();
+    }
+    BOOST_CHECK(inProducerOrder);
+    for(auto count : received) {
+      BOOST_REQUIRE_EQUAL(1U, count);
+    }
+    BOOST_CHECK(uut.isEmpty());
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
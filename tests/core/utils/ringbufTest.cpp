@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "../../../src/core/utils/ringbuf.h"
+
+#include <string>
+
+using namespace forte::core::util;
+
+BOOST_AUTO_TEST_SUITE(RingBuffer_Test)
+
+  BOOST_AUTO_TEST_CASE(RingBuffer_PushPop) {
+    CRingBuffer<int, 8> uut;
+    uut.clear();
+    BOOST_CHECK(uut.isEmpty());
+    BOOST_CHECK_EQUAL(7, uut.getFreeSpace());
+    for(int i = 0; i < 7; ++i) {
+      BOOST_CHECK(uut.push(i));
+    }
+    BOOST_CHECK(uut.isFull());
+    BOOST_CHECK(!uut.push(7));
+    for(int i = 0; i < 7; ++i) {
+      int *val = uut.pop();
+      BOOST_REQUIRE(nullptr != val);
+      BOOST_CHECK_EQUAL(i, *val);
+    }
+    BOOST_CHECK(nullptr == uut.pop());
+  }
+
+  BOOST_AUTO_TEST_CASE(RingBuffer_PushAllWrapsAround) {
+    CRingBuffer<int, 8> uut;
+    uut.clear();
+    const int values[] = {10, 11, 12, 13, 14};
+    for(int i = 0; i < 5; ++i) {
+      uut.push(i);
+      uut.pop();
+    }
+    BOOST_CHECK(uut.pushAll(values, 5));
+    BOOST_CHECK_EQUAL(5, uut.getNumberOfElements());
+    for(int expected : values) {
+      int *val = uut.pop();
+      BOOST_REQUIRE(nullptr != val);
+      BOOST_CHECK_EQUAL(expected, *val);
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(RingBuffer_PushAllIsAllOrNothing) {
+    CRingBuffer<int, 8> uut;
+    uut.clear();
+    const int values[] = {1, 2, 3, 4, 5};
+    BOOST_CHECK(uut.pushAll(values, 5));
+    BOOST_CHECK(!uut.pushAll(values, 3));
+    BOOST_CHECK_EQUAL(5, uut.getNumberOfElements());
+    BOOST_CHECK(uut.pushAll(values, 2));
+    BOOST_CHECK(uut.isFull());
+    BOOST_CHECK(uut.pushAll(values, 0));
+  }
+
+  BOOST_AUTO_TEST_CASE(RingBuffer_PushAllNonTrivialType) {
+    CRingBuffer<std::string, 4> uut;
+    uut.clear();
+    const std::string values[] = {"a", "b", "c"};
+    BOOST_CHECK(uut.pushAll(values, 3));
+    BOOST_CHECK(uut.contains("b"));
+    BOOST_CHECK_EQUAL("a", *uut.pop());
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "../../../src/core/utils/segmentedringbuf.h"
+
+using namespace forte::core::util;
+
+BOOST_AUTO_TEST_SUITE(SegmentedRingBuffer_Test)
+
+  BOOST_AUTO_TEST_CASE(SegmentedRingBuffer_InitiallyEmptyWithoutSegments) {
+    CSegmentedRingBuffer<int, 4> uut(3);
+    BOOST_CHECK(uut.isEmpty());
+    BOOST_CHECK_EQUAL(0, uut.getCapacity());
+    BOOST_CHECK_EQUAL(12, uut.getMaxCapacity());
+    BOOST_CHECK(nullptr == uut.pop());
+  }
+
+  BOOST_AUTO_TEST_CASE(SegmentedRingBuffer_GrowsUpToMaxSegments) {
+    CSegmentedRingBuffer<int, 4> uut(3);
+    for(int i = 0; i < 12; ++i) {
+      BOOST_CHECK(uut.push(i));
+    }
+    BOOST_CHECK_EQUAL(12, uut.getCapacity());
+    BOOST_CHECK(!uut.push(12));
+    BOOST_CHECK(uut.contains(7));
+    BOOST_CHECK(!uut.contains(12));
+    for(int i = 0; i < 12; ++i) {
+      int *val = uut.pop();
+      BOOST_REQUIRE(nullptr != val);
+      BOOST_CHECK_EQUAL(i, *val);
+    }
+    BOOST_CHECK(uut.isEmpty());
+  }
+
+  BOOST_AUTO_TEST_CASE(SegmentedRingBuffer_ShrinksAfterBurst) {
+    CSegmentedRingBuffer<int, 4> uut(8, 1);
+    for(int i = 0; i < 32; ++i) {
+      uut.push(i);
+    }
+    BOOST_CHECK_EQUAL(32, uut.getCapacity());
+    while(nullptr != uut.pop()) {
+    }
+    // one segment stays in use and one is kept as spare
+    BOOST_CHECK_EQUAL(8, uut.getCapacity());
+    uut.clear();
+    BOOST_CHECK_EQUAL(4, uut.getCapacity());
+  }
+
+  BOOST_AUTO_TEST_CASE(SegmentedRingBuffer_InterleavedPushPop) {
+    CSegmentedRingBuffer<int, 4> uut(2);
+    int expected = 0;
+    int next = 0;
+    for(int round = 0; round < 20; ++round) {
+      for(int i = 0; i < 5; ++i) {
+        BOOST_CHECK(uut.push(next++));
+      }
+      for(int i = 0; i < 5; ++i) {
+        int *val = uut.pop();
+        BOOST_REQUIRE(nullptr != val);
+        BOOST_CHECK_EQUAL(expected++, *val);
+      }
+    }
+    BOOST_CHECK_EQUAL(8, uut.getCapacity());
+  }
+
+  BOOST_AUTO_TEST_CASE(SegmentedRingBuffer_PushAllIsAllOrNothing) {
+    CSegmentedRingBuffer<int, 4> uut(2);
+    const int values[] = {0, 1, 2, 3, 4, 5};
+    BOOST_CHECK(uut.pushAll(values, 6));
+    BOOST_CHECK_EQUAL(2, uut.getFreeSpace());
+    BOOST_CHECK(!uut.pushAll(values, 3));
+    BOOST_CHECK_EQUAL(6, uut.getNumberOfElements());
+    // popped elements free their space right away, even if their segment is not yet drained
+    uut.pop();
+    BOOST_CHECK_EQUAL(3, uut.getFreeSpace());
+    BOOST_CHECK(uut.pushAll(values, 3));
+    BOOST_CHECK(!uut.push(6));
+    BOOST_CHECK_EQUAL(12, uut.getCapacity());
+    for(int expected : {1, 2, 3, 4, 5, 0, 1, 2}) {
+      int *val = uut.pop();
+      BOOST_REQUIRE(nullptr != val);
+      BOOST_CHECK_EQUAL(expected, *val);
+    }
+  }
+
+BOOST_AUTO_TEST_SUITE_END()
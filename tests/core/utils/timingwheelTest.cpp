@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *******************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include "../../../src/core/utils/timingwheel.h"
+
+#include <vector>
+
+using namespace forte::core::util;
+
+namespace {
+  struct STestTimer : CTimingWheel::STimer {
+    uint_fast64_t mInterval = 0;
+    uint_fast64_t mExpiredAt = 0;
+    unsigned int mExpirations = 0;
+  };
+
+  //! advance the wheel up to paTicks ticks, re-arming periodic timers, returns the number of expirations
+  size_t advance(CTimingWheel &paWheel, uint_fast64_t paTicks) {
+    size_t expirations = 0;
+    for(uint_fast64_t i = 0; i < paTicks; ++i) {
+      paWheel.tick([&paWheel, &expirations](CTimingWheel::STimer &paTimer) {
+        STestTimer &timer = static_cast<STestTimer &>(paTimer);
+        timer.mExpiredAt = paWheel.getNow();
+        ++timer.mExpirations;
+        ++expirations;
+        if(0 != timer.mInterval) {
+          timer.mTimeOut = paWheel.getNow() + timer.mInterval;
+          paWheel.add(timer);
+        }
+      });
+    }
+    return expirations;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(TimingWheel_Test)
+
+  BOOST_AUTO_TEST_CASE(TimingWheel_ExpiresAtTimeOut) {
+    CTimingWheel uut;
+    const uint_fast64_t timeOuts[] = {1, 2, 255, 256, 257, 511, 65535, 65536, 65537, 70000, 16777216 + 3};
+    std::vector<STestTimer> timers(sizeof(timeOuts) / sizeof(timeOuts[0]));
+    for(size_t i = 0; i < timers.size(); ++i) {
+      timers[i].mTimeOut = timeOuts[i];
+      uut.add(timers[i]);
+    }
+    BOOST_CHECK_EQUAL(timers.size(), uut.getNumberOfTimers());
+    BOOST_CHECK_EQUAL(timers.size(), advance(uut, 16777216 + 3));
+    for(size_t i = 0; i < timers.size(); ++i) {
+      BOOST_CHECK_EQUAL(1, timers[i].mExpirations);
+      BOOST_CHECK_EQUAL(timeOuts[i], timers[i].mExpiredAt);
+      BOOST_CHECK(!timers[i].isActive());
+    }
+    BOOST_CHECK_EQUAL(0, uut.getNumberOfTimers());
+  }
+
+  BOOST_AUTO_TEST_CASE(TimingWheel_PastTimeOutExpiresWithNextTick) {
+    CTimingWheel uut(100);
+    STestTimer timer;
+    timer.mTimeOut = 50;
+    uut.add(timer);
+    BOOST_CHECK_EQUAL(1, advance(uut, 1));
+    BOOST_CHECK_EQUAL(101, timer.mExpiredAt);
+  }
+
+  BOOST_AUTO_TEST_CASE(TimingWheel_RemoveAndReAdd) {
+    CTimingWheel uut;
+    STestTimer first;
+    STestTimer second;
+    STestTimer third;
+    first.mTimeOut = second.mTimeOut = third.mTimeOut = 300;
+    uut.add(first);
+    uut.add(second);
+    uut.add(third);
+    uut.remove(second);
+    uut.remove(second);
+    BOOST_CHECK(!second.isActive());
+    BOOST_CHECK_EQUAL(2, uut.getNumberOfTimers());
+    //re-adding an active timer moves it
+    first.mTimeOut = 400;
+    uut.add(first);
+    BOOST_CHECK_EQUAL(2, uut.getNumberOfTimers());
+    BOOST_CHECK_EQUAL(1, advance(uut, 300));
+    BOOST_CHECK_EQUAL(300, third.mExpiredAt);
+    BOOST_CHECK_EQUAL(0, second.mExpirations);
+    BOOST_CHECK_EQUAL(1, advance(uut, 100));
+    BOOST_CHECK_EQUAL(400, first.mExpiredAt);
+  }
+
+  BOOST_AUTO_TEST_CASE(TimingWheel_PeriodicTimers) {
+    CTimingWheel uut;
+    std::vector<STestTimer> timers(3);
+    const uint_fast64_t intervals[] = {1, 7, 1000};
+    for(size_t i = 0; i < timers.size(); ++i) {
+      timers[i].mInterval = intervals[i];
+      timers[i].mTimeOut = intervals[i];
+      uut.add(timers[i]);
+    }
+    advance(uut, 70000);
+    BOOST_CHECK_EQUAL(70000, timers[0].mExpirations);
+    BOOST_CHECK_EQUAL(10000, timers[1].mExpirations);
+    BOOST_CHECK_EQUAL(70, timers[2].mExpirations);
+  }
+
+  BOOST_AUTO_TEST_CASE(TimingWheel_SkipIdleTicks) {
+    CTimingWheel uut(200);
+    const uint_fast64_t timeOuts[] = {201, 300, 456, 457, 1000, 65536, 65537, 70000, 16777216 + 3};
+    std::vector<STestTimer> timers(sizeof(timeOuts) / sizeof(timeOuts[0]));
+    for(size_t i = 0; i < timers.size(); ++i) {
+      timers[i].mTimeOut = timeOuts[i];
+      uut.add(timers[i]);
+    }
+    BOOST_CHECK_EQUAL(0, uut.getIdleTicks(1000));
+    BOOST_CHECK_EQUAL(1, advance(uut, 1));
+    BOOST_CHECK_EQUAL(10, uut.getIdleTicks(10));
+    unsigned int numTicks = 0;
+    while(0 != uut.getNumberOfTimers()) {
+      uut.skip(uut.getIdleTicks(1 << 24));
+      advance(uut, 1);
+      ++numTicks;
+    }
+    for(size_t i = 0; i < timers.size(); ++i) {
+      BOOST_CHECK_EQUAL(1, timers[i].mExpirations);
+      BOOST_CHECK_EQUAL(timeOuts[i], timers[i].mExpiredAt);
+    }
+    //besides the expirations only the ticks cascading timers are handled
+    BOOST_TEST(numTicks < 20);
+    BOOST_CHECK_EQUAL(5000, uut.getIdleTicks(5000));
+  }
+
+  BOOST_AUTO_TEST_CASE(TimingWheel_ManyPeriodicTimersExpireOnTime) {
+    const unsigned int ticks = 2000;
+    const size_t numTimers = 10000;
+    CTimingWheel uut;
+    std::vector<STestTimer> timers(numTimers);
+    size_t expectedExpirations = 0;
+    for(size_t i = 0; i < numTimers; ++i) {
+      timers[i].mInterval = 1 + i % 1000;
+      timers[i].mTimeOut = timers[i].mInterval;
+      uut.add(timers[i]);
+      expectedExpirations += ticks / timers[i].mInterval;
+    }
+    BOOST_CHECK_EQUAL(expectedExpirations, advance(uut, ticks));
+    BOOST_CHECK_EQUAL(numTimers, uut.getNumberOfTimers());
+    for(const STestTimer &timer : timers) {
+      BOOST_REQUIRE_EQUAL(ticks / timer.mInterval, timer.mExpirations);
+      BOOST_REQUIRE_EQUAL(timer.mExpirations * timer.mInterval, timer.mExpiredAt);
+    }
+  }
+
+BOOST_AUTO_TEST_SUITE_END()